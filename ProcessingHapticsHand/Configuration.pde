@@ -14,6 +14,9 @@ final int windowHeight = 800;
 // Identify the correct port for your device and update the index below.
 final int SERIAL_PORT_INDEX = 8; // <--- CHANGE THIS INDEX AS NEEDED
 final int BAUD_RATE = 115200;
+// Delta-encoded binary telemetry (haplink_telemetry.h). Must match
+// TELEMETRY_DELTA_ENCODING in the firmware's main.h
+final boolean BINARY_TELEMETRY = true;
 
 // Simulation Mode
 // Set to true to use simulated data instead of serial data
@@ -11,6 +11,7 @@ boolean dataReceived = false;
 int sayHiForFirstTime = 0;
 String messageBuffer = ""; // Changed to String for character buffering
 float[] serialVals = new float[13]; // Array to store parsed values
+TelemetryDecoder telemetryDecoder = new TelemetryDecoder(); // used when BINARY_TELEMETRY is on
 
 void setupSerial() {
   if (!SIMULATION_MODE) {
@@ -23,7 +24,9 @@ void setupSerial() {
       println("Attempting to connect to: " + portName + " at index " + SERIAL_PORT_INDEX);
       try {
         myPort = new Serial(this, portName, BAUD_RATE);
-        myPort.bufferUntil('\n'); // Buffer until newline character
+        if (!BINARY_TELEMETRY) {
+          myPort.bufferUntil('\n'); // Buffer until newline character
+        }
         println("Serial port opened successfully.");
       } catch (Exception e) {
         println("Error opening serial port: " + portName);
@@ -59,8 +62,13 @@ void updateSerialData() {
   // delay(10); // Short delay
 }
 
-// Called automatically when serial data arrives (ending with newline)
+// Called automatically when serial data arrives (ending with newline,
+// or on every byte when BINARY_TELEMETRY is on)
 void serialEvent(Serial p) {
+  if (BINARY_TELEMETRY) {
+    readBinaryTelemetry(p);
+    return;
+  }
   String messageString = p.readStringUntil('\n');
   if (messageString != null) {
     messageString = messageString.trim(); // Remove leading/trailing whitespace
@@ -89,3 +97,28 @@ void serialEvent(Serial p) {
     }
   }
 }
+
+// Feeds the delta-encoded frames to the decoder and updates the hand state
+void readBinaryTelemetry(Serial p) {
+  while (p.available() > 0) {
+    if (telemetryDecoder.feed(p.read())) {
+      for (int i = 0; i < TELEMETRY_NUM_FIELDS; i++) {
+        serialVals[i] = telemetryDecoder.value(i);
+      }
+      thumb_end.set(serialVals[0], serialVals[1], serialVals[2]);
+      index_end.set(serialVals[3], serialVals[4], serialVals[5]);
+      middle_end.set(serialVals[6], serialVals[7], serialVals[8]);
+      object_position.set(serialVals[9], serialVals[10], serialVals[11]);
+      object_radius = serialVals[12];
+      dataReceived = true;
+    }
+    if (telemetryDecoder.needKeyframe) {
+      p.write("kl"); // lost a frame, ask the firmware for a full one
+      telemetryDecoder.needKeyframe = false;
+    }
+    String line = telemetryDecoder.takeTextLine();
+    if (line != null) {
+      println("Serial: " + line.trim());
+    }
+  }
+}
@@ -0,0 +1,168 @@
+/**
+ * TelemetryDecoder.pde
+ *
+ * Decodes the delta-encoded binary telemetry frames sent by the firmware
+ * (see haplink_telemetry.h). Bytes that are not part of a frame are collected
+ * into text lines so debug prints still show up in the console.
+ *
+ * Frame: [0xA5][type][len][payload][crc8 over type, len, payload]
+ *   'K' keyframe: [seq][13 zigzag varints, absolute values]
+ *   'D' delta:    [seq][mask lsb][mask msb][zigzag varint delta per set bit]
+ * Values are in 1/100 mm.
+ */
+
+final int TELEMETRY_FRAME_SYNC = 0xA5;
+final int TELEMETRY_TYPE_KEYFRAME = 'K';
+final int TELEMETRY_TYPE_DELTA = 'D';
+final int TELEMETRY_NUM_FIELDS = 13;
+final float TELEMETRY_SCALE = 100.0;
+
+class TelemetryDecoder {
+  // parser states
+  static final int WAIT_SYNC = 0;
+  static final int READ_TYPE = 1;
+  static final int READ_LEN = 2;
+  static final int READ_PAYLOAD = 3;
+  static final int READ_CRC = 4;
+
+  int state = WAIT_SYNC;
+  int frameType = 0;
+  int frameLength = 0;
+  int payloadIndex = 0;
+  int[] payload = new int[256];
+
+  long[] values = new long[TELEMETRY_NUM_FIELDS]; // quantized state
+  boolean haveKeyframe = false;
+  boolean needKeyframe = false; // set when a frame was lost, caller should ask for one
+  int lastSeq = -1;
+  int framesDecoded = 0;
+  int framesDropped = 0;
+
+  String textLine = "";
+  String lastTextLine = null;
+
+  /**
+   * Feeds one byte. Returns true when a frame completed and the values changed.
+   */
+  boolean feed(int b) {
+    b &= 0xFF;
+    switch (state) {
+      case WAIT_SYNC:
+        if (b == TELEMETRY_FRAME_SYNC) {
+          state = READ_TYPE;
+        } else if (b == '\n') {
+          lastTextLine = textLine;
+          textLine = "";
+        } else if (textLine.length() < 256) {
+          textLine += (char) b;
+        }
+        return false;
+      case READ_TYPE:
+        frameType = b;
+        state = READ_LEN;
+        return false;
+      case READ_LEN:
+        frameLength = b;
+        payloadIndex = 0;
+        state = (frameLength > 0) ? READ_PAYLOAD : READ_CRC;
+        return false;
+      case READ_PAYLOAD:
+        payload[payloadIndex++] = b;
+        if (payloadIndex >= frameLength) {
+          state = READ_CRC;
+        }
+        return false;
+      case READ_CRC:
+        state = WAIT_SYNC;
+        if (b != frameCrc()) {
+          framesDropped++;
+          needKeyframe = true;
+          return false;
+        }
+        return applyFrame();
+    }
+    state = WAIT_SYNC;
+    return false;
+  }
+
+  /** Returns the completed text line since the last call, or null. */
+  String takeTextLine() {
+    String line = lastTextLine;
+    lastTextLine = null;
+    return line;
+  }
+
+  float value(int field) {
+    return values[field] / TELEMETRY_SCALE;
+  }
+
+  int frameCrc() {
+    int crc = crc8Step(0, frameType);
+    crc = crc8Step(crc, frameLength);
+    for (int i = 0; i < frameLength; i++) {
+      crc = crc8Step(crc, payload[i]);
+    }
+    return crc;
+  }
+
+  int crc8Step(int crc, int data) {
+    crc ^= data;
+    for (int bit = 0; bit < 8; bit++) {
+      crc = ((crc & 0x80) != 0) ? ((crc << 1) ^ 0x07) & 0xFF : (crc << 1) & 0xFF;
+    }
+    return crc;
+  }
+
+  boolean applyFrame() {
+    int seq = payload[0];
+    int[] index = { 1 };
+
+    if (frameType == TELEMETRY_TYPE_KEYFRAME) {
+      for (int i = 0; i < TELEMETRY_NUM_FIELDS; i++) {
+        values[i] = unzigzag(readVarint(index));
+      }
+      haveKeyframe = true;
+      needKeyframe = false;
+    } else if (frameType == TELEMETRY_TYPE_DELTA) {
+      // a delta only makes sense on top of the frame right before it
+      if (!haveKeyframe || seq != ((lastSeq + 1) & 0xFF)) {
+        // ask once, the periodic keyframe covers a lost request
+        needKeyframe = haveKeyframe;
+        haveKeyframe = false;
+        framesDropped++;
+        lastSeq = seq;
+        return false;
+      }
+      int mask = payload[1] | (payload[2] << 8);
+      index[0] = 3;
+      for (int i = 0; i < TELEMETRY_NUM_FIELDS; i++) {
+        if ((mask & (1 << i)) != 0) {
+          values[i] += unzigzag(readVarint(index));
+        }
+      }
+    } else {
+      return false; // not a telemetry frame
+    }
+    lastSeq = seq;
+    framesDecoded++;
+    return true;
+  }
+
+  long readVarint(int[] index) {
+    long result = 0;
+    int shift = 0;
+    while (index[0] < frameLength) {
+      int b = payload[index[0]++];
+      result |= ((long) (b & 0x7F)) << shift;
+      if ((b & 0x80) == 0) {
+        break;
+      }
+      shift += 7;
+    }
+    return result;
+  }
+
+  long unzigzag(long n) {
+    return (n >>> 1) ^ -(n & 1);
+  }
+}
@@ -17,6 +17,10 @@
 #include "haplink_encoders.h"
 
 #include "delta_thumb.h"
+#include "hand_limbs.h"
+#include "hand_servo.h"
+#include "hand_host_models.h"
+#include "hand_motion.h"
 #include "hand_virtual_environment.h"
 #include "main.h"
 #include "mbed.h"
@@ -28,15 +32,152 @@
 #include "haplink_motors.h"
 #include "haplink_fsr.h"
 #include "haplink_time.h"
+#include "haplink_telemetry.h"
+#include "haplink_telemetry_streams.h"
+#include "haplink_receive.h"
+#include "haplink_adc_sensors.h"
+#include "haplink_ascii_format.h"
+#include <stdarg.h>
+#include <string.h>
 
 RawSerial pc(USBTX, USBRX);
 
 //communication variables:
 uint8_t receivechar;
-int receivedMessage = 0;
-uint8_t communicationBuf[20];
-uint8_t sendBuffer[10];
-uint8_t messagesize = 0;
+//every message, text or binary, goes through the receive queue (haplink_receive.h)
+#if TELEOP_HAND_MAX_FRAME_SIZE > RX_MESSAGE_SIZE
+#error "RX_MESSAGE_SIZE (haplink_receive.h) must hold the hand teleoperation frame"
+#endif
+#ifdef DOF_2
+#define TELEOP_TEXT_LENGTH  6       // 'p', two values of two digits, the terminating character
+#else
+#define TELEOP_TEXT_LENGTH  4       // 'p', two digits, the terminating character
+#endif
+uint8_t sendBuffer[TELEOP_HAND_MAX_FRAME_SIZE];
+uint8_t telemetryBuffer[TELEMETRY_MAX_FRAME_SIZE];
+
+//transmit ring buffer, filled by the main loop and drained by the TX interrupt
+//so prints never stall the haptic loop while the UART shifts bytes out.
+#define TX_RING_SIZE        512     // must be a power of two
+#define TX_PRINTF_MAX       160     // longest formatted message
+uint8_t txRing[TX_RING_SIZE];
+volatile uint16_t txHead = 0;       // only written by the main loop
+volatile uint16_t txTail = 0;       // only written by the TX interrupt
+volatile uint8_t txActive = 0;
+uint32_t txBytesQueued = 0;
+
+
+/*******************************************************************************
+  * @name   transmitCallback
+  * @brief  TX interrupt, moves bytes from the ring to the UART and turns
+            itself off once the ring is empty.
+  * @param  none.
+  * @retval none.
+  */
+static void transmitCallback( void )
+{
+    while (pc.writeable() && (txTail != txHead))
+    {
+        pc.putc(txRing[txTail]);
+        txTail = (txTail + 1) & (TX_RING_SIZE - 1);
+    }
+    if (txTail == txHead)
+    {
+        pc.attach(NULL, SerialBase::TxIrq);
+        txActive = 0;
+    }
+}
+
+/*******************************************************************************
+  * @name   startTransmit
+  * @brief  enables the TX interrupt if it is not already draining the ring.
+  * @param  none.
+  * @retval none.
+  */
+static void startTransmit( void )
+{
+    __disable_irq();
+    if (txActive == 0)
+    {
+        txActive = 1;
+        pc.attach(&transmitCallback, SerialBase::TxIrq);
+    }
+    __enable_irq();
+}
+
+/*******************************************************************************
+  * @name   txFreeSpace
+  * @brief  number of bytes that can be queued without waiting.
+  * @param  none.
+  * @retval free bytes in the transmit ring.
+  */
+int txFreeSpace( void )
+{
+    return (TX_RING_SIZE - 1) - ((txHead - txTail) & (TX_RING_SIZE - 1));
+}
+
+/*******************************************************************************
+  * @name   sendBlock
+  * @brief  queues a binary buffer for transmission. Only waits if the ring is
+            full, which the telemetry scheduler avoids by checking txFreeSpace.
+  * @param  buffer: bytes to send.
+  * @param  length: number of bytes.
+  * @retval none.
+  */
+static void sendBlock( const uint8_t * buffer, int length )
+{
+    int i;
+    for (i = 0; i < length; i++)
+    {
+        while (txFreeSpace() == 0)
+        {
+            startTransmit(); //make sure someone is draining it
+        }
+        txRing[txHead] = buffer[i];
+        txHead = (txHead + 1) & (TX_RING_SIZE - 1);
+    }
+    txBytesQueued = txBytesQueued + length;
+    startTransmit();
+}
+
+/*******************************************************************************
+  * @name   txPrintf
+  * @brief  printf into the transmit ring.
+  * @param  format and arguments as in printf.
+  * @retval none.
+  */
+static void txPrintf( const char * format, ... )
+{
+    char buffer[TX_PRINTF_MAX];
+    int length;
+    va_list args;
+
+    va_start(args, format);
+    length = vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length > (int)sizeof(buffer) - 1)
+    {
+        length = sizeof(buffer) - 1;
+    }
+    if (length > 0)
+    {
+        sendBlock((const uint8_t *)buffer, length);
+    }
+}
+
+/*******************************************************************************
+  * @name   sendLine
+  * @brief  queues a line built with the append functions (haplink_ascii_format.h).
+            The periodic prints use these instead of txPrintf, newlib's float
+            printf is by far the slowest part of a print.
+  * @param  line: start of the line buffer.
+  * @param  end: cursor returned by the last append.
+  * @retval none.
+  */
+static void sendLine( const char * line, const char * end )
+{
+    sendBlock((const uint8_t *)line, end - line);
+}
 
 
 /*-- Functions to communicate with processing and render graphics, 
@@ -57,7 +198,14 @@ void printProcessingComm1DOF( double parameter )
     {
         clearMessageAcknowledged();
         clearDataHasBeenRequested();
-        pc.printf("%f\t%f\t l",(float)getXH(), (float)(parameter));
+        char line[TX_PRINTF_MAX];
+        char * cursor = line;
+        const char * const end = line + sizeof(line);
+        cursor = appendFloat(cursor, end, (float)getXH(), 6);
+        cursor = appendChar(cursor, end, '\t');
+        cursor = appendFloat(cursor, end, (float)(parameter), 6);
+        cursor = appendString(cursor, end, "\t l");
+        sendLine(line, cursor);
          //only for debugging:
          //pc.printf("got message \n");
          //if you did not want to send a parameter for example:
@@ -78,7 +226,18 @@ void printProcessingComm2DOF( double parameter )
     {
         clearMessageAcknowledged();
         clearDataHasBeenRequested();
-         pc.printf("%f\t%f\t%f\t%f\t%f\t l", (float)getRx(), (float)getRy(), (float)getProxyX(), (float)getProxyY(), (float)parameter);
+         float values[5] = {(float)getRx(), (float)getRy(), (float)getProxyX(), (float)getProxyY(), (float)parameter};
+         char line[TX_PRINTF_MAX];
+         char * cursor = line;
+         const char * const end = line + sizeof(line);
+         int i;
+         for (i = 0; i < 5; i++)
+         {
+             cursor = appendFloat(cursor, end, values[i], 6);
+             cursor = appendChar(cursor, end, '\t');
+         }
+         cursor = appendString(cursor, end, " l");
+         sendLine(line, cursor);
          ////pc.printf("%f\t%f\t l", (float)getRx(), (float)getRy());
     }
 }
@@ -98,7 +257,7 @@ void printProcessingCommFinger1(void)
     {
         clearMessageAcknowledged();
         clearDataHasBeenRequested();
-         pc.printf("%f\t%f\t", getXf1_global(), getYf1_global());
+         txPrintf("%f\t%f\t", getXf1_global(), getYf1_global());
          ////pc.printf("%f\t%f\t l", (float)getRx(), (float)getRy());
     }
 }
@@ -117,7 +276,7 @@ void printProcessingCommFinger2(void)
     {
         clearMessageAcknowledged();
         clearDataHasBeenRequested();
-         pc.printf("%f\t%f\t", getXf2_global(), getYf2_global());
+         txPrintf("%f\t%f\t", getXf2_global(), getYf2_global());
          ////pc.printf("%f\t%f\t l", (float)getRx(), (float)getRy());
     }
 }
@@ -127,28 +286,36 @@ void printProcessingCommFinger2(void)
 /*******************************************************************************
   * @name   printTeleoperationComm
   * @brief  this is just an example function to send to show the communication structure for teleoperation.
-            this function assumes that all you want to send is the position of the handle or cursor
+            this function assumes that all you want to send is the position of the handle or cursor.
+            With TELEOPERATION_HAND_FRAME (main.h) the whole hand is sent as a binary frame every
+            time the stream is due, the rate is set by the telemetry scheduler.
   * @param  none.
   * @retval none.
   */
 void printTeleoperationComm( void )
 {
+    #ifdef TELEOPERATION_HAND_FRAME
+        int length = get_hand_packed( sendBuffer, TELEOPERATION_HAND_FRAME );
+        sendBlock(sendBuffer, length);
+        clearTeleOperationHasBeenRequested();
+    #else
     if (returnTeleOperationHasBeenRequested() > 0)
     {
                 //Communication for teleoperation:
                 #ifdef DOF_1 //teleoperation in 1-DOF
                     get_xH_packed( sendBuffer );
                     //writeBlock(sendBuffer,4) ;
-                    pc.printf("%c%c%c%c",sendBuffer[0],sendBuffer[1],sendBuffer[2],sendBuffer[3]);
+                    sendBlock(sendBuffer, 4);
                 
                 #else //teleoperation in 2-DOF
                     get_rx_ry_packed( sendBuffer );
                     //serial.writeBlock(sendBuffer,6) ;
-                    pc.printf("%c%c%c%c%c%c",sendBuffer[0],sendBuffer[1],sendBuffer[2],sendBuffer[3], sendBuffer[4], sendBuffer[5]);
+                    sendBlock(sendBuffer, 6);
                 #endif
                 
                 clearTeleOperationHasBeenRequested();
     }
+    #endif
 }
 
 
@@ -160,22 +327,37 @@ frequently, your device may not work at all.-- */
 
 void debugprintFingerMotorCounts()
 {
-    pc.printf("Motor 4 Encoder Counts: %i\n", getCountsSensor4());
-    pc.printf("Motor 5 Encoder Counts: %i\n", getCountsSensor5());
-    pc.printf("Motor 6 Encoder Counts: %i\n", getCountsSensor6());
-    pc.printf("Motor 7 Encoder Counts: %i\n", getCountsSensor7());
+    txPrintf("Motor 4 Encoder Counts: %i\n", getCountsSensor4());
+    txPrintf("Motor 5 Encoder Counts: %i\n", getCountsSensor5());
+    txPrintf("Motor 6 Encoder Counts: %i\n", getCountsSensor6());
+    txPrintf("Motor 7 Encoder Counts: %i\n", getCountsSensor7());
 }
 
 void printDebugDeltaThumb( void )
 {
-    pc.printf("xH=%lf, dXh=%lf, ForceH=%lf, Torque=%lf\r\n", getXH(), getDxH(), getForceH(), getTorqueMotor1());
+    txPrintf("xH=%lf, dXh=%lf, ForceH=%lf, Torque=%lf\r\n", getXH(), getDxH(), getForceH(), getTorqueMotor1());
 }
 
 void printProcessingHapticHand( void )
 {
     // pc.printf("%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t l", (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, getThumbX(), getThumbY(), getThumbZ(), (float)0.0, (float)0.0, (float)0.0, (float)0.0);
     // pc.printf("%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t l", (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0, (float)0.0);
-    pc.printf("%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t%.2f\t \n", (float)deltaThumbX, getThumbY(), getThumbZ(), (float)getXf1_global(), (float)getYf1_global(), (float)NORMAL_ZF1, (float)getXf2_global(), (float)getYf2_global(), (float)NORMAL_ZF2, (float)getSphereX(), (float)getSphereY(), (float)getSphereZ(), (float)getSphereRadius());
+    HandTelemetry hand;
+    getHandTelemetry(&hand);
+    float values[13] = {(float)hand.thumb[0], (float)hand.thumb[1], (float)hand.thumb[2], (float)hand.limbs.x[HAND_FINGER_1], (float)hand.limbs.y[HAND_FINGER_1], (float)NORMAL_ZF1, (float)hand.limbs.x[HAND_FINGER_2], (float)hand.limbs.y[HAND_FINGER_2], (float)NORMAL_ZF2, (float)hand.sphere[0], (float)hand.sphere[1], (float)hand.sphere[2], (float)hand.sphere[3]};
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    int i;
+
+    // same bytes as printf("%.2f\t" x 13 " \n")
+    for (i = 0; i < 13; i++)
+    {
+        cursor = appendFloat(cursor, end, values[i], 2);
+        cursor = appendChar(cursor, end, '\t');
+    }
+    cursor = appendString(cursor, end, " \n");
+    sendLine(line, cursor);
     // if ((returnMessageAcknowledged() > 0) && (returnDataHasBeenRequested() > 0))
     // {
     //     clearMessageAcknowledged();
@@ -187,139 +369,429 @@ void printProcessingHapticHand( void )
     
 }
 
+/*******************************************************************************
+  * @name   printProcessingHapticHandDelta
+  * @brief  sends the same 13 values as printProcessingHapticHand but as a
+            delta-encoded binary frame (see haplink_telemetry.h). Fields that
+            did not change since the previous frame are not sent at all.
+  * @param  none.
+  * @retval none.
+  */
+void printProcessingHapticHandDelta( void )
+{
+    float fields[TELEMETRY_NUM_FIELDS];
+    HandTelemetry hand;
+    int length;
+
+    getHandTelemetry(&hand);
+    fields[TELEMETRY_FIELD_THUMB_X] = (float)hand.thumb[0];
+    fields[TELEMETRY_FIELD_THUMB_Y] = (float)hand.thumb[1];
+    fields[TELEMETRY_FIELD_THUMB_Z] = (float)hand.thumb[2];
+    fields[TELEMETRY_FIELD_F1_X] = (float)hand.limbs.x[HAND_FINGER_1];
+    fields[TELEMETRY_FIELD_F1_Y] = (float)hand.limbs.y[HAND_FINGER_1];
+    fields[TELEMETRY_FIELD_F1_Z] = (float)NORMAL_ZF1;
+    fields[TELEMETRY_FIELD_F2_X] = (float)hand.limbs.x[HAND_FINGER_2];
+    fields[TELEMETRY_FIELD_F2_Y] = (float)hand.limbs.y[HAND_FINGER_2];
+    fields[TELEMETRY_FIELD_F2_Z] = (float)NORMAL_ZF2;
+    fields[TELEMETRY_FIELD_SPHERE_X] = (float)hand.sphere[0];
+    fields[TELEMETRY_FIELD_SPHERE_Y] = (float)hand.sphere[1];
+    fields[TELEMETRY_FIELD_SPHERE_Z] = (float)hand.sphere[2];
+    fields[TELEMETRY_FIELD_SPHERE_R] = (float)hand.sphere[3];
+
+    length = packTelemetryFrame(fields, telemetryBuffer);
+    sendBlock(telemetryBuffer, length);
+}
+
+/*******************************************************************************
+  * @name   printPingReply
+  * @brief  answers a ping ('g' message) right away, ahead of the telemetry
+            streams. The transmit time is taken when the reply is queued, so
+            time spent waiting in the transmit ring counts as downlink latency,
+            which is what the host actually sees.
+  * @param  none.
+  * @retval none.
+  */
+void printPingReply( void )
+{
+    uint8_t frame[TELEMETRY_PING_REPLY_SIZE];
+    int length;
+
+    length = packPingReplyFrame(getPingHostStamp(), (uint32_t)(uint64_t)getPingReceivedTime_us(),
+                                getTime32_us(), frame);
+    sendBlock(frame, length);
+}
+
+void printDebugTorques( void )
+{
+    static const int motors[7] = {MOTOR_1, MOTOR_2, MOTOR_3, MOTOR_4, MOTOR_5, MOTOR_6, MOTOR_7};
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    HandTelemetry hand;
+    int i;
+
+    getHandTelemetry(&hand);
+
+    // "T1 = %lf, T2 = %lf, ... T7 = %lf Nm\n"
+    for (i = 0; i < 7; i++)
+    {
+        cursor = appendString(cursor, end, (i == 0) ? "T" : ", T");
+        cursor = appendChar(cursor, end, (char)('1' + i));
+        cursor = appendString(cursor, end, " = ");
+        cursor = appendDouble(cursor, end, getHandTelemetryTorque(&hand, motors[i]), 6);
+    }
+    cursor = appendString(cursor, end, " Nm\n");
+    sendLine(line, cursor);
+}
+
+void printDebugFSR( void )
+{
+    char line[32];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    cursor = appendString(cursor, end, "FSR1=");
+    cursor = appendUnsigned(cursor, end, queryFSR1value());
+    cursor = appendString(cursor, end, ", FSR2=");
+    cursor = appendUnsigned(cursor, end, queryFSR2value());
+    cursor = appendChar(cursor, end, '\n');
+    sendLine(line, cursor);
+}
+
+void printDebugTiming( void )
+{
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    double jacobiansAvg;
+    uint32_t jacobiansMax;
+    HandTelemetry hand;
+    takeJacobianEvals(&jacobiansAvg, &jacobiansMax);
+    getHandTelemetry(&hand);
+    cursor = appendString(cursor, end, "loop min = ");
+    cursor = appendDouble(cursor, end, getLoopPeriodMinUs(), 1);
+    cursor = appendString(cursor, end, " us, avg = ");
+    cursor = appendDouble(cursor, end, getLoopPeriodAvgUs(), 1);
+    cursor = appendString(cursor, end, " us, max = ");
+    cursor = appendDouble(cursor, end, getLoopPeriodMaxUs(), 1);
+    cursor = appendString(cursor, end, " us, jacobians/tick avg = ");
+    cursor = appendDouble(cursor, end, jacobiansAvg, 2);
+    cursor = appendString(cursor, end, ", max = ");
+    cursor = appendUnsigned(cursor, end, jacobiansMax);
+#ifdef HAND_SERVO_RATE_HZ
+    cursor = appendString(cursor, end, ", servo max = ");
+    cursor = appendDouble(cursor, end, hand.servoTickMaxUs, 1);
+    cursor = appendString(cursor, end, " us");
+#endif
+    cursor = appendChar(cursor, end, '\n');
+    sendLine(line, cursor);
+    clearLoopPeriodStats();
+}
+
+void printDebugPassivity( void )
+{
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    HandTelemetry hand;
+    getHandTelemetry(&hand);
+    // thumb, then every limb: observed / dissipated mJ, damping N s/m
+    cursor = appendString(cursor, end, "passivity E/out mJ, b N s/m: thumb ");
+    for (int point = 0; point < 1 + HAND_LIMB_COUNT; point++)
+    {
+        if (point > 0)
+        {
+            cursor = appendString(cursor, end, ", f");
+            cursor = appendUnsigned(cursor, end, point);
+            cursor = appendChar(cursor, end, ' ');
+        }
+        cursor = appendDouble(cursor, end, hand.passivityEnergy[point], 3);
+        cursor = appendChar(cursor, end, '/');
+        cursor = appendDouble(cursor, end, hand.passivityDissipated[point], 2);
+        cursor = appendChar(cursor, end, ' ');
+        cursor = appendDouble(cursor, end, hand.passivityDamping[point], 2);
+    }
+    cursor = appendChar(cursor, end, '\n');
+    sendLine(line, cursor);
+}
+
 void printDebug1DOFAllParameters( void )
 {
-    pc.printf("t=%lf, FSR1=%u, FSR2=%u, xH=%lf, dXh=%lf, ForceH=%lf, Torque=%lf\r\n",getTime_ms(), queryFSR1value(), queryFSR2value(), getXH(), getDxH(), getForceH(), getTorqueMotor1());
+    txPrintf("t=%lf, FSR1=%u, FSR2=%u, xH=%lf, dXh=%lf, ForceH=%lf, Torque=%lf\r\n",getTime_ms(), queryFSR1value(), queryFSR2value(), getXH(), getDxH(), getForceH(), getTorqueMotor1());
 }
 
 void printDebug2DOFAllParameters( void )
 {
-    pc.printf("Rx: %lf, Ry: %lf, ThetaA: %lf, ThetaB: %lf, ProxyX: %lf, ProxyY: %lf \n", getRx(), getRy(), getThetaADeg(), getThetaBDeg(),getProxyX(),getProxyY());
+    txPrintf("Rx: %lf, Ry: %lf, ThetaA: %lf, ThetaB: %lf, ProxyX: %lf, ProxyY: %lf \n", getRx(), getRy(), getThetaADeg(), getThetaBDeg(),getProxyX(),getProxyY());
 }
 
 void printDebugFinger1Parameters( void )
 {
-    pc.printf("rx = %lf, ry = %lf, Torque M4 = %lf Nm, Torque M5 = %lf Nm, theta_a_deg = %lf, theta_b_deg = %lf \n", getRx1(), getRy1(), getTorqueMotor4(), getTorqueMotor5(), getThetaA1_deg(), getThetaB1_deg());
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    HandTelemetry hand;
+    getHandTelemetry(&hand);
+    cursor = appendString(cursor, end, "rx = ");
+    cursor = appendDouble(cursor, end, hand.limbs.rx[HAND_FINGER_1], 6);
+    cursor = appendString(cursor, end, ", ry = ");
+    cursor = appendDouble(cursor, end, hand.limbs.ry[HAND_FINGER_1], 6);
+    cursor = appendString(cursor, end, ", Torque M4 = ");
+    cursor = appendDouble(cursor, end, hand.limbs.torqueA[HAND_FINGER_1], 6);
+    cursor = appendString(cursor, end, " Nm, Torque M5 = ");
+    cursor = appendDouble(cursor, end, hand.limbs.torqueB[HAND_FINGER_1], 6);
+    cursor = appendString(cursor, end, " Nm, theta_a_deg = ");
+    cursor = appendDouble(cursor, end, hand.limbs.thetaA[HAND_FINGER_1]*180/3.1416, 6);
+    cursor = appendString(cursor, end, ", theta_b_deg = ");
+    cursor = appendDouble(cursor, end, hand.limbs.thetaB[HAND_FINGER_1]*180/3.1416, 6);
+    cursor = appendString(cursor, end, " \n");
+    sendLine(line, cursor);
 }
 void printDebugFinger2Parameters( void )
 {
-    pc.printf("rx = %lf, ry = %lf, Torque M6 = %lf Nm, Torque M7 = %lf Nm, theta_a_deg = %lf, theta_b_deg = %lf \n", getRx2(), getRy2(), getTorqueMotor6(), getTorqueMotor7(), getThetaA2_deg(), getThetaB2_deg());
+    char line[TX_PRINTF_MAX];
+    char * cursor = line;
+    const char * const end = line + sizeof(line);
+    HandTelemetry hand;
+    getHandTelemetry(&hand);
+    cursor = appendString(cursor, end, "rx = ");
+    cursor = appendDouble(cursor, end, hand.limbs.rx[HAND_FINGER_2], 6);
+    cursor = appendString(cursor, end, ", ry = ");
+    cursor = appendDouble(cursor, end, hand.limbs.ry[HAND_FINGER_2], 6);
+    cursor = appendString(cursor, end, ", Torque M6 = ");
+    cursor = appendDouble(cursor, end, hand.limbs.torqueA[HAND_FINGER_2], 6);
+    cursor = appendString(cursor, end, " Nm, Torque M7 = ");
+    cursor = appendDouble(cursor, end, hand.limbs.torqueB[HAND_FINGER_2], 6);
+    cursor = appendString(cursor, end, " Nm, theta_a_deg = ");
+    cursor = appendDouble(cursor, end, hand.limbs.thetaA[HAND_FINGER_2]*180/3.1416, 6);
+    cursor = appendString(cursor, end, ", theta_b_deg = ");
+    cursor = appendDouble(cursor, end, hand.limbs.thetaB[HAND_FINGER_2]*180/3.1416, 6);
+    cursor = appendString(cursor, end, " \n");
+    sendLine(line, cursor);
 }
 
 void printComBuffer( void )
 {
-
-    pc.printf("message: %u , %u \n", communicationBuf[0], communicationBuf[1]);
-
+    RxMessage * message = receivePeek();
+    if (message != NULL)
+    {
+        txPrintf("message: %u , %u \n", message->data[0], message->data[1]);
+    }
 }
 
 void debugprint(uint16_t number)
 {
-    pc.printf("Got to %u\n",number);    
+    txPrintf("Got to %u\n",number);    
 }
 
 void debugprintHelloWorld( void )
 {
-    pc.printf("Hello! Haptics to see you! \n");
+    txPrintf("Hello! Haptics to see you! \n");
 } 
 
 void debugprint2byteValue(uint16_t number)
 {
-    pc.printf("Value = %u\n",number);    
+    txPrintf("Value = %u\n",number);    
 }
 
 void debugprintRegister( uint32_t registerval)
 {
-    pc.printf("Register Value %u\n", registerval);
+    txPrintf("Register Value %u\n", registerval);
 }
 
 void debugprintEncoderCounts( int32_t encodercounts)
 {
-    pc.printf("Encoder Counts %i\n", encodercounts);
+    txPrintf("Encoder Counts %i\n", encodercounts);
 }
 
 void debugprintDouble( double number)
 {
-    pc.printf("double number %lf\n", number);
+    txPrintf("double number %lf\n", number);
 }
 
 void debugprintStarterCode( void )
 {
-    pc.printf("Dear Math, please grow up and solve your own problems.\n");
+    txPrintf("Dear Math, please grow up and solve your own problems.\n");
 }
 
 void debugprinttruesusb( void )
 {
-    pc.printf("l");
+    txPrintf("l");
+}
+
+
+/*-- Telemetry streams, see haplink_telemetry_streams.h. Each one returns the
+number of bytes it queued so the scheduler can learn the message sizes.--*/
+static int streamHandPose( void )
+{
+    uint32_t before = txBytesQueued;
+    #ifdef TELEMETRY_DELTA_ENCODING
+        printProcessingHapticHandDelta();
+    #else
+        printProcessingHapticHand();
+    #endif
+    return txBytesQueued - before;
+}
+
+static int streamFingerDebug( void )
+{
+    uint32_t before = txBytesQueued;
+    printDebugFinger1Parameters();
+    printDebugFinger2Parameters();
+    return txBytesQueued - before;
+}
+
+static int streamTorques( void )
+{
+    uint32_t before = txBytesQueued;
+    printDebugTorques();
+    return txBytesQueued - before;
+}
+
+static int streamFSR( void )
+{
+    uint32_t before = txBytesQueued;
+    printDebugFSR();
+    return txBytesQueued - before;
+}
+
+static int streamTiming( void )
+{
+    uint32_t before = txBytesQueued;
+    printDebugTiming();
+    return txBytesQueued - before;
+}
+
+static int streamPassivity( void )
+{
+    uint32_t before = txBytesQueued;
+    printDebugPassivity();
+    return txBytesQueued - before;
+}
+
+static int streamTeleoperation( void )
+{
+    uint32_t before = txBytesQueued;
+    printTeleoperationComm();
+    return txBytesQueued - before;
+}
+
+/*******************************************************************************
+  * @name   initTelemetry
+  * @brief  registers all the streams. The COMM_ defines in main.h choose which
+            ones are on at startup, the rest can be turned on at runtime with
+            the 'r' message.
+  * @param  none.
+  * @retval none.
+  */
+static void initTelemetry( void )
+{
+    uint16_t handPoseRate = 0;
+    uint16_t debugRate = 0;
+    uint16_t teleoperationRate = 0;
+
+    #ifdef COMM_PROCESSING
+        #ifdef TELEMETRY_DELTA_ENCODING
+            handPoseRate = 100;
+        #else
+            handPoseRate = 30;
+        #endif
+    #endif
+    #ifdef COMM_DEBUGGING
+        debugRate = 2;
+    #endif
+    #ifdef COMM_TELEOPERATION
+        teleoperationRate = 1000;
+    #endif
+
+    initHaplinkTelemetry();
+    initTelemetryStreams();
+    //                      stream                name         function             rate Hz            priority  bytes
+    registerTelemetryStream(STREAM_TELEOPERATION, "teleop",    streamTeleoperation, teleoperationRate, 5,        TELEOP_HAND_MAX_FRAME_SIZE);
+    registerTelemetryStream(STREAM_HAND_POSE,     "hand",      streamHandPose,      handPoseRate,      4,        32);
+    registerTelemetryStream(STREAM_FINGER_DEBUG,  "fingers",   streamFingerDebug,   debugRate,         2,        200);
+    registerTelemetryStream(STREAM_TORQUES,       "torques",   streamTorques,       debugRate,         2,        120);
+    registerTelemetryStream(STREAM_FSR,           "fsr",       streamFSR,           0,                 1,        20);
+    registerTelemetryStream(STREAM_TIMING,        "timing",    streamTiming,        debugRate,         1,       100);
+    registerTelemetryStream(STREAM_PASSIVITY,     "passivity", streamPassivity,     debugRate,         1,       110);
+}
+
+/*******************************************************************************
+  * @name   manageTelemetryStreams
+  * @brief  call once per loop, sends whatever streams are due and fit in the
+            link (see serviceTelemetryStreams).
+  * @param  none.
+  * @retval none.
+  */
+void manageTelemetryStreams( void )
+{
+    serviceTelemetryStreams(getTime_us(), txFreeSpace());
 }
 
 
 /*--Functions to manage the two way communication with processing, do not change! --*/
+/*******************************************************************************
+  * @name   answerPing
+  * @brief  replies to a ping the last decodeMessage took, if any.
+  * @param  none.
+  * @retval none.
+  */
+static void answerPing( void )
+{
+    if (returnPingHasBeenRequested() > 0)
+    {
+        clearPingHasBeenRequested();
+        printPingReply();
+    }
+}
+
+/*******************************************************************************
+  * @name   manageIncommingMessage
+  * @brief  decodes every message in the receive queue, oldest first.
+  * @param  none.
+  * @retval none.
+  */
 void manageIncommingMessage( void )
 {
+    RxMessage * message;
     int response = 0;
-    response = decodeMessage( &communicationBuf[0] );
+    while ((message = receivePeek()) != NULL)
+    {
+        response = decodeMessage( message->data, message->received_us );
+        answerPing();
+        receiveRelease(); //the interrupt may receive into it again
+    }
     //Only if debugging
     //pc.printf("Message received is: %i \n", response);
 }
 
-
-//function that gets called to receive messages from the computer via USB
+//function that gets called to receive messages from the computer via USB.
+//It takes one byte per interrupt and never waits for the next one (text
+//messages, pings and binary frames alike), so it cannot hold off the servo
+//interrupt (TIM5, hand_servo.c) while the host is still sending. Whole
+//messages are queued (haplink_receive.h), the main loop never sees half of one.
 void receiveMessageCallback( void) 
 {
-    int i;
     // Note: you need to actually read from the serial to clear the RX interrupt
-    //pc.printf("%c\n", pc.getc());
-    
     receivechar = pc.getc();
-    i = 0;
-    if (receivechar == 'p') //receiving position from teleoperation
-    {
-        communicationBuf[0] = receivechar;
-        receivechar = pc.getc(); //get first digit
-        communicationBuf[1] = receivechar;
-        receivechar = pc.getc(); //get second digit
-        communicationBuf[2] = receivechar;
-        receivechar = pc.getc(); //get the terminating character
-        i = 3;
-        #ifdef DOF_2
-            communicationBuf[3] = receivechar;
-            receivechar = pc.getc(); //get the second digit 
-            communicationBuf[4] = receivechar;
-            receivechar = pc.getc(); //get the terminating character
-        #endif
-    }
-    else
-    {
-        while (receivechar != 'l')
-        {
-            communicationBuf[i] = receivechar;
-            receivechar = pc.getc();
-            i = i+1;
-        }
-        //printf("Received Message\n"); //don't print so soon, buffer is not ready.
-    }
-    //only uncomment when debugging with Arduino, for some reason HAVE to do the newline thing
-    //receivechar = pc.getc();
-    receivechar = '0';
-    receivedMessage = receivedMessage + 1;
-    messagesize = i;
+    receiveByte(receivechar);
 }
 
 int checkReceiveMessage( void )
 {
-    return receivedMessage;
+    return receiveCount();
 }
 
 void clearReceiveMessage( void )
 {
-    receivedMessage = 0;
+    //nothing to clear, manageIncommingMessage releases what it decodes
 }
 
 void initCommunication( void )
 {
     resetCommunicationVariables();
-    pc.baud(115200);
+    receiveInit(TELEOP_TEXT_LENGTH, &getTime_us); //stamps the first byte of each message
+    initTelemetry();
+    pc.baud(COMM_BAUD_RATE);
     pc.attach(&receiveMessageCallback);
 }
 //EOF
@@ -24,6 +24,12 @@ void printDebugDeltaThumb( void );
 void printDebugFinger1Parameters();
 void printDebugFinger2Parameters( void );
 void printProcessingHapticHand( void );
+void printProcessingHapticHandDelta( void );
+void printPingReply( void );
+void printDebugTorques( void );
+void printDebugFSR( void );
+void printDebugTiming( void );
+void printDebugPassivity( void );
 
 
 void printProcessingComm1DOF( double parameter );
@@ -57,6 +63,8 @@ void clearReceiveMessage( void );
 
 
 void manageIncommingMessage( void );
+void manageTelemetryStreams( void );
+int txFreeSpace( void );
 
 #ifdef __cplusplus
 }
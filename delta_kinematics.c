@@ -0,0 +1,718 @@
+/**
+  ******************************************************************************
+  * @file    delta_kinematics.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Delta thumb forward/inverse kinematics (DeltaZ, see delta_thumb.c
+  *          for the links) and its analytic Jacobian. The Jacobian from the
+  *          Ohio DeltaKin paper is kept for DeltaThumbGetJacobian_OhioVersion.
+  *          The sin/cos of the motor angles are the expensive part of both,
+  *          deltaKinematicsForwardJacobian evaluates them once and shares
+  *          them between the position and the Jacobian.
+  *          deltaKinematicsForwardNewton is the warm-started alternative to
+  *          the closed form (tools/bench_delta_newton.c).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "delta_kinematics.h"
+#include <math.h>
+
+/* Constants -----------------------------------------------------------------*/
+#define SQRT3   DELTA_SQRT3
+#define TAN30   DELTA_TAN30
+#define TAN60   DELTA_SQRT3
+#define SIN30   0.5
+#define SIN120  DELTA_SIN_N2
+#define COS120  DELTA_COS_N2
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   forwardFromTrig
+  * @brief  DeltaZ closed form forward kinematics from the cos and sin of the
+  *         three motor angles.
+  * @param  c1..s3: cos and sin of theta1, theta2, theta3.
+  * @param  x0, y0, z0: end effector position in the delta_calcForward frame.
+  * @retval 0 if ok, -1 if the point does not exist.
+  */
+static int forwardFromTrig( double c1, double s1, double c2, double s2, double c3, double s3,
+                            double *x0, double *y0, double *z0 )
+{
+    const double t = (DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS) * TAN30 / 2;
+    const double rf = DELTA_LOWER_LINK_LEN;
+    const double re = DELTA_UPPER_LINK_LEN;
+
+    double y1 = -(t + rf * c1);
+    double z1 = -rf * s1;
+
+    double y2 = (t + rf * c2) * SIN30;
+    double x2 = y2 * TAN60;
+    double z2 = -rf * s2;
+
+    double y3 = (t + rf * c3) * SIN30;
+    double x3 = -y3 * TAN60;
+    double z3 = -rf * s3;
+
+    double dnm = (y2 - y1) * x3 - (y3 - y1) * x2;
+
+    double w1 = y1 * y1 + z1 * z1;
+    double w2 = x2 * x2 + y2 * y2 + z2 * z2;
+    double w3 = x3 * x3 + y3 * y3 + z3 * z3;
+
+    // x = (a1*z + b1)/dnm
+    double a1 = (z2 - z1) * (y3 - y1) - (z3 - z1) * (y2 - y1);
+    double b1 = -((w2 - w1) * (y3 - y1) - (w3 - w1) * (y2 - y1)) / 2.0;
+
+    // y = (a2*z + b2)/dnm;
+    double a2 = -(z2 - z1) * x3 + (z3 - z1) * x2;
+    double b2 = ((w2 - w1) * x3 - (w3 - w1) * x2) / 2.0;
+
+    // a*z^2 + b*z + c = 0
+    double a = a1 * a1 + a2 * a2 + dnm * dnm;
+    double b = 2 * (a1 * b1 + a2 * (b2 - y1 * dnm) - z1 * dnm * dnm);
+    double c = (b2 - y1 * dnm) * (b2 - y1 * dnm) + b1 * b1 + dnm * dnm * (z1 * z1 - re * re);
+
+    // discriminant
+    double d = b * b - 4.0 * a * c;
+    if (d < 0) return -1; // non-existing point
+
+    *z0 = -0.5 * (b + sqrt(d)) / a;
+    *x0 = (a1 * *z0 + b1) / dnm;
+    *y0 = (a2 * *z0 + b2) / dnm;
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   jacobianOhioFromTrig
+  * @brief  Jacobian from DeltaKin.pdf (page 15), force to motor torque.
+  * @param  x, y, z: end effector position in the thumb frame.
+  * @param  c1..s3: cos and sin of theta1, theta2, theta3.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j.
+  * @retval None.
+  */
+static void jacobianOhioFromTrig( double x, double y, double z,
+                                  double c1, double s1, double c2, double s2, double c3, double s3,
+                                  double J[3][3] )
+{
+    const double a = DELTA_WB - DELTA_UP;
+    const double b = DELTA_SP / 2 - (SQRT3 / 2) * DELTA_WB;
+    const double c = DELTA_WP - DELTA_WB / 2;
+    const double L = DELTA_UPPER_LINK_LEN;
+
+    double J1x = x;
+    double J1y = y + a + L * c1;
+    double J1z = z + L * s1;
+
+    double J2x = 2 * (x + b) - SQRT3 * L * c2;
+    double J2y = 2 * (y + c) - L * c2;
+    double J2z = 2 * (z + L * s2);
+
+    double J3x = 2 * (x - b) + SQRT3 * L * c3;
+    double J3y = 2 * (y + c) - L * c3;
+    double J3z = 2 * (z + L * s3);
+
+    double Jqa = L * ((y + a) * s1 - z * c1);
+    double Jqb = -L * ((SQRT3 * (x + b) + y + c) * s2 + 2 * z * c2);
+    double Jqc = L * ((SQRT3 * (x - b) - y - c) * s3 - 2 * z * c3);
+
+    // cofactors of the constraint matrix, shared by the determinant
+    double C11 = J2y * J3z - J3y * J2z;
+    double C12 = -(J2x * J3z - J3x * J2z);
+    double C13 = J2x * J3y - J3x * J2y;
+    double invDet = 1.0 / (J1x * C11 + J1y * C12 + J1z * C13);
+    double qa = Jqa * invDet;
+    double qb = Jqb * invDet;
+    double qc = Jqc * invDet;
+
+    J[0][0] = qa * C11;
+    J[0][1] = qa * C12;
+    J[0][2] = qa * C13;
+    J[1][0] = -qb * (J1y * J3z - J3y * J1z);
+    J[1][1] = qb * (J1x * J3z - J3x * J1z);
+    J[1][2] = -qb * (J1x * J3y - J3x * J1y);
+    J[2][0] = qc * (J1y * J2z - J2y * J1z);
+    J[2][1] = -qc * (J1x * J2z - J2x * J1z);
+    J[2][2] = qc * (J1x * J2y - J2x * J1y);
+}
+
+/*******************************************************************************
+  * @name   elbowsFromTrig
+  * @brief  Elbows of the three arms moved in by the platform offset (the
+  *         sphere centers of forwardFromTrig), and their derivatives along
+  *         their own motor angle.
+  * @param  c1..s3: cos and sin of theta1, theta2, theta3.
+  * @param  E: elbow i in E[i], delta_calcForward frame.
+  * @param  dE: dE[i] = dE_i/dtheta_i.
+  * @retval None.
+  */
+static void elbowsFromTrig( double c1, double s1, double c2, double s2, double c3, double s3,
+                            double E[3][3], double dE[3][3] )
+{
+    const double t = (DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS) * TAN30 / 2;
+    const double rf = DELTA_LOWER_LINK_LEN;
+    double reach2 = (t + rf * c2) * SIN30;
+    double reach3 = (t + rf * c3) * SIN30;
+
+    E[0][0] = 0.0;
+    E[0][1] = -(t + rf * c1);
+    E[0][2] = -rf * s1;
+    E[1][0] = reach2 * TAN60;
+    E[1][1] = reach2;
+    E[1][2] = -rf * s2;
+    E[2][0] = -reach3 * TAN60;
+    E[2][1] = reach3;
+    E[2][2] = -rf * s3;
+
+    dE[0][0] = 0.0;
+    dE[0][1] = rf * s1;
+    dE[0][2] = -rf * c1;
+    dE[1][0] = -rf * s2 * SIN120;
+    dE[1][1] = -rf * s2 * SIN30;
+    dE[1][2] = -rf * c2;
+    dE[2][0] = rf * s3 * SIN120;
+    dE[2][1] = -rf * s3 * SIN30;
+    dE[2][2] = -rf * c3;
+}
+
+/*******************************************************************************
+  * @name   constraintCofactors
+  * @brief  Rows r_i = p - E_i of the sphere constraints and their cofactors.
+  * @param  x, y, z: end effector position in the delta_calcForward frame.
+  * @param  E: elbows moved in by the platform offset.
+  * @param  r: r[i] = p - E[i].
+  * @param  C: cofactors of r, r^-1 = C^T / det.
+  * @retval det of r.
+  */
+static double constraintCofactors( double x, double y, double z, const double E[3][3],
+                                   double r[3][3], double C[3][3] )
+{
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        r[i][0] = x - E[i][0];
+        r[i][1] = y - E[i][1];
+        r[i][2] = z - E[i][2];
+    }
+    C[0][0] = r[1][1] * r[2][2] - r[1][2] * r[2][1];
+    C[0][1] = r[1][2] * r[2][0] - r[1][0] * r[2][2];
+    C[0][2] = r[1][0] * r[2][1] - r[1][1] * r[2][0];
+    C[1][0] = r[2][1] * r[0][2] - r[2][2] * r[0][1];
+    C[1][1] = r[2][2] * r[0][0] - r[2][0] * r[0][2];
+    C[1][2] = r[2][0] * r[0][1] - r[2][1] * r[0][0];
+    C[2][0] = r[0][1] * r[1][2] - r[0][2] * r[1][1];
+    C[2][1] = r[0][2] * r[1][0] - r[0][0] * r[1][2];
+    C[2][2] = r[0][0] * r[1][1] - r[0][1] * r[1][0];
+    return r[0][0] * C[0][0] + r[0][1] * C[0][1] + r[0][2] * C[0][2];
+}
+
+/*******************************************************************************
+  * @name   jacobianFromConstraints
+  * @brief  Differentiating |p - E_i|^2 = re^2 gives A dp = G dtheta with
+  *         A = 2r and G = diag(2 r_i . dE_i/dtheta_i), so
+  *         dp_j/dtheta_i = C[i][j] * g_i / (2 det).
+  * @param  r, C, invDet: from constraintCofactors.
+  * @param  dE: derivative of elbow i along its own motor angle.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j.
+  * @retval None.
+  */
+static void jacobianFromConstraints( const double r[3][3], const double C[3][3], double invDet,
+                                     const double dE[3][3], double J[3][3] )
+{
+    double q;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        q = invDet * (r[i][0] * dE[i][0] + r[i][1] * dE[i][1] + r[i][2] * dE[i][2]);
+        J[i][0] = q * C[i][0];
+        J[i][1] = q * C[i][1];
+        J[i][2] = q * C[i][2];
+    }
+}
+
+/*******************************************************************************
+  * @name   jacobianFromTrig
+  * @brief  Analytic Jacobian at a known position (see jacobianFromConstraints).
+  * @param  x, y, z: end effector position in the delta_calcForward frame.
+  * @param  c1..s3: cos and sin of theta1, theta2, theta3.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j, delta_calcForward frame.
+  * @retval None.
+  */
+static void jacobianFromTrig( double x, double y, double z,
+                              double c1, double s1, double c2, double s2, double c3, double s3,
+                              double J[3][3] )
+{
+    double E[3][3], dE[3][3], r[3][3], C[3][3];
+
+    elbowsFromTrig(c1, s1, c2, s2, c3, s3, E, dE);
+    jacobianFromConstraints(r, C, 1.0 / constraintCofactors(x, y, z, E, r, C), dE, J);
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsForward
+  * @brief  Given angles, calculates x,y,z position of end effector.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  x0, y0, z0: end effector position in the delta_calcForward frame.
+  * @retval 0 if ok, -1 if the point does not exist.
+  */
+int deltaKinematicsForward( double theta1, double theta2, double theta3, double *x0, double *y0, double *z0 )
+{
+    return forwardFromTrig(cos(theta1), sin(theta1), cos(theta2), sin(theta2),
+                           cos(theta3), sin(theta3), x0, y0, z0);
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsAngleYZ
+  * @brief  Angle of the arm in the YZ plane for a target position.
+  * @param  x0, y0, z0: target, rotated into the arm's plane.
+  * @param  theta: motor angle.
+  * @retval 0 if ok, -1 if the point can not be reached.
+  */
+int deltaKinematicsAngleYZ( double x0, double y0, double z0, double *theta )
+{
+    const double rf = DELTA_LOWER_LINK_LEN;
+    const double re = DELTA_UPPER_LINK_LEN;
+    double y1 = -0.5 * TAN30 * DELTA_BASE_RADIUS; // f/2 * tg 30
+    y0 -= 0.5 * TAN30 * DELTA_END_EFFECTOR_RADIUS;  // shift center to edge
+    // z = a + b*y
+    double a = (x0 * x0 + y0 * y0 + z0 * z0 + rf * rf - re * re - y1 * y1) / (2 * z0);
+    double b = (y1 - y0) / z0;
+    // discriminant
+    double d = -(a + b * y1) * (a + b * y1) + rf * (b * b * rf + rf);
+    if (d < 0) return -1; // non-existing point
+    double yj = (y1 - a * b - sqrt(d)) / (b * b + 1); // choosing outer point
+    double zj = a + b * yj;
+    *theta = atan(-zj / (y1 - yj)) + ((yj > y1) ? PI : 0.0);
+    if ((*theta < -PI) || (*theta > PI))
+        return -1;
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsInverse
+  * @brief  Given x,y,z in the delta_calcForward frame, calculates the angles.
+  * @retval 0 if ok, negative if the point can not be reached.
+  */
+int deltaKinematicsInverse( double x0, double y0, double z0, double *theta1, double *theta2, double *theta3 )
+{
+    *theta1 = 0;
+    *theta2 = 0;
+    *theta3 = 0;
+    int stat1 = deltaKinematicsAngleYZ(x0, y0, z0, theta1);
+    int stat2 = deltaKinematicsAngleYZ(x0 * COS120 + y0 * SIN120, y0 * COS120 - x0 * SIN120, z0, theta2); // rotate coords to +120 deg
+    int stat3 = deltaKinematicsAngleYZ(x0 * COS120 - y0 * SIN120, y0 * COS120 + x0 * SIN120, z0, theta3); // rotate coords to -120 deg
+    return stat1 + stat2 + stat3;
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsJacobianOhio
+  * @brief  Jacobian from DeltaKin.pdf at a known position.
+  * @param  x, y, z: end effector position in the thumb frame.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j.
+  * @retval None.
+  */
+void deltaKinematicsJacobianOhio( double x, double y, double z,
+                                  double theta1, double theta2, double theta3, double J[3][3] )
+{
+    jacobianOhioFromTrig(x, y, z, cos(theta1), sin(theta1), cos(theta2), sin(theta2),
+                         cos(theta3), sin(theta3), J);
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsJacobian
+  * @brief  Analytic Jacobian for the delta_calcForward parameterization,
+  *         from differentiating the three sphere constraints: no acos, no
+  *         fmod and one division (by the determinant).
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  x0, y0, z0: deltaKinematicsForward of the same angles.
+  * @param  J: J[i][j] = dp_j/dtheta_i, so torque_i = sum over j of
+  *         J[i][j] * F_j in the delta_calcForward frame.
+  * @retval None.
+  */
+void deltaKinematicsJacobian( double theta1, double theta2, double theta3,
+                              double x0, double y0, double z0, double J[3][3] )
+{
+    jacobianFromTrig(x0, y0, z0, cos(theta1), sin(theta1), cos(theta2), sin(theta2),
+                     cos(theta3), sin(theta3), J);
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsToThumbFrame
+  * @brief  delta_calcForward frame to the thumb frame used by the virtual
+  *         environments: x and y swapped, origin DELTA_THUMB_Z_OFFSET lower.
+  * @param  position, J: position and Jacobian in the delta_calcForward frame.
+  * @param  thumb, JThumb: the same in the thumb frame, J may be NULL.
+  * @retval None.
+  */
+void deltaKinematicsToThumbFrame( const double position[3], const double J[3][3],
+                                  double thumb[3], double JThumb[3][3] )
+{
+    double x = position[0];
+    int i;
+
+    thumb[0] = position[1];
+    thumb[1] = x;
+    thumb[2] = position[2] + DELTA_THUMB_Z_OFFSET;
+    if ((J != 0) && (JThumb != 0))
+    {
+        for (i = 0; i < 3; i++)
+        {
+            double a = J[i][0];
+            JThumb[i][0] = J[i][1];
+            JThumb[i][1] = a;
+            JThumb[i][2] = J[i][2];
+        }
+    }
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsForwardJacobian
+  * @brief  Position and Jacobian in one pass: six trig calls instead of
+  *         twelve. Same as deltaKinematicsForward + deltaKinematicsJacobian.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  x0, y0, z0: end effector position in the delta_calcForward frame.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j, delta_calcForward
+  *         frame, left untouched if the point does not exist.
+  * @retval 0 if ok, -1 if the point does not exist.
+  */
+int deltaKinematicsForwardJacobian( double theta1, double theta2, double theta3,
+                                    double *x0, double *y0, double *z0, double J[3][3] )
+{
+    double c1 = cos(theta1), s1 = sin(theta1);
+    double c2 = cos(theta2), s2 = sin(theta2);
+    double c3 = cos(theta3), s3 = sin(theta3);
+
+    if (forwardFromTrig(c1, s1, c2, s2, c3, s3, x0, y0, z0) != 0)
+    {
+        return -1;
+    }
+    jacobianFromTrig(*x0, *y0, *z0, c1, s1, c2, s2, c3, s3, J);
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsForwardNewton
+  * @brief  Forward kinematics by Newton iterations on the three sphere
+  *         constraints |p - E_i|^2 = re^2 (E_i: elbow moved in by the
+  *         platform offset), started from the last solution. Between ticks
+  *         the thumb barely moves, so one step is usually enough and the
+  *         second one only confirms it; each step is one 3x3 solve with a
+  *         single division, no sqrt. Falls back to the closed form when
+  *         there is no guess, when it does not converge within
+  *         DELTA_NEWTON_MAX_ITERATIONS, or when it lands on the mirror
+  *         solution above the elbows. The elbows and the constraint
+  *         matrix give the Jacobian without more trig (jacobianFromConstraints).
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  position: in, the last solution (used if hasGuess); out, the
+  *         end effector position in the delta_calcForward frame.
+  * @param  hasGuess: 0 to go straight to the closed form.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j in the delta_calcForward
+  *         frame (F in N, torque in N*mm), left untouched if the point does
+  *         not exist.
+  * @retval number of Newton steps (>= 1) if they converged,
+  *         0 if the closed form was used, -1 if the point does not exist.
+  */
+int deltaKinematicsForwardNewton( double theta1, double theta2, double theta3,
+                                  double position[3], int hasGuess, double J[3][3] )
+{
+    const double re = DELTA_UPPER_LINK_LEN;
+    double c1 = cos(theta1), s1 = sin(theta1);
+    double c2 = cos(theta2), s2 = sin(theta2);
+    double c3 = cos(theta3), s3 = sin(theta3);
+    double E[3][3], dE[3][3];
+    double x = position[0], y = position[1], z = position[2];
+    double r[3][3], C[3][3], F[3], det, invDet, dx, dy, dz;
+    int i, steps;
+
+    elbowsFromTrig(c1, s1, c2, s2, c3, s3, E, dE);
+    for (steps = 1; hasGuess && (steps <= DELTA_NEWTON_MAX_ITERATIONS); steps++)
+    {
+        det = constraintCofactors(x, y, z, E, r, C);
+        if (!(det < 0.0))
+        {
+            break; // mirror solution (det > 0) or singular, leave it to the closed form
+        }
+        for (i = 0; i < 3; i++)
+        {
+            F[i] = r[i][0] * r[i][0] + r[i][1] * r[i][1] + r[i][2] * r[i][2] - re * re;
+        }
+
+        // p -= A^-1 F, A = 2r
+        invDet = 1.0 / det;
+        dx = 0.5 * invDet * (C[0][0] * F[0] + C[1][0] * F[1] + C[2][0] * F[2]);
+        dy = 0.5 * invDet * (C[0][1] * F[0] + C[1][1] * F[1] + C[2][1] * F[2]);
+        dz = 0.5 * invDet * (C[0][2] * F[0] + C[1][2] * F[1] + C[2][2] * F[2]);
+        x -= dx;
+        y -= dy;
+        z -= dz;
+
+        if ((fabs(dx) < DELTA_NEWTON_TOLERANCE) && (fabs(dy) < DELTA_NEWTON_TOLERANCE) &&
+            (fabs(dz) < DELTA_NEWTON_TOLERANCE))
+        {
+            // the matrix of this step is up to a tolerance away, redo the
+            // cofactors at the solution (no trig, the elbows are kept)
+            det = constraintCofactors(x, y, z, E, r, C);
+            jacobianFromConstraints(r, C, 1.0 / det, dE, J);
+            position[0] = x;
+            position[1] = y;
+            position[2] = z;
+            return steps;
+        }
+    }
+
+    if (forwardFromTrig(c1, s1, c2, s2, c3, s3, &position[0], &position[1], &position[2]) != 0)
+    {
+        return -1;
+    }
+    det = constraintCofactors(position[0], position[1], position[2], E, r, C);
+    jacobianFromConstraints(r, C, 1.0 / det, dE, J);
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   elbowOfArm
+  * @brief  Elbow position of one arm. Called with the literal sin/cos of the
+  *         arm's mounting angle so the products with 0, 1 and -0.5 fold away.
+  * @param  sinA, cosA: sin and cos of the arm angle -(theta - DELTA_THETA_OFFSET).
+  * @param  sinN, cosN: sin and cos of the arm's mounting angle.
+  * @param  elbow: x, y, z of the elbow.
+  * @retval None.
+  */
+static void elbowOfArm( double sinA, double cosA, double sinN, double cosN, double elbow[3] )
+{
+    double reach = DELTA_ELBOW_OFFSET + DELTA_LOWER_LINK_LEN * cosA;
+
+    elbow[0] = sinN * reach;
+    elbow[1] = -cosN * reach;
+    elbow[2] = DELTA_LOWER_LINK_LEN * sinA;
+}
+
+/*******************************************************************************
+  * @name   mouseForward
+  * @brief  Haptic mouse forward kinematics through the elbows, keeping the
+  *         sin and cos of the arm angles for the Jacobian.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  elbow: elbow i position in elbow[i].
+  * @param  position: end effector x, y, z.
+  * @param  thetaA: arm angles -(theta - DELTA_THETA_OFFSET).
+  * @param  sinA, cosA: their sin and cos.
+  * @retval None.
+  */
+static void mouseForward( double theta1, double theta2, double theta3, double elbow[3][3], double position[3],
+                          double thetaA[3], double sinA[3], double cosA[3] )
+{
+    const double r = DELTA_UPPER_LINK_LEN;
+    int i;
+
+    thetaA[0] = -(theta1 - DELTA_THETA_OFFSET);
+    thetaA[1] = -(theta2 - DELTA_THETA_OFFSET);
+    thetaA[2] = -(theta3 - DELTA_THETA_OFFSET);
+    for (i = 0; i < 3; i++)
+    {
+        sinA[i] = sin(thetaA[i]);
+        cosA[i] = cos(thetaA[i]);
+    }
+
+    elbowOfArm(sinA[0], cosA[0], DELTA_SIN_N1, DELTA_COS_N1, elbow[0]);
+    elbowOfArm(sinA[1], cosA[1], DELTA_SIN_N2, DELTA_COS_N2, elbow[1]);
+    elbowOfArm(sinA[2], cosA[2], DELTA_SIN_N3, DELTA_COS_N3, elbow[2]);
+
+    double y1 = elbow[0][1], z1 = elbow[0][2]; // x1 is always 0, arm 1 is on the y axis
+    double x2 = elbow[1][0], y2 = elbow[1][1], z2 = elbow[1][2];
+    double x3 = elbow[2][0], y3 = elbow[2][1], z3 = elbow[2][2];
+
+    double w1 = y1 * y1 + z1 * z1;
+    double w2 = x2 * x2 + y2 * y2 + z2 * z2;
+    double w3 = x3 * x3 + y3 * y3 + z3 * z3;
+
+    double d = (y2 - y1) * x3 - (y3 - y1) * x2;
+
+    double a1 = ((y3 - y1) * (z2 - z1) - (y2 - y1) * (z3 - z1)) / d;
+    double b1 = ((y2 - y1) * (w3 - w1) - (y3 - y1) * (w2 - w1)) / (2 * d);
+    double a2 = ((z3 - z1) * x2 - (z2 - z1) * x3) / d;
+    double b2 = ((w2 - w1) * x3 - (w3 - w1) * x2) / (2 * d);
+
+    double A = a1 * a1 + a2 * a2 + 1;
+    double B = 2 * (a1 * b1 + a2 * (b2 - y1) - z1);
+    double C = b1 * b1 + (b2 - y1) * (b2 - y1) + z1 * z1 - r * r;
+    double root = sqrt(B * B - 4.0 * A * C);
+
+    position[2] = (- B + root) / (2.0 * A); // one being used
+    if (position[2] < 0)
+    {
+        position[2] = (- B - root) / (2.0 * A);
+    }
+    position[0] = a1 * position[2] + b1;
+    position[1] = a2 * position[2] + b2;
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsElbowPosition
+  * @brief  Haptic mouse forward kinematics (Michael Han), through the elbows.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  elbow: elbow i position in elbow[i].
+  * @param  position: end effector x, y, z.
+  * @param  thetaA: arm angles -(theta - DELTA_THETA_OFFSET).
+  * @retval None.
+  */
+void deltaKinematicsElbowPosition( double theta1, double theta2, double theta3,
+                                   double elbow[3][3], double position[3], double thetaA[3] )
+{
+    double sinA[3], cosA[3];
+
+    mouseForward(theta1, theta2, theta3, elbow, position, thetaA, sinA, cosA);
+}
+
+/*******************************************************************************
+  * @name   armJointAngles
+  * @brief  sin and cos of angles 2 and 3 of one arm. The original code went
+  *         through theta3 = fmod(PI + atan(dz / dx), PI) and theta2 =
+  *         PI - acos(u) and took their sin and cos again; both come straight
+  *         from dz, dx and u, with no trig at all.
+  * @param  elbow: elbow of the arm.
+  * @param  p: end effector position.
+  * @param  sinN, cosN: sin and cos of the arm's mounting angle.
+  * @param  sin2, cos2, sin3, cos3: sin and cos of theta2 and theta3 of the arm.
+  * @retval None.
+  */
+static void armJointAngles( const double elbow[3], const double p[3], double sinN, double cosN,
+                            double *sin2, double *cos2, double *sin3, double *cos3 )
+{
+    const double lower = DELTA_LOWER_LINK_LEN;
+    const double upper = DELTA_UPPER_LINK_LEN;
+
+    // elbow and end effector in the arm's frame
+    double Bx = elbow[0] * cosN + elbow[1] * sinN;
+    double Bz = elbow[2];
+    double Cx = p[0] * cosN + p[1] * sinN;
+    double Cy = - p[0] * sinN + p[1] * cosN;
+
+    double dx = DELTA_BASE_JOINT_X - Cx;
+    double dy = DELTA_BASE_JOINT_Y - Cy;
+    double distance2 = dx * dx + dy * dy + p[2] * p[2];
+
+    // theta3 in [0, PI) along the line elbow to end effector: sin >= 0, cos takes the slope's sign
+    double ex = Cx - Bx;
+    double ez = p[2] - Bz;
+    double length = sqrt(ex * ex + ez * ez);
+    double s3 = fabs(ez) / length;
+    double c3 = ((ex * ez >= 0.0) ? fabs(ex) : -fabs(ex)) / length;
+    double u = -(distance2 - lower * lower - upper * upper * s3 * s3) / (2 * lower * upper * s3);
+
+    *sin3 = s3;
+    *cos3 = c3;
+    *sin2 = sqrt(1.0 - u * u); // sin(PI - acos(u)), nan where acos is
+    *cos2 = -u;
+}
+
+/*******************************************************************************
+  * @name   mouseJointAngles
+  * @brief  sin and cos of the joint angles of the three arms, see armJointAngles.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  theta1i: angle 1 of arm i.
+  * @param  sin1i ... cos3i: sin and cos of angles 1, 2 and 3 of arm i.
+  * @retval None.
+  */
+static void mouseJointAngles( double theta1, double theta2, double theta3, double theta1i[3],
+                              double sin1i[3], double cos1i[3], double sin2i[3], double cos2i[3],
+                              double sin3i[3], double cos3i[3] )
+{
+    double elbow[3][3], p[3];
+
+    mouseForward(theta1, theta2, theta3, elbow, p, theta1i, sin1i, cos1i);
+
+    armJointAngles(elbow[0], p, DELTA_SIN_N1, DELTA_COS_N1, &sin2i[0], &cos2i[0], &sin3i[0], &cos3i[0]);
+    armJointAngles(elbow[1], p, DELTA_SIN_N2, DELTA_COS_N2, &sin2i[1], &cos2i[1], &sin3i[1], &cos3i[1]);
+    armJointAngles(elbow[2], p, DELTA_SIN_N3, DELTA_COS_N3, &sin2i[2], &cos2i[2], &sin3i[2], &cos3i[2]);
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsThetaii
+  * @brief  Joint angles of the three arms for the haptic mouse Jacobian.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  theta1i, theta2i, theta3i: angles 1, 2 and 3 of arm i.
+  * @retval None.
+  */
+void deltaKinematicsThetaii( double theta1, double theta2, double theta3,
+                             double theta1i[3], double theta2i[3], double theta3i[3] )
+{
+    double sin1i[3], cos1i[3], sin2i[3], cos2i[3], sin3i[3], cos3i[3];
+    int i;
+
+    mouseJointAngles(theta1, theta2, theta3, theta1i, sin1i, cos1i, sin2i, cos2i, sin3i, cos3i);
+    for (i = 0; i < 3; i++)
+    {
+        theta2i[i] = PI - acos(-cos2i[i]);
+        theta3i[i] = atan2(sin3i[i], cos3i[i]);
+    }
+}
+
+/*******************************************************************************
+  * @name   jacobianRowMouse
+  * @brief  One row of the haptic mouse direction matrix.
+  * @param  s12, c12: sin and cos of theta1 + theta2 of the arm.
+  * @param  s3, c3: sin and cos of theta3 of the arm.
+  * @param  sinN, cosN: sin and cos of the mounting angle used for the row.
+  * @param  Jx, Jy, Jz: the row.
+  * @retval None.
+  */
+static void jacobianRowMouse( double s12, double c12, double s3, double c3, double sinN, double cosN,
+                              double *Jx, double *Jy, double *Jz )
+{
+    *Jx = - s3 * c12 * sinN + c3 * cosN;
+    *Jy = - s3 * c12 * cosN - c3 * sinN;
+    *Jz = s3 * s12;
+}
+
+/*******************************************************************************
+  * @name   deltaKinematicsJacobianMouse
+  * @brief  Haptic mouse Jacobian from the joint angles. Only the six sin/cos
+  *         of the arm angles are evaluated, the rest is algebra.
+  * @param  theta1, theta2, theta3: motor angles.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j.
+  * @retval None.
+  */
+void deltaKinematicsJacobianMouse( double theta1, double theta2, double theta3, double J[3][3] )
+{
+    double theta1i[3], sin1i[3], cos1i[3], sin2i[3], cos2i[3], sin3i[3], cos3i[3];
+    double s12[3], c12[3], Jx[3], Jy[3], Jz[3], Jq[3];
+    int i;
+
+    mouseJointAngles(theta1, theta2, theta3, theta1i, sin1i, cos1i, sin2i, cos2i, sin3i, cos3i);
+    for (i = 0; i < 3; i++)
+    {
+        s12[i] = sin1i[i] * cos2i[i] + cos1i[i] * sin2i[i];
+        c12[i] = cos1i[i] * cos2i[i] - sin1i[i] * sin2i[i];
+    }
+
+    // rows 2 and 3 use the arm 3 and arm 2 directions, as in the original code
+    jacobianRowMouse(s12[0], c12[0], sin3i[0], cos3i[0], DELTA_SIN_N1, DELTA_COS_N1, &Jx[0], &Jy[0], &Jz[0]);
+    jacobianRowMouse(s12[1], c12[1], sin3i[1], cos3i[1], DELTA_SIN_N3, DELTA_COS_N3, &Jx[1], &Jy[1], &Jz[1]);
+    jacobianRowMouse(s12[2], c12[2], sin3i[2], cos3i[2], DELTA_SIN_N2, DELTA_COS_N2, &Jx[2], &Jy[2], &Jz[2]);
+    Jq[0] = DELTA_LOWER_LINK_LEN * sin2i[0] * sin3i[0];
+    Jq[1] = DELTA_LOWER_LINK_LEN * sin2i[1] * sin3i[1];
+    Jq[2] = DELTA_LOWER_LINK_LEN * sin2i[2] * sin3i[2];
+
+    double C11 = Jy[1] * Jz[2] - Jy[2] * Jz[1];
+    double C12 = -(Jx[1] * Jz[2] - Jx[2] * Jz[1]);
+    double C13 = Jx[1] * Jy[2] - Jx[2] * Jy[1];
+    double invDet = 1.0 / (Jx[0] * C11 + Jy[0] * C12 + Jz[0] * C13);
+    double qa = Jq[0] * invDet;
+    double qb = Jq[1] * invDet;
+    double qc = Jq[2] * invDet;
+
+    J[0][0] = qa * C11;
+    J[0][1] = qa * C12;
+    J[0][2] = qa * C13;
+    J[1][0] = -qb * (Jy[0] * Jz[2] - Jy[2] * Jz[0]);
+    J[1][1] = qb * (Jx[0] * Jz[2] - Jx[2] * Jz[0]);
+    J[1][2] = -qb * (Jx[0] * Jy[2] - Jx[2] * Jy[0]);
+    J[2][0] = qc * (Jy[0] * Jz[1] - Jy[1] * Jz[0]);
+    J[2][1] = -qc * (Jx[0] * Jz[1] - Jx[1] * Jz[0]);
+    J[2][2] = qc * (Jx[0] * Jy[1] - Jx[1] * Jy[0]);
+}
+//EOF
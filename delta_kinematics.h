@@ -0,0 +1,96 @@
+/**
+  ******************************************************************************
+  * @file    delta_kinematics.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Delta thumb geometry and kinematics. Only needs math.h so it can
+  *          be compiled and checked on a computer (tools/bench_delta_kinematics.c).
+  *          Angles in radians, lengths in mm.
+  ******************************************************************************
+  */
+#ifndef __DELTA_KINEMATICS_H_
+#define __DELTA_KINEMATICS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+// MATH
+#define PI 3.14159265358979323846
+#define DEG_TO_RAD(degrees) ((degrees) * (PI / 180.0))
+#define RAD_TO_DEG(radians) ((radians) * (180.0 / PI))
+
+// DELTA DEVICE CONSTANTS
+#define DELTA_BASE_RADIUS 31.2 // base radius - distance from origin to base joint
+#define DELTA_END_EFFECTOR_RADIUS 25 // distance from platform's origin to platform joint
+// Thetas that motors are positioned at
+#define DELTA_THETA_N1 0.0
+#define DELTA_THETA_N2 120.0 * PI / 180.0
+#define DELTA_THETA_N3 240.0 * PI / 180.0
+#define DELTA_LOWER_LINK_LEN 30.0
+#define DELTA_UPPER_LINK_LEN 60.0
+
+#define DELTA_THETA_OFFSET  (18.1) * PI / 180.0
+
+// P = platform, B = base
+#define DELTA_WP 7.22 // end effector origin to edge perpendicular
+#define DELTA_UP 14.43 // end effector origin to corner
+#define DELTA_WB 35.0  // base origin to edge perpendicular
+#define DELTA_UB 70.0  // base origin to corner
+#define DELTA_SP 25.0  // edge length of end effector
+#define DELTA_SB 121.24 // edge length of base
+
+// Derived geometry, written out as numbers so nothing is left for the
+// compiler (or the M4) to evaluate: the compilers we use do not all fold
+// sin/cos/sqrt of constants. Only angle dependent math remains at runtime.
+#define DELTA_SQRT3   1.73205080756887729353
+#define DELTA_TAN30   0.57735026918962576451    // 1/sqrt(3)
+#define DELTA_SIN_N1  0.0                       // sin(DELTA_THETA_N1)
+#define DELTA_COS_N1  1.0
+#define DELTA_SIN_N2  0.86602540378443864676    // sin(120 deg)
+#define DELTA_COS_N2  (-0.5)
+#define DELTA_SIN_N3  (-0.86602540378443864676) // sin(240 deg)
+#define DELTA_COS_N3  (-0.5)
+// Every base joint is at radius*(cos 270, sin 270) in its own arm's frame
+// (arm 2: cos30*cos120 + sin30*sin120 = cos90, arm 3 the same with 150/240)
+#define DELTA_BASE_JOINT_X  0.0
+#define DELTA_BASE_JOINT_Y  (-DELTA_BASE_RADIUS)
+#define DELTA_ELBOW_OFFSET  (DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS) // dAprime
+
+// The thumb frame is the delta_calcForward frame with x and y swapped and
+// the origin moved down by this much (see deltaThumbHandler)
+#define DELTA_THUMB_Z_OFFSET 50.0
+
+// deltaKinematicsForwardNewton: a step under the tolerance (mm) leaves an
+// error of about step^2 / re, far below the encoder resolution
+#define DELTA_NEWTON_TOLERANCE      0.05
+#define DELTA_NEWTON_MAX_ITERATIONS 3
+
+/******* Function prototypes ****/
+int deltaKinematicsForward( double theta1, double theta2, double theta3, double *x0, double *y0, double *z0 );
+int deltaKinematicsAngleYZ( double x0, double y0, double z0, double *theta );
+int deltaKinematicsInverse( double x0, double y0, double z0, double *theta1, double *theta2, double *theta3 );
+void deltaKinematicsJacobianOhio( double x, double y, double z,
+                                  double theta1, double theta2, double theta3, double J[3][3] );
+void deltaKinematicsJacobian( double theta1, double theta2, double theta3,
+                              double x0, double y0, double z0, double J[3][3] );
+void deltaKinematicsToThumbFrame( const double position[3], const double J[3][3],
+                                  double thumb[3], double JThumb[3][3] );
+int deltaKinematicsForwardJacobian( double theta1, double theta2, double theta3,
+                                    double *x0, double *y0, double *z0, double J[3][3] );
+int deltaKinematicsForwardNewton( double theta1, double theta2, double theta3,
+                                  double position[3], int hasGuess, double J[3][3] );
+
+// Haptic mouse chain (elbows -> joint angles -> Jacobian), motor angles in radians
+void deltaKinematicsElbowPosition( double theta1, double theta2, double theta3,
+                                   double elbow[3][3], double position[3], double thetaA[3] );
+void deltaKinematicsThetaii( double theta1, double theta2, double theta3,
+                             double theta1i[3], double theta2i[3], double theta3i[3] );
+void deltaKinematicsJacobianMouse( double theta1, double theta2, double theta3, double J[3][3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__DELTA_KINEMATICS_H_
@@ -0,0 +1,235 @@
+/**
+  ******************************************************************************
+  * @file    delta_servo.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Cartesian impedance position servo for the delta thumb, replaces
+  *          the per motor PID of setAndMaintainMotorAngle for goTo/goToAngle.
+  *          That PID works in degrees per loop iteration, so its integral
+  *          and derivative change with the loop speed. Here every time
+  *          constant is in seconds: the path advances by whole control
+  *          periods, the velocity filter uses the measured time step, and
+  *          the cost of a call does not depend on how late it is.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "delta_servo.h"
+#include <math.h>
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   deltaServoInit
+  * @brief  Sets the gains and leaves the servo off (zero torque).
+  * @param  servo: servo to initialize.
+  * @param  stiffness: N/m.
+  * @param  damping: N*s/m.
+  * @param  maxSpeed: peak speed along the path, mm/s.
+  * @retval None.
+  */
+void deltaServoInit( DeltaServo *servo, double stiffness, double damping, double maxSpeed )
+{
+    int i;
+
+    servo->stiffness = stiffness;
+    servo->damping = damping;
+    servo->maxSpeed = maxSpeed;
+    for (i = 0; i < 3; i++)
+    {
+        servo->start[i] = 0.0;
+        servo->target[i] = 0.0;
+        servo->setpoint[i] = 0.0;
+        servo->setpointVelocity[i] = 0.0;
+        servo->lastPosition[i] = 0.0;
+        servo->velocity[i] = 0.0;
+        servo->torque[i] = 0.0;
+    }
+    servo->duration = 0.0;
+    servo->pathTime = 0.0;
+    servo->lastTime = 0.0;
+    servo->pending = 0.0;
+    servo->hasLast = 0;
+    servo->active = 0;
+}
+
+/*******************************************************************************
+  * @name   deltaServoMoveTo
+  * @brief  Starts a minimum jerk move to target. The peak speed of that path
+  *         is 1.875 * distance / duration, the duration is picked so it
+  *         equals maxSpeed. A move issued while another one runs starts from
+  *         the current setpoint so the spring does not jump.
+  * @param  servo: servo.
+  * @param  from: current end effector position, used if the servo was off.
+  * @param  target: where to go, mm.
+  * @retval None.
+  */
+void deltaServoMoveTo( DeltaServo *servo, const double from[3], const double target[3] )
+{
+    double distance2 = 0.0, d;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        servo->start[i] = servo->active ? servo->setpoint[i] : from[i];
+        servo->target[i] = target[i];
+        d = target[i] - servo->start[i];
+        distance2 += d * d;
+    }
+    servo->duration = 1.875 * sqrt(distance2) / servo->maxSpeed;
+    if (servo->duration < 5 * DELTA_SERVO_PERIOD_S)
+    {
+        servo->duration = 5 * DELTA_SERVO_PERIOD_S;
+    }
+    servo->pathTime = 0.0;
+    servo->active = 1;
+}
+
+/*******************************************************************************
+  * @name   deltaServoStop
+  * @brief  Turns the servo off, its torque goes to zero on the next update.
+  * @param  servo: servo.
+  * @retval None.
+  */
+void deltaServoStop( DeltaServo *servo )
+{
+    servo->active = 0;
+}
+
+/*******************************************************************************
+  * @name   deltaServoArrived
+  * @brief  1 once the path has reached the target (the spring keeps holding
+  *         it until deltaServoStop).
+  * @param  servo: servo.
+  * @retval 1 if arrived, 0 if moving or off.
+  */
+int deltaServoArrived( const DeltaServo *servo )
+{
+    return servo->active && (servo->pathTime >= servo->duration);
+}
+
+/*******************************************************************************
+  * @name   updateSetpoint
+  * @brief  Minimum jerk path at servo->pathTime.
+  * @param  servo: servo.
+  * @retval None.
+  */
+static void updateSetpoint( DeltaServo *servo )
+{
+    double tau = servo->pathTime / servo->duration;
+    double s, ds;
+    int i;
+
+    if (tau >= 1.0)
+    {
+        s = 1.0;
+        ds = 0.0;
+    }
+    else
+    {
+        // s = 10 tau^3 - 15 tau^4 + 6 tau^5, ds/dt = 30 tau^2 (1 - tau)^2 / duration
+        s = tau * tau * tau * (10.0 + tau * (-15.0 + 6.0 * tau));
+        ds = 30.0 * tau * tau * (1.0 - tau) * (1.0 - tau) / servo->duration;
+    }
+    for (i = 0; i < 3; i++)
+    {
+        servo->setpoint[i] = servo->start[i] + (servo->target[i] - servo->start[i]) * s;
+        servo->setpointVelocity[i] = (servo->target[i] - servo->start[i]) * ds;
+    }
+}
+
+/*******************************************************************************
+  * @name   deltaServoUpdate
+  * @brief  Call every loop with the latest pose. Runs the control law once
+  *         per whole DELTA_SERVO_PERIOD_S of real time that has gone by
+  *         (the path is analytic so catching up costs the same as one
+  *         period) and holds the torque in between. If the time went back,
+  *         or forward by more than DELTA_SERVO_MAX_STEPS periods, the servo
+  *         starts again from this call: no velocity, zero torque, the path
+  *         where it was. So with less than a period left over from the last
+  *         call, one call never runs more than DELTA_SERVO_MAX_STEPS.
+  *         F = K (setpoint - p) + B (setpoint velocity - v), torque = J F.
+  * @param  servo: servo.
+  * @param  time_s: now, seconds.
+  * @param  position: end effector, mm.
+  * @param  J: torque_i = sum over j of J[i][j] * F_j, mm per rad (as from
+  *         deltaKinematicsForwardJacobian).
+  * @param  torque: motor torques to add, Nm.
+  * @retval number of control periods run by this call.
+  */
+int deltaServoUpdate( DeltaServo *servo, double time_s, const double position[3],
+                      const double J[3][3], double torque[3] )
+{
+    double dt, alpha, force[3], largest, scale;
+    int i, steps;
+
+    dt = time_s - servo->lastTime;
+    if (!servo->hasLast || (dt < 0.0) || (dt > DELTA_SERVO_MAX_STEPS * DELTA_SERVO_PERIOD_S))
+    {
+        for (i = 0; i < 3; i++)
+        {
+            servo->lastPosition[i] = position[i];
+            servo->velocity[i] = 0.0;
+            torque[i] = servo->torque[i] = 0.0;
+        }
+        servo->lastTime = time_s;
+        servo->pending = 0.0;
+        servo->hasLast = 1;
+        return 0;
+    }
+
+    if (dt > 0.0)
+    {
+        // first order filter discretized with the real time step
+        alpha = dt / (DELTA_SERVO_VELOCITY_TAU_S + dt);
+        for (i = 0; i < 3; i++)
+        {
+            servo->velocity[i] += alpha * ((position[i] - servo->lastPosition[i]) / dt - servo->velocity[i]);
+            servo->lastPosition[i] = position[i];
+        }
+        servo->lastTime = time_s;
+        servo->pending += dt;
+    }
+
+    steps = (int)(servo->pending / DELTA_SERVO_PERIOD_S);
+    if (steps == 0)
+    {
+        for (i = 0; i < 3; i++) torque[i] = servo->torque[i];
+        return 0;
+    }
+    servo->pending -= steps * DELTA_SERVO_PERIOD_S;
+
+    if (!servo->active)
+    {
+        for (i = 0; i < 3; i++) torque[i] = servo->torque[i] = 0.0;
+        return steps;
+    }
+
+    servo->pathTime += steps * DELTA_SERVO_PERIOD_S;
+    updateSetpoint(servo);
+
+    // N, positions and speeds are in mm
+    for (i = 0; i < 3; i++)
+    {
+        force[i] = 0.001 * (servo->stiffness * (servo->setpoint[i] - position[i]) +
+                            servo->damping * (servo->setpointVelocity[i] - servo->velocity[i]));
+    }
+
+    // Nm, J is in mm per rad
+    largest = 0.0;
+    for (i = 0; i < 3; i++)
+    {
+        servo->torque[i] = 0.001 * (J[i][0] * force[0] + J[i][1] * force[1] + J[i][2] * force[2]);
+        if (fabs(servo->torque[i]) > largest) largest = fabs(servo->torque[i]);
+    }
+    // scale all three down together so the force keeps its direction
+    if (largest > DELTA_SERVO_MAX_TORQUE)
+    {
+        scale = DELTA_SERVO_MAX_TORQUE / largest;
+        for (i = 0; i < 3; i++) servo->torque[i] *= scale;
+    }
+    for (i = 0; i < 3; i++) torque[i] = servo->torque[i];
+    return steps;
+}
+//EOF
@@ -0,0 +1,70 @@
+/**
+  ******************************************************************************
+  * @file    delta_servo.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Cartesian impedance position servo for the delta thumb. A spring
+  *          and damper (N/m, N*s/m) pull the end effector along a minimum
+  *          jerk path to the target, the force goes to the motors through
+  *          the Jacobian transpose. The control law runs at a fixed rate no
+  *          matter how fast the main loop spins: deltaServoUpdate counts
+  *          whole periods of real time and holds the torque in between.
+  *          Only needs math.h, so it can be simulated on a computer
+  *          (tools/sim_delta_servo.c). Positions in mm, delta_calcForward frame.
+  ******************************************************************************
+  */
+#ifndef __DELTA_SERVO_H_
+#define __DELTA_SERVO_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "delta_kinematics.h"
+
+// Defaults, see initDeltaThumb
+#define DELTA_SERVO_STIFFNESS       200.0   // N/m
+#define DELTA_SERVO_DAMPING         2.0     // N*s/m
+#define DELTA_SERVO_MAX_SPEED       50.0    // mm/s, peak speed along the path
+#define DELTA_SERVO_PERIOD_S        0.001   // control law rate, 1 kHz
+#define DELTA_SERVO_MAX_STEPS       10      // periods caught up in one call, a longer gap restarts the servo
+#define DELTA_SERVO_VELOCITY_TAU_S  0.002   // velocity filter time constant
+#define DELTA_SERVO_MAX_TORQUE      0.015   // Nm, full duty on the thumb motors
+
+typedef struct {
+    // gains
+    double stiffness;           // N/m
+    double damping;             // N*s/m
+    double maxSpeed;            // mm/s
+    // path
+    double start[3];            // mm
+    double target[3];           // mm
+    double duration;            // s
+    double pathTime;            // s since the move started, whole periods only
+    double setpoint[3];         // mm
+    double setpointVelocity[3]; // mm/s
+    // state
+    double lastPosition[3];     // mm
+    double velocity[3];         // mm/s, filtered
+    double lastTime;            // s
+    double pending;             // s of real time not yet run as periods
+    double torque[3];           // Nm, held between periods
+    int hasLast;
+    int active;
+} DeltaServo;
+
+/******* Function prototypes ****/
+void deltaServoInit( DeltaServo *servo, double stiffness, double damping, double maxSpeed );
+void deltaServoMoveTo( DeltaServo *servo, const double from[3], const double target[3] );
+void deltaServoStop( DeltaServo *servo );
+int deltaServoUpdate( DeltaServo *servo, double time_s, const double position[3],
+                      const double J[3][3], double torque[3] );
+int deltaServoArrived( const DeltaServo *servo );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__DELTA_SERVO_H_
+//EOF
@@ -18,7 +18,11 @@
 #include "haplink_encoders.h"
 #include <math.h> // For sqrt
 #include "delta_thumb.h"
+#include "delta_servo.h"
+#include "delta_workspace.h"
+#include "haplink_filters.h"
 #include "haplink_time.h"
+#include "haplink_telemetry_streams.h"
 #include "stdio.h"
 
 // Global vars
@@ -28,13 +32,21 @@ DeltaThumb deltaThumb;
 double deltaThumbX;
 double deltaThumbY;
 double deltaThumbZ;
-double deltaThumbX_prev, deltaThumbY_prev, deltaThumbZ_prev;
+Filter deltaThumbFilter[3];     // x, y, z, THUMB_POSITION_FILTER
+double deltaThumbFilterTime_us;
 double ThetaMotor1Rad;
 double ThetaMotor2Rad;
 double ThetaMotor3Rad;
 double ThetaMotor1Deg;
 double ThetaMotor2Deg;
 double ThetaMotor3Deg;
+double deltaThumbJacobian[3][3]; // thumb frame, see deltaThumbUpdateJacobian
+double deltaThumbRawJacobian[3][3]; // the same in the delta_calcForward frame
+int deltaThumbJacobianValid = 0; // the Jacobians are at deltaThumbRaw
+double deltaThumbRaw[3];        // last unsmoothed solution, delta_calcForward frame
+int deltaThumbRawValid = 0;     // 0 until the first solution, or after the point was lost
+DeltaServo deltaThumbServo;     // goTo/goToAngle position servo
+double deltaThumbServoTorque[3];
 
 
 float getThumbX( void ) {
@@ -82,23 +94,52 @@ void deltaThumbHandler( void )
     // outputTorqueMotor3(TorqueMotor3);    
 
 
-    // // #1: Update x,y,z positions of end-effector using DeltaZ code
-    delta_calcForward(ThetaMotor1Deg, ThetaMotor2Deg, ThetaMotor3Deg, &deltaThumbX, &deltaThumbY, &deltaThumbZ);
-    double tempX =deltaThumbX ;
-    deltaThumbX = deltaThumbY;
-    deltaThumbY = tempX;
-    deltaThumbZ = deltaThumbZ + 50.0;
-
-    // Apply smoothing
-    double alpha = 0.4;
-    deltaThumbX = deltaThumbX * alpha + deltaThumbX_prev * (1-alpha);
-    deltaThumbY = deltaThumbY * alpha + deltaThumbY_prev * (1-alpha);
-    deltaThumbZ = deltaThumbZ * alpha + deltaThumbZ_prev * (1-alpha);
+    // // #1: Update x,y,z positions of end-effector using DeltaZ code, the Jacobian is only
+    // computed when a force needs it (see deltaThumbUpdateJacobian)
+    // delta_calcForward(ThetaMotor1Deg, ThetaMotor2Deg, ThetaMotor3Deg, &deltaThumbX, &deltaThumbY, &deltaThumbZ);
+    double thumb[3];
+#ifdef DELTA_THUMB_NEWTON_FK
+    // Newton steps from the last tick, closed form when there is none; the Jacobian comes for free
+    double J[3][3];
+    deltaThumbRawValid = (deltaKinematicsForwardNewton(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad,
+                                                       deltaThumbRaw, deltaThumbRawValid, J) >= 0);
+    deltaThumbJacobianValid = deltaThumbRawValid;
+    if (deltaThumbRawValid)
+    {
+        for (int i = 0; i < 3; i++)
+            for (int j = 0; j < 3; j++) deltaThumbRawJacobian[i][j] = J[i][j];
+        deltaKinematicsToThumbFrame(deltaThumbRaw, J, thumb, deltaThumbJacobian);
+    }
+#else
+    deltaThumbRawValid = (deltaKinematicsForward(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad,
+                                                 &deltaThumbRaw[0], &deltaThumbRaw[1], &deltaThumbRaw[2]) == 0);
+    deltaThumbJacobianValid = 0;
+#endif
+    // keeps the last pose if the point does not exist
+    deltaKinematicsToThumbFrame(deltaThumbRaw, 0, thumb, 0);
+    deltaThumbX = thumb[0];
+    deltaThumbY = thumb[1];
+    deltaThumbZ = thumb[2];
+
+    // position servo, runs at its own fixed rate (added to the rendered torque)
+    if (deltaThumbRawValid)
+    {
+        if (deltaThumbServo.active) deltaThumbUpdateJacobian();
+        deltaServoUpdate(&deltaThumbServo, getTime_us() * 1e-6, deltaThumbRaw, deltaThumbRawJacobian,
+                         deltaThumbServoTorque);
+    }
+    else
+    {
+        deltaThumbServoTorque[0] = deltaThumbServoTorque[1] = deltaThumbServoTorque[2] = 0.0;
+    }
 
-    // Set previous values
-    deltaThumbX_prev = deltaThumbX;
-    deltaThumbY_prev = deltaThumbY;
-    deltaThumbZ_prev = deltaThumbZ;
+    // Apply smoothing (THUMB_POSITION_FILTER in main.h)
+    double now_us = getTime_us();
+    float dt = (float)((now_us - deltaThumbFilterTime_us) * 1e-6);
+    deltaThumbFilterTime_us = now_us;
+    deltaThumbX = filterUpdate(&deltaThumbFilter[0], (float)deltaThumbX, dt);
+    deltaThumbY = filterUpdate(&deltaThumbFilter[1], (float)deltaThumbY, dt);
+    deltaThumbZ = filterUpdate(&deltaThumbFilter[2], (float)deltaThumbZ, dt);
 
     // #2: Update x,y,z positions of end-effector using haptic mouse code
     // double x1, y1, z1, x2, y2, z2, x3, y3, z3;
@@ -217,13 +258,13 @@ void initDeltaThumb() {
   deltaThumb.re = DELTA_UPPER_LINK_LEN;    
   deltaThumb.rf = DELTA_LOWER_LINK_LEN;           
 
-  deltaThumb.sqrt3 = sqrt(3.0);
-  deltaThumb.pi = 3.141592653;    // PI
-  deltaThumb.sin120 = deltaThumb.sqrt3 / 2.0;
-  deltaThumb.cos120 = -0.5;
-  deltaThumb.tan60 = deltaThumb.sqrt3;
+  deltaThumb.sqrt3 = DELTA_SQRT3;
+  deltaThumb.pi = PI;
+  deltaThumb.sin120 = DELTA_SIN_N2;
+  deltaThumb.cos120 = DELTA_COS_N2;
+  deltaThumb.tan60 = DELTA_SQRT3;
   deltaThumb.sin30 = 0.5;
-  deltaThumb.tan30 = 1.0 / deltaThumb.sqrt3;
+  deltaThumb.tan30 = DELTA_TAN30;
   deltaThumb.rMax = 30;
   deltaThumb.zMin = 35;
   deltaThumb.zMax = 75;
@@ -231,6 +272,11 @@ void initDeltaThumb() {
   deltaThumbX = 0;
   deltaThumbY = 0;
   deltaThumbZ = 0;
+
+  deltaServoInit(&deltaThumbServo, DELTA_SERVO_STIFFNESS, DELTA_SERVO_DAMPING, DELTA_SERVO_MAX_SPEED);
+  for (int i = 0; i < 3; i++) {
+    filterInit(&deltaThumbFilter[i], THUMB_POSITION_FILTER);
+  }
 }
 
 void goHome() {
@@ -251,10 +297,9 @@ void goTo(double x, double y, double z) {
     deltaThumb.z0 = z;
     delta_calcInverse(deltaThumb.x0, deltaThumb.y0, deltaThumb.z0, &deltaThumb.t1, &deltaThumb.t2, &deltaThumb.t3);
 
-    // Set the angles
-    setAndMaintainMotorAngle(MOTOR_1, -deltaThumb.t1 + 90);
-    setAndMaintainMotorAngle(MOTOR_2, -deltaThumb.t2 + 90);
-    setAndMaintainMotorAngle(MOTOR_3, -deltaThumb.t3 + 90);  
+    // Start the move, deltaThumbHandler runs the servo (see delta_servo.h)
+    double target[3] = {x, y, z};
+    deltaServoMoveTo(&deltaThumbServo, deltaThumbRaw, target);
   } else {
     printf("NOT IN WORKSPACE");
   }
@@ -263,9 +308,12 @@ void goTo(double x, double y, double z) {
 
 int testInWorkspace(double x, double y, double z) {
   /* inputs target x,y, and z position. Tests if the position if the position is in the current worksapce of the robot (set by rMax, zMin, and zMax.
+  and reachable inside the joint range, see deltaWorkspaceReachable)
   If the point is in the workspace, return 1, else return 0*/
   double r = sqrt(x * x + y * y);
-  if ((r <= deltaThumb.rMax) && (z <= deltaThumb.zMax) && (z >= deltaThumb.zMin)) {
+  double depth = -z; // z is negative below the base in the delta_calcForward frame
+  if ((r <= deltaThumb.rMax) && (depth <= deltaThumb.zMax) && (depth >= deltaThumb.zMin) &&
+      deltaWorkspaceReachable(x, y, z)) {
     return 1;
   } else {
     return 0;
@@ -297,10 +345,9 @@ void goToAngle(int angle1, int angle2, int angle3) {
     deltaThumb.t2 = angle2;
     deltaThumb.t3 = angle3;
 
-    // Set the angles
-    setAndMaintainMotorAngle(MOTOR_1, -deltaThumb.t1 + 90);
-    setAndMaintainMotorAngle(MOTOR_2, -deltaThumb.t2 + 90);
-    setAndMaintainMotorAngle(MOTOR_3, -deltaThumb.t3 + 90);  
+    // Go there in Cartesian space, same servo as goTo
+    double target[3] = {deltaThumb.x0, deltaThumb.y0, deltaThumb.z0};
+    deltaServoMoveTo(&deltaThumbServo, deltaThumbRaw, target);
   } else {
     printf("NOT IN WORKSPACE");
     deltaThumb.x0 = x0Old;
@@ -310,23 +357,57 @@ void goToAngle(int angle1, int angle2, int angle3) {
   reportPosition();
 }
 
+/*******************************************************************************
+  * @name   deltaThumbForceScale
+  * @brief  Workspace map factor for the rendered thumb force at the last pose:
+  *         goes down near singularities, where the torque for a given force
+  *         blows up (see deltaWorkspaceForceScale).
+  * @param  None.
+  * @retval 1/DELTA_WORKSPACE_SATURATE_LEVEL to 1.
+  */
+double deltaThumbForceScale( void ) {
+    return deltaWorkspaceForceScale(deltaThumbRaw[0], deltaThumbRaw[1], deltaThumbRaw[2]);
+}
+
+/*******************************************************************************
+  * @name   deltaThumbServoStop
+  * @brief  Releases the thumb after goTo/goToAngle, the servo torque goes to
+  *         zero.
+  * @param  None.
+  * @retval None.
+  */
+void deltaThumbServoStop( void ) {
+    deltaServoStop(&deltaThumbServo);
+}
+
+/*******************************************************************************
+  * @name   deltaThumbServoArrived
+  * @brief  1 once the last goTo/goToAngle path has reached its target.
+  * @param  None.
+  * @retval 1 if arrived, 0 if moving or released.
+  */
+int deltaThumbServoArrived( void ) {
+    return deltaServoArrived(&deltaThumbServo);
+}
+
+/*******************************************************************************
+  * @name   getDeltaThumbServoTorque
+  * @brief  Servo torque from the last deltaThumbHandler, to add to the
+  *         rendered torque (zero when the servo is released).
+  * @param  torque1, torque2, torque3: Nm.
+  * @retval None.
+  */
+void getDeltaThumbServoTorque(double *torque1, double *torque2, double *torque3) {
+    *torque1 = deltaThumbServoTorque[0];
+    *torque2 = deltaThumbServoTorque[1];
+    *torque3 = deltaThumbServoTorque[2];
+}
+
 int delta_calcAngleYZ(double x0, double y0, double z0, double *theta) {
   /* Visit https://hypertriangle.com/~alex/delta-robot-tutorial/ for more information*/
-  double y1 = -0.5 * 0.57735 * deltaThumb.f; // f/2 * tg 30
-  //double y1 = yy1;
-  y0 -= 0.5 * 0.57735 * deltaThumb.e;    // shift center to edge
-  // z = a + b*y
-  double a = (x0 * x0 + y0 * y0 + z0 * z0 + deltaThumb.rf * deltaThumb.rf - deltaThumb.re * deltaThumb.re - y1 * y1) / (2 * z0);
-  double b = (y1 - y0) / z0;
-  // discriminant
-  double d = -(a + b * y1) * (a + b * y1) + deltaThumb.rf * (b * b * deltaThumb.rf + deltaThumb.rf);
-  if (d < 0) return -1; // non-existing point
-  double yj = (y1 - a * b - sqrt(d)) / (b * b + 1); // choosing outer point
-  double zj = a + b * yj;
-  *theta = 180.0 * atan(-zj / (y1 - yj)) / deltaThumb.pi + ((yj > y1) ? 180.0 : 0.0);
-  if ((*theta < -180) || (*theta > 180))
-    return -1;
-  return 0;
+  int status = deltaKinematicsAngleYZ(x0, y0, z0, theta);
+  *theta = RAD_TO_DEG(*theta);
+  return status;
 }
 
 
@@ -339,13 +420,11 @@ int delta_calcAngleYZ(double x0, double y0, double z0, double *theta) {
  */
 int delta_calcInverse(double x0, double y0, double z0, double *theta1, double *theta2, double *theta3) {
   /* Visit https://hypertriangle.com/~alex/delta-robot-tutorial/ for more information*/
-  *theta1 = 0;
-  *theta2 = 0;
-  *theta3 = 0;
-  int stat1 = delta_calcAngleYZ(x0, y0, z0, theta1);
-  int stat2 = delta_calcAngleYZ(x0 * deltaThumb.cos120 + y0 * deltaThumb.sin120, y0 * deltaThumb.cos120 - x0 * deltaThumb.sin120, z0, theta2); // rotate coords to +120 deg
-  int stat3 = delta_calcAngleYZ(x0 * deltaThumb.cos120 - y0 * deltaThumb.sin120, y0 * deltaThumb.cos120 + x0 * deltaThumb.sin120, z0, theta3); // rotate coords to -120 deg
-  return stat1 + stat2 + stat3;
+  int status = deltaKinematicsInverse(x0, y0, z0, theta1, theta2, theta3);
+  *theta1 = RAD_TO_DEG(*theta1);
+  *theta2 = RAD_TO_DEG(*theta2);
+  *theta3 = RAD_TO_DEG(*theta3);
+  return status;
 }
 
 /**
@@ -357,54 +436,7 @@ int delta_calcInverse(double x0, double y0, double z0, double *theta1, double *t
  */
 int delta_calcForward(double theta1, double theta2, double theta3, double *x0, double *y0, double *z0) {
   /* Visit https://hypertriangle.com/~alex/delta-robot-tutorial/ for more information*/
-  double t = (deltaThumb.f - deltaThumb.e) * deltaThumb.tan30 / 2;
-  double dtr = deltaThumb.pi / (double)180.0;
-
-  theta1 *= dtr;
-  theta2 *= dtr;
-  theta3 *= dtr;
-
-  double y1 = -(t + deltaThumb.rf * cos(theta1));
-  double z1 = -deltaThumb.rf * sin(theta1);
-
-  double y2 = (t + deltaThumb.rf * cos(theta2)) * deltaThumb.sin30;
-  double x2 = y2 * deltaThumb.tan60;
-  double z2 = -deltaThumb.rf * sin(theta2);
-
-  double y3 = (t + deltaThumb.rf * cos(theta3)) * deltaThumb.sin30;
-  double x3 = -y3 * deltaThumb.tan60;
-  double z3 = -deltaThumb.rf * sin(theta3);
-
-  double dnm = (y2 - y1) * x3 - (y3 - y1) * x2;
-
-  double w1 = y1 * y1 + z1 * z1;
-  double w2 = x2 * x2 + y2 * y2 + z2 * z2;
-  double w3 = x3 * x3 + y3 * y3 + z3 * z3;
-
-  // x = (a1*z + b1)/dnm
-  double a1 = (z2 - z1) * (y3 - y1) - (z3 - z1) * (y2 - y1);
-  double b1 = -((w2 - w1) * (y3 - y1) - (w3 - w1) * (y2 - y1)) / 2.0;
-
-  // y = (a2*z + b2)/dnm;
-  double a2 = -(z2 - z1) * x3 + (z3 - z1) * x2;
-  double b2 = ((w2 - w1) * x3 - (w3 - w1) * x2) / 2.0;
-
-  // a*z^2 + b*z + c = 0
-  double a = a1 * a1 + a2 * a2 + dnm * dnm;
-  double b = 2 * (a1 * b1 + a2 * (b2 - y1 * dnm) - z1 * dnm * dnm);
-  double c = (b2 - y1 * dnm) * (b2 - y1 * dnm) + b1 * b1 + dnm * dnm * (z1 * z1 - deltaThumb.re * deltaThumb.re);
-
-  // discriminant
-  double d = b * b - (double)4.0 * a * c;
-  if (d < 0) return -1; // non-existing point
-  
-  *z0 = -(double)0.5 * (b + sqrt(d)) / a;
-  // NEW, reflect Z to + axis
-//   *z0 = *z0 * -1;
-
-  *x0 = (a1 * *z0 + b1) / dnm;
-  *y0 = (a2 * *z0 + b2) / dnm;
-  return 0;
+  return deltaKinematicsForward(DEG_TO_RAD(theta1), DEG_TO_RAD(theta2), DEG_TO_RAD(theta3), x0, y0, z0);
 }
 
 /*******************************************************************************************************************************************/
@@ -424,153 +456,35 @@ void GetElbowPosition (double *x1, double *y1, double *z1,
                        double *x, double *y, double *z,
                        double *theta_a1, double *theta_a2, double *theta_a3)
 {
-    *theta_a1 = -(ThetaMotor1Rad - DELTA_THETA_OFFSET);
-    *theta_a2 = -(ThetaMotor2Rad - DELTA_THETA_OFFSET);
-    *theta_a3 = -(ThetaMotor3Rad - DELTA_THETA_OFFSET);
-
-    double dAprime = DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS;
-
-    // elbow position for 1
-    *x1 = sin(DELTA_THETA_N1) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a1));
-    *y1 = cos(DELTA_THETA_N1) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a1));
-    *z1 = DELTA_LOWER_LINK_LEN * sin(*theta_a1);
-
-    // elbow position for 2
-    *x2 = sin(DELTA_THETA_N2) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a2));
-    *y2 = cos(DELTA_THETA_N2) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a2));
-    *z2 = DELTA_LOWER_LINK_LEN * sin(*theta_a2);
-
-    // elbow position for 3
-    *x3 = sin(DELTA_THETA_N3) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a3));
-    *y3 = cos(DELTA_THETA_N3) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a3));
-    *z3 = DELTA_LOWER_LINK_LEN * sin(*theta_a3);
-
-    double w1 = pow(*y1, 2) + pow(*z1, 2);
-    double w2 = pow(*x2, 2) + pow(*y2, 2) + pow(*z2, 2);
-    double w3 = pow(*x3, 2) + pow(*y3, 2) + pow(*z3, 2);
-
-    double d = (*y2 - *y1) * (*x3) - (*y3 - *y1) * (*x2);
-
-    double a1 = ((*y3 - *y1) * (*z2 - *z1) - (*y2 - *y1) * (*z3 - *z1)) / d;
-    double b1 = ((*y2 - *y1) * (w3 - w1) - (*y3 - *y1) * (w2 - w1)) / (2 * d);
-    double a2 = ((*z3 - *z1) * (*x2) - (*z2 - *z1) * (*x3)) / d;
-    double b2 = ((w2 - w1) * (*x3) - (w3 - w1) * (*x2)) / (2 * d);
-
-    //if (r == 0) //on initial run
-    //{
-    //    r = DELTA_UPPER_LINK_LEN;
-    //}
-    //else {
-    //    r = sqrt(pow((x - x1), 2) + pow((y - y1), 2) + pow((z - z1), 2));
-    //}
-
-    double r = DELTA_UPPER_LINK_LEN;
-
-    double A = pow(a1, 2) + pow(a2, 2) + 1;
-    double B = 2 * (a1 * b1 + a2 * (b2 - *y1) - *z1);
-    double C = pow(b1, 2) + pow((b2 - *y1), 2) + pow(*z1, 2) - pow(r, 2);
-
-    *z = (- B + sqrt(pow(B, 2) - 4.0 * A * C)) / (2.0 * A); // one being used
-    if (*z < 0)
-    {
-        *z = (- B - sqrt(pow(B, 2) - 4.0 * A * C)) / (2.0 * A);
-    }
-    *x = a1 * (*z) + b1;
-    *y = a2 * (*z) + b2;
+    double elbow[3][3], position[3], thetaA[3];
+    deltaKinematicsElbowPosition(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad, elbow, position, thetaA);
+    *x1 = elbow[0][0]; *y1 = elbow[0][1]; *z1 = elbow[0][2];
+    *x2 = elbow[1][0]; *y2 = elbow[1][1]; *z2 = elbow[1][2];
+    *x3 = elbow[2][0]; *y3 = elbow[2][1]; *z3 = elbow[2][2];
+    *x = position[0]; *y = position[1]; *z = position[2];
+    *theta_a1 = thetaA[0]; *theta_a2 = thetaA[1]; *theta_a3 = thetaA[2];
 }
 
 void GetThetaii (double *theta1_1, double *theta1_2, double *theta1_3, 
                  double *theta2_1, double *theta2_2, double *theta2_3,
                  double *theta3_1, double *theta3_2, double *theta3_3)
 {
-    double x1, y1, z1, x2, y2, z2, x3, y3, z3, x, y, z;
-    double theta_a1, theta_a2, theta_a3;
-    GetElbowPosition(&x1, &y1, &z1, &x2, &y2, &z2, &x3, &y3, &z3, &x, &y, &z, &theta_a1, &theta_a2, &theta_a3);
-
-    // variable declaration
-    double Ax1 = DELTA_BASE_RADIUS * cos(270.0 * PI / 180.0);
-    double Ay1 = DELTA_BASE_RADIUS * sin(270.0 * PI / 180.0);
-    double Az1 = 0;
-    double Ax2 = DELTA_BASE_RADIUS * cos(30.0 * PI / 180.0) * cos(DELTA_THETA_N2) + DELTA_BASE_RADIUS * sin(30.0 * PI / 180.0) * sin(DELTA_THETA_N2);
-    double Ay2 = - DELTA_BASE_RADIUS * cos(30.0 * PI / 180.0) * sin(DELTA_THETA_N2) + DELTA_BASE_RADIUS * sin(30.0 * PI / 180.0) * cos(DELTA_THETA_N2);
-    double Az2 = 0;
-    double Ax3 = DELTA_BASE_RADIUS * cos(150.0 * PI / 180.0) * cos(DELTA_THETA_N3) + DELTA_BASE_RADIUS * sin(150.0 * PI / 180.0) * sin(DELTA_THETA_N3);
-    double Ay3 = - DELTA_BASE_RADIUS * cos(150.0 * PI / 180.0) * sin(DELTA_THETA_N3) + DELTA_BASE_RADIUS * sin(150.0 * PI / 180.0) * cos(DELTA_THETA_N3);
-    double Az3 = 0;
-    // Base joint position
-    double Bx1 = x1;
-    double By1 = y1;
-    double Bz1 = z1;
-    double Bx2 = x2 * cos(DELTA_THETA_N2) + y2 * sin(DELTA_THETA_N2); 
-    double By2 = - x2 * sin(DELTA_THETA_N2) + y2 * cos(DELTA_THETA_N2); 
-    double Bz2 = z2; 
-    double Bx3 = x3 * cos(DELTA_THETA_N3) + y3 * sin(DELTA_THETA_N3); 
-    double By3 = - x3 * sin(DELTA_THETA_N3) + y3 * cos(DELTA_THETA_N3); 
-    double Bz3 = z3; 
-    // Endeffector position
-    double Cx1 = x;
-    double Cy1 = y;
-    double Cz1 = z;
-    double Cx2 = x * cos(DELTA_THETA_N2) + y * sin(DELTA_THETA_N2);
-    double Cy2 = - x * sin(DELTA_THETA_N2) + y * cos(DELTA_THETA_N2);
-    double Cz2 = z;
-    double Cx3 = x * cos(DELTA_THETA_N3) + y * sin(DELTA_THETA_N3);
-    double Cy3 = - x * sin(DELTA_THETA_N3) + y * cos(DELTA_THETA_N3);
-    double Cz3 = z;
-    // Theta3i & theta2i
-    double Distance1 = sqrt(pow(Ax1 - Cx1, 2) + pow(Ay1 - Cy1, 2) + pow(Az1 - Cz1, 2));
-    double Distance2 = sqrt(pow(Ax2 - Cx2, 2) + pow(Ay2 - Cy2, 2) + pow(Az2 - Cz2, 2));
-    double Distance3 = sqrt(pow(Ax3 - Cx3, 2) + pow(Ay3 - Cy3, 2) + pow(Az3 - Cz3, 2));
-
-    *theta1_1 = theta_a1;
-    *theta1_2 = theta_a2;
-    *theta1_3 = theta_a3;
-    *theta3_1 = fmod(PI + atan((Cz1 - Bz1) / (Cx1 - Bx1)), PI);
-    *theta3_2 = fmod(PI + atan((Cz2 - Bz2) / (Cx2 - Bx2)), PI);
-    *theta3_3 = fmod(PI + atan((Cz3 - Bz3) / (Cx3 - Bx3)), PI);
-    *theta2_1 = PI - acos(-(pow(Distance1,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_1)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_1)));
-    *theta2_2 = PI - acos(-(pow(Distance2,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_2)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_2)));
-    *theta2_3 = PI - acos(-(pow(Distance3,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_3)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_3)));
+    double theta1i[3], theta2i[3], theta3i[3];
+    deltaKinematicsThetaii(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad, theta1i, theta2i, theta3i);
+    *theta1_1 = theta1i[0]; *theta1_2 = theta1i[1]; *theta1_3 = theta1i[2];
+    *theta2_1 = theta2i[0]; *theta2_2 = theta2i[1]; *theta2_3 = theta2i[2];
+    *theta3_1 = theta3i[0]; *theta3_2 = theta3i[1]; *theta3_3 = theta3i[2];
 }
 
 void DeltaThumbGetJacobian (double *J11, double *J12, double *J13, 
                             double *J21, double *J22, double *J23, 
                             double *J31, double *J32, double *J33)
 {
-    double theta1_1, theta1_2, theta1_3, theta2_1, theta2_2, theta2_3, theta3_1, theta3_2, theta3_3;
-
-    GetThetaii(&theta1_1, &theta1_2, &theta1_3, 
-               &theta2_1, &theta2_2, &theta2_3,
-               &theta3_1, &theta3_2, &theta3_3);
-
-    // jacobian variables
-    double J1x = - sin(theta3_1) * cos(theta2_1 + theta1_1) * sin(DELTA_THETA_N1) + cos(theta3_1) * cos(DELTA_THETA_N1);
-    double J1y = - sin(theta3_1) * cos(theta2_1 + theta1_1) * cos(DELTA_THETA_N1) - cos(theta3_1) * sin(DELTA_THETA_N1);
-    double J1z = sin(theta3_1) * sin(theta2_1 + theta1_1);
-
-    double J2x = - sin(theta3_2) * cos(theta2_2 + theta1_2) * sin(DELTA_THETA_N3) + cos(theta3_2) * cos(DELTA_THETA_N3);
-    double J2y = - sin(theta3_2) * cos(theta2_2 + theta1_2) * cos(DELTA_THETA_N3) - cos(theta3_2) * sin(DELTA_THETA_N3);
-    double J2z = sin(theta3_2) * sin(theta2_2 + theta1_2);
-
-    double J3x = - sin(theta3_3) * cos(theta2_3 + theta1_3) * sin(DELTA_THETA_N2) + cos(theta3_3) * cos(DELTA_THETA_N2);
-    double J3y = - sin(theta3_3) * cos(theta2_3 + theta1_3) * cos(DELTA_THETA_N2) - cos(theta3_3) * sin(DELTA_THETA_N2);
-    double J3z = sin(theta3_3) * sin(theta2_3 + theta1_3);
-
-    double Jqa = (DELTA_LOWER_LINK_LEN * sin(theta2_1) * sin(theta3_1));
-    double Jqb = (DELTA_LOWER_LINK_LEN * sin(theta2_2) * sin(theta3_2));
-    double Jqc = (DELTA_LOWER_LINK_LEN * sin(theta2_3) * sin(theta3_3));
-
-    double det = (J1x*J2y*J3z - J1x*J3y*J2z - J2x*J1y*J3z + J2x*J3y*J1z + J3x*J1y*J2z - J3x*J2y*J1z);
-
-    *J11 = (Jqa*(J2y*J3z - J3y*J2z))/det;
-    *J12 = -(Jqa*(J2x*J3z - J3x*J2z))/det;
-    *J13 = (Jqa*(J2x*J3y - J3x*J2y))/det;
-    *J21 = -(Jqb*(J1y*J3z - J3y*J1z))/det;
-    *J22 = (Jqb*(J1x*J3z - J3x*J1z))/det;
-    *J23 = -(Jqb*(J1x*J3y - J3x*J1y))/det;
-    *J31 = (Jqc*(J1y*J2z - J2y*J1z))/det;
-    *J32 = -(Jqc*(J1x*J2z - J2x*J1z))/det;
-    *J33 = (Jqc*(J1x*J2y - J2x*J1y))/det;
+    double J[3][3];
+    deltaKinematicsJacobianMouse(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad, J);
+    *J11 = J[0][0]; *J12 = J[0][1]; *J13 = J[0][2];
+    *J21 = J[1][0]; *J22 = J[1][1]; *J23 = J[1][2];
+    *J31 = J[2][0]; *J32 = J[2][1]; *J33 = J[2][2];
 }
 
 void ForceApp (void)
@@ -669,45 +583,47 @@ void DeltaThumbGetJacobian_OhioVersion (double *J11, double *J12, double *J13,
                                         double *J21, double *J22, double *J23, 
                                         double *J31, double *J32, double *J33)
 {
-    // delta variables
-    static double a = DELTA_WB - DELTA_UP;
-    double b = DELTA_SP / 2 - (sqrt(3)/2) * DELTA_WB;
-    static double c = DELTA_WP - DELTA_WB/2;
-    static double L = DELTA_UPPER_LINK_LEN;
-
-    double x = deltaThumbX;
-    double y = deltaThumbY;
-    double z = deltaThumbZ;
-    double theta1 = ThetaMotor1Rad;
-    double theta2 = ThetaMotor2Rad;
-    double theta3 = ThetaMotor3Rad;
-
-    // jacobian variables
-    double J1x = x;
-    double J1y = y + a + L * cos(theta1);
-    double J1z = z + L * sin(theta1);
-
-    double J2x = 2 * (x + b) - sqrt(3) * L * cos(theta2);
-    double J2y = 2 * (y + c) - L * cos(theta2);
-    double J2z = 2 * (z + L * sin(theta2));
-
-    double J3x = 2 * (x - b) + sqrt(3) * L *cos(theta3);
-    double J3y = 2 * (y + c) - L * cos(theta3);
-    double J3z = 2 * (z + L * sin(theta3));
-
-    double Jqa = L * ((y + a) * sin(theta1) - z * cos(theta1));
-    double Jqb = -L * ((sqrt(3) * (x + b) + y + c) * sin(theta2) + 2 * z * cos(theta2));
-    double Jqc = L * ((sqrt(3) * (x - b) - y - c) * sin(theta3) - 2 * z *cos(theta3));
-
-    double det = (J1x*J2y*J3z - J1x*J3y*J2z - J2x*J1y*J3z + J2x*J3y*J1z + J3x*J1y*J2z - J3x*J2y*J1z);
-
-    *J11 = (Jqa*(J2y*J3z - J3y*J2z))/det;
-    *J12 = -(Jqa*(J2x*J3z - J3x*J2z))/det;
-    *J13 = (Jqa*(J2x*J3y - J3x*J2y))/det;
-    *J21 = -(Jqb*(J1y*J3z - J3y*J1z))/det;
-    *J22 = (Jqb*(J1x*J3z - J3x*J1z))/det;
-    *J23 = -(Jqb*(J1x*J3y - J3x*J1y))/det;
-    *J31 = (Jqc*(J1y*J2z - J2y*J1z))/det;
-    *J32 = -(Jqc*(J1x*J2z - J2x*J1z))/det;
-    *J33 = (Jqc*(J1x*J2y - J2x*J1y))/det;
+    double J[3][3];
+    deltaKinematicsJacobianOhio(deltaThumbX, deltaThumbY, deltaThumbZ,
+                                ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad, J);
+    *J11 = J[0][0]; *J12 = J[0][1]; *J13 = J[0][2];
+    *J21 = J[1][0]; *J22 = J[1][1]; *J23 = J[1][2];
+    *J31 = J[2][0]; *J32 = J[2][1]; *J33 = J[2][2];
+}
+
+/*******************************************************************************
+  * @name   deltaThumbUpdateJacobian
+  * @brief  Analytic Jacobian (deltaKinematicsJacobian) at the pose of the
+            last deltaThumbHandler, computed the first time it is asked for
+            after each handler pass. Keeps the last one if the point does
+            not exist.
+  * @retval None.
+  */
+void deltaThumbUpdateJacobian (void)
+{
+    double thumb[3];
+
+    if (deltaThumbJacobianValid || !deltaThumbRawValid) return;
+    deltaKinematicsJacobian(ThetaMotor1Rad, ThetaMotor2Rad, ThetaMotor3Rad,
+                            deltaThumbRaw[0], deltaThumbRaw[1], deltaThumbRaw[2], deltaThumbRawJacobian);
+    deltaKinematicsToThumbFrame(deltaThumbRaw, deltaThumbRawJacobian, thumb, deltaThumbJacobian);
+    deltaThumbJacobianValid = 1;
+    countJacobianEvaluation();
+}
+
+/*******************************************************************************
+  * @name   DeltaThumbGetJacobian_Fused
+  * @brief  Analytic Jacobian (deltaKinematicsJacobian), thumb frame, at the
+            unsmoothed pose that matches the motor angles. Evaluated on the
+            first call after each deltaThumbHandler (deltaThumbUpdateJacobian).
+  * @retval None.
+  */
+void DeltaThumbGetJacobian_Fused (double *J11, double *J12, double *J13, 
+                                  double *J21, double *J22, double *J23, 
+                                  double *J31, double *J32, double *J33)
+{
+    deltaThumbUpdateJacobian();
+    *J11 = deltaThumbJacobian[0][0]; *J12 = deltaThumbJacobian[0][1]; *J13 = deltaThumbJacobian[0][2];
+    *J21 = deltaThumbJacobian[1][0]; *J22 = deltaThumbJacobian[1][1]; *J23 = deltaThumbJacobian[1][2];
+    *J31 = deltaThumbJacobian[2][0]; *J32 = deltaThumbJacobian[2][1]; *J33 = deltaThumbJacobian[2][2];
 }
\ No newline at end of file
@@ -16,31 +16,7 @@
 #endif
 
 #include "main.h"
-
-// MATH
-#define PI 3.14159265358979323846
-#define DEG_TO_RAD(degrees) ((degrees) * (PI / 180.0))
-#define RAD_TO_DEG(radians) ((radians) * (180.0 / PI))
-
-// DELTA DEVICE CONSTANTS
-#define DELTA_BASE_RADIUS 31.2 // base radius - distance from origin to base joint
-#define DELTA_END_EFFECTOR_RADIUS 25 // distance from platform's origin to platform joint
-// Thetas that motors are positioned at
-#define DELTA_THETA_N1 0.0
-#define DELTA_THETA_N2 120.0 * PI / 180.0
-#define DELTA_THETA_N3 240.0 * PI / 180.0
-#define DELTA_LOWER_LINK_LEN 30.0
-#define DELTA_UPPER_LINK_LEN 60.0
-
-#define DELTA_THETA_OFFSET  (18.1) * PI / 180.0
-
-// P = platform, B = base
-#define DELTA_WP 7.22 // end effector origin to edge perpendicular
-#define DELTA_UP 14.43 // end effector origin to corner
-#define DELTA_WB 35.0  // base origin to edge perpendicular
-#define DELTA_UB 70.0  // base origin to corner
-#define DELTA_SP 25.0  // edge length of end effector
-#define DELTA_SB 121.24 // edge length of base
+#include "delta_kinematics.h"
 
 
 // HAPTIC CONSTANTS
@@ -98,6 +74,10 @@ void DeltaThumbGetJacobian (double *J11, double *J12, double *J13,
 void DeltaThumbGetJacobian_OhioVersion (double *J11, double *J12, double *J13, 
                                         double *J21, double *J22, double *J23, 
                                         double *J31, double *J32, double *J33);
+void DeltaThumbGetJacobian_Fused (double *J11, double *J12, double *J13, 
+                                  double *J21, double *J22, double *J23, 
+                                  double *J31, double *J32, double *J33);
+void deltaThumbUpdateJacobian (void);
 
                                         
 void ForceApp (void);
@@ -113,6 +93,10 @@ int delta_calcForward(double theta1, double theta2, double theta3, double *x0, d
 void reportPosition();
 void reportAngles();
 int testInWorkspace(double x, double y, double z);
+double deltaThumbForceScale( void );
+void deltaThumbServoStop( void );
+int deltaThumbServoArrived( void );
+void getDeltaThumbServoTorque(double *torque1, double *torque2, double *torque3);
 void setupMotors(int pin1,int pin2, int pin3);
 // End DeltaZ functions ////////////////////
 
@@ -0,0 +1,102 @@
+/**
+  ******************************************************************************
+  * @file    delta_workspace.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   O(1) lookups in the delta thumb workspace map (delta_workspace.h),
+  *          so the renderer does not compute a condition number every tick.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "delta_workspace.h"
+#include "delta_kinematics.h"
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   deltaWorkspaceLookup
+  * @brief  Level of the voxel holding (x, y, z) in a map laid out like
+  *         deltaWorkspaceTable (tools/gen_delta_workspace.c checks the map it
+  *         builds with this).
+  * @param  table: DELTA_WORKSPACE_BYTES bytes, two voxels per byte.
+  * @param  x, y, z: delta_calcForward frame, mm.
+  * @retval 0 if unreachable (or outside the map), 1..DELTA_WORKSPACE_LEVELS
+  *         for the conditioning there.
+  */
+int deltaWorkspaceLookup( const uint8_t *table, double x, double y, double z )
+{
+    double fx = (x - DELTA_WORKSPACE_X_MIN) / DELTA_WORKSPACE_VOXEL;
+    double fy = (y - DELTA_WORKSPACE_Y_MIN) / DELTA_WORKSPACE_VOXEL;
+    double fz = (z - DELTA_WORKSPACE_Z_MIN) / DELTA_WORKSPACE_VOXEL;
+
+    // compare as doubles first, NaN and huge values fail here too
+    if (!(fx >= 0.0 && fx < DELTA_WORKSPACE_NX && fy >= 0.0 && fy < DELTA_WORKSPACE_NY &&
+          fz >= 0.0 && fz < DELTA_WORKSPACE_NZ))
+    {
+        return 0;
+    }
+    int index = ((int)fz * DELTA_WORKSPACE_NY + (int)fy) * DELTA_WORKSPACE_NX + (int)fx;
+    uint8_t pair = table[index >> 1];
+    return (index & 1) ? (pair >> 4) : (pair & 0x0F);
+}
+
+/*******************************************************************************
+  * @name   deltaWorkspaceLevel
+  * @brief  Level of the voxel holding (x, y, z) in the flash map.
+  * @param  x, y, z: delta_calcForward frame, mm.
+  * @retval 0 if unreachable, 1..DELTA_WORKSPACE_LEVELS otherwise.
+  */
+int deltaWorkspaceLevel( double x, double y, double z )
+{
+    return deltaWorkspaceLookup(deltaWorkspaceTable, x, y, z);
+}
+
+/*******************************************************************************
+  * @name   deltaWorkspaceReachable
+  * @brief  Whether the thumb can be sent to (x, y, z): the map answers inside
+  *         the reachable voxels, anywhere else inverse kinematics inside the
+  *         joint range the map was made for decides.
+  * @param  x, y, z: delta_calcForward frame, mm.
+  * @retval 1 if reachable, 0 if not.
+  */
+int deltaWorkspaceReachable( double x, double y, double z )
+{
+    double t1, t2, t3;
+    const double low = DEG_TO_RAD(DELTA_WORKSPACE_MIN_ANGLE_DEG);
+    const double high = DEG_TO_RAD(DELTA_WORKSPACE_MAX_ANGLE_DEG);
+
+    if (deltaWorkspaceLevel(x, y, z) > 0)
+    {
+        return 1;
+    }
+    if (deltaKinematicsInverse(x, y, z, &t1, &t2, &t3) != 0)
+    {
+        return 0;
+    }
+    return (t1 >= low) && (t1 <= high) && (t2 >= low) && (t2 <= high) && (t3 >= low) && (t3 <= high);
+}
+
+/*******************************************************************************
+  * @name   deltaWorkspaceForceScale
+  * @brief  Factor for the rendered force: 1 in the well conditioned part of
+  *         the workspace, going down linearly below
+  *         DELTA_WORKSPACE_SATURATE_LEVEL where the torques for a given force
+  *         grow without bound. Level 0 (outside the map or the joint range
+  *         it was made for) says nothing about the conditioning, so the
+  *         force is left as it is there.
+  * @param  x, y, z: delta_calcForward frame, mm.
+  * @retval 1/DELTA_WORKSPACE_SATURATE_LEVEL to 1.
+  */
+double deltaWorkspaceForceScale( double x, double y, double z )
+{
+    int level = deltaWorkspaceLevel(x, y, z);
+
+    if ((level == 0) || (level >= DELTA_WORKSPACE_SATURATE_LEVEL))
+    {
+        return 1.0;
+    }
+    return (double)level / DELTA_WORKSPACE_SATURATE_LEVEL;
+}
+//EOF
@@ -0,0 +1,57 @@
+/**
+  ******************************************************************************
+  * @file    delta_workspace.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Precomputed workspace and conditioning map of the delta thumb.
+  *          A box around the reachable volume (delta_calcForward frame, mm)
+  *          is cut into voxels, each holding a 4 bit level: 0 if no point of
+  *          it can be reached inside the joint range, 1..15 for the inverse
+  *          condition number of the Jacobian (1/15 = close to a singularity,
+  *          15 = isotropic). The table is const so it stays in flash; it is
+  *          written by tools/gen_delta_workspace.c into delta_workspace_table.c
+  *          and must be regenerated if the geometry or the limits change.
+  ******************************************************************************
+  */
+#ifndef __DELTA_WORKSPACE_H_
+#define __DELTA_WORKSPACE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+// Voxel grid, delta_calcForward frame
+#define DELTA_WORKSPACE_VOXEL       3.0     // mm
+#define DELTA_WORKSPACE_X_MIN       (-60.0)
+#define DELTA_WORKSPACE_Y_MIN       (-60.0)
+#define DELTA_WORKSPACE_Z_MIN       (-92.0)
+#define DELTA_WORKSPACE_NX          40
+#define DELTA_WORKSPACE_NY          40
+#define DELTA_WORKSPACE_NZ          24
+#define DELTA_WORKSPACE_BYTES       ((DELTA_WORKSPACE_NX * DELTA_WORKSPACE_NY * DELTA_WORKSPACE_NZ + 1) / 2)
+
+// Joint range the table was generated for (motor angles as deltaThumbHandler reads them)
+#define DELTA_WORKSPACE_MIN_ANGLE_DEG   (-60.0)
+#define DELTA_WORKSPACE_MAX_ANGLE_DEG   80.0
+
+#define DELTA_WORKSPACE_LEVELS          15
+// Levels 1 up to this scale the rendered force down linearly, 0 leaves it (see deltaWorkspaceForceScale)
+#define DELTA_WORKSPACE_SATURATE_LEVEL  3
+
+extern const uint8_t deltaWorkspaceTable[DELTA_WORKSPACE_BYTES];
+
+/******* Function prototypes ****/
+int deltaWorkspaceLookup( const uint8_t *table, double x, double y, double z );
+int deltaWorkspaceLevel( double x, double y, double z );
+int deltaWorkspaceReachable( double x, double y, double z );
+double deltaWorkspaceForceScale( double x, double y, double z );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__DELTA_WORKSPACE_H_
+//EOF
@@ -0,0 +1,1215 @@
+/**
+  ******************************************************************************
+  * @file    delta_workspace_table.c
+  * @brief   Delta thumb workspace map, 40 x 40 x 24 voxels of 3.0 mm.
+  *          Generated by tools/gen_delta_workspace.c, do not edit.
+  ******************************************************************************
+  */
+
+#include "delta_workspace.h"
+
+// two voxels per byte, even index in the low nibble
+const uint8_t deltaWorkspaceTable[DELTA_WORKSPACE_BYTES] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22,
+    0x22, 0x33, 0x33, 0x22, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x33, 0x33, 0x22,
+    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x32, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x23,
+    0x22, 0x32, 0x23, 0x22, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x22, 0x32, 0x33, 0x33, 0x23, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x32, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x32, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x32, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x32, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x23, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x22, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x32, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x32,
+    0x33, 0x33, 0x33, 0x33, 0x23, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x22, 0x22, 0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x32, 0x33, 0x33, 0x23, 0x22, 0x22, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x32, 0x23, 0x22,
+    0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+    0x22, 0x32, 0x23, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x22, 0x32, 0x23, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x23, 0x22, 0x22, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x22, 0x33, 0x33, 0x33, 0x33,
+    0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x23, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x33, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x32, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x22, 0x32, 0x33, 0x43, 0x44, 0x44, 0x34, 0x33, 0x23, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x22, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x32, 0x33, 0x33, 0x33, 0x33,
+    0x23, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22,
+    0x33, 0x33, 0x33, 0x33, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x22, 0x22, 0x33, 0x33, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x22, 0x33, 0x33, 0x22, 0x23, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x23, 0x22, 0x22, 0x32, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44,
+    0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x33, 0x43, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x23, 0x32, 0x43, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x23, 0x32,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x32, 0x43, 0x44, 0x44, 0x55, 0x55, 0x44,
+    0x44, 0x34, 0x23, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x33, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x32, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x32, 0x33, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x23, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x33,
+    0x33, 0x44, 0x44, 0x33, 0x33, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x22, 0x32, 0x33, 0x33, 0x33, 0x33, 0x23, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x32, 0x33, 0x33, 0x33, 0x33, 0x23, 0x22, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x22, 0x23, 0x32, 0x22, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x22, 0x33, 0x33, 0x22,
+    0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44,
+    0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x33, 0x43, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x44, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x44,
+    0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x33, 0x44, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x22, 0x32, 0x43, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x23, 0x22,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x33, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x43,
+    0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x22, 0x32, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x22, 0x22, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x23, 0x32, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x22, 0x23, 0x32, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x22, 0x33, 0x33, 0x22, 0x33, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+    0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x44, 0x55, 0x55, 0x44,
+    0x44, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44,
+    0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x33, 0x44, 0x54, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x45, 0x44, 0x33,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x44, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x32, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x23,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x43, 0x44,
+    0x44, 0x55, 0x55, 0x44, 0x44, 0x34, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x32, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x23, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x23, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x33, 0x43, 0x44, 0x44, 0x34,
+    0x33, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x22, 0x33, 0x33, 0x22, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44, 0x34,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x44, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55, 0x44, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x56,
+    0x55, 0x55, 0x44, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x43, 0x54, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x45, 0x34, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x34,
+    0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x55, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x43, 0x44, 0x55, 0x55,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+    0x33, 0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x44, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x44, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x22, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0x22, 0x32, 0x43, 0x44, 0x44, 0x54, 0x45, 0x44, 0x44, 0x34, 0x23, 0x22,
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44,
+    0x34, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x22, 0x33, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x22, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x22, 0x22, 0x22, 0x22,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x22, 0x32, 0x23, 0x22, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44,
+    0x44, 0x54, 0x45, 0x44, 0x44, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x45, 0x44, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x55, 0x55,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x44, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44,
+    0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44,
+    0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x44, 0x54, 0x55, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32,
+    0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x34, 0x23, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x32, 0x43, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x34,
+    0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x56,
+    0x55, 0x55, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x32, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x22,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x45,
+    0x44, 0x34, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x22, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x43, 0x34, 0x33,
+    0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x33, 0x43, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x22, 0x22, 0x22, 0x22,
+    0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x44, 0x55, 0x55, 0x44,
+    0x44, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x34, 0x43, 0x44, 0x55, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x55, 0x44, 0x34,
+    0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x44, 0x55, 0x55, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+    0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45,
+    0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x56, 0x55, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43,
+    0x54, 0x55, 0x66, 0x66, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x55, 0x45,
+    0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x56, 0x55, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55, 0x65, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33,
+    0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x32, 0x44, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44,
+    0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x55, 0x45, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x43, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+    0x33, 0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x22, 0x32, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x23,
+    0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x43, 0x44,
+    0x54, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x22, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x43, 0x34, 0x33,
+    0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x22, 0x22, 0x22, 0x22, 0x32, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x23, 0x32, 0x33, 0x33, 0x23,
+    0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x44, 0x44, 0x54, 0x45, 0x44, 0x44, 0x44, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x34, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+    0x43, 0x44, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55, 0x44, 0x34, 0x43, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x65, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44,
+    0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x77, 0x77, 0x66, 0x66, 0x66, 0x56, 0x55,
+    0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67,
+    0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66,
+    0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44,
+    0x55, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x55,
+    0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77,
+    0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66,
+    0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x22, 0x43,
+    0x54, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x43, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44,
+    0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x56, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x44, 0x54, 0x55, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32,
+    0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x34, 0x23, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x33,
+    0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x45, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x33, 0x44, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x22, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x03,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33,
+    0x43, 0x33, 0x33, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x43, 0x33, 0x33, 0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x22, 0x22, 0x22, 0x22, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33,
+    0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x45, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x55, 0x55,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45,
+    0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x65, 0x66, 0x66,
+    0x66, 0x77, 0x77, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44,
+    0x55, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x54, 0x55, 0x66, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55,
+    0x45, 0x33, 0x00, 0x00, 0x00, 0x30, 0x43, 0x54, 0x55, 0x66, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77,
+    0x67, 0x66, 0x66, 0x55, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x43, 0x54, 0x55, 0x66, 0x66, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x33, 0x54,
+    0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x45, 0x33, 0x03, 0x00,
+    0x00, 0x30, 0x33, 0x54, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55,
+    0x45, 0x33, 0x03, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x66, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x66, 0x66, 0x76,
+    0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x30, 0x33, 0x44,
+    0x55, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x03, 0x00,
+    0x00, 0x30, 0x33, 0x43, 0x54, 0x65, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x56, 0x45,
+    0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x22, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x66,
+    0x66, 0x66, 0x55, 0x45, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x65, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32,
+    0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x23, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x32, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x34,
+    0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x55, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x54, 0x55,
+    0x55, 0x65, 0x56, 0x55, 0x55, 0x45, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20,
+    0x32, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x23, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x34, 0x33, 0x33,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44,
+    0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33,
+    0x43, 0x44, 0x44, 0x34, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0x22, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x22, 0x22, 0x22, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x43, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x44,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55,
+    0x55, 0x55, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+    0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55,
+    0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x65, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67,
+    0x66, 0x66, 0x56, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x66, 0x66, 0x76,
+    0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54,
+    0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x45, 0x44, 0x04, 0x00,
+    0x00, 0x40, 0x44, 0x54, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56,
+    0x45, 0x44, 0x04, 0x00, 0x00, 0x30, 0x43, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x67, 0x66, 0x56, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x43, 0x54, 0x65, 0x66, 0x76, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x43, 0x54,
+    0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x45, 0x34, 0x03, 0x00,
+    0x00, 0x30, 0x43, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56,
+    0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x43, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x67, 0x66, 0x56, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x43, 0x54, 0x55, 0x66, 0x76, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x45, 0x34, 0x03, 0x00, 0x00, 0x30, 0x33, 0x44,
+    0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00,
+    0x00, 0x30, 0x33, 0x44, 0x55, 0x66, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55,
+    0x44, 0x33, 0x03, 0x00, 0x00, 0x20, 0x32, 0x43, 0x55, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77,
+    0x67, 0x66, 0x56, 0x55, 0x34, 0x23, 0x02, 0x00, 0x00, 0x20, 0x22, 0x43, 0x54, 0x55, 0x66, 0x66,
+    0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x45, 0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x22, 0x33,
+    0x44, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00,
+    0x00, 0x00, 0x22, 0x32, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44,
+    0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x55, 0x45, 0x34, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x33, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x33, 0x43, 0x44, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x44, 0x34, 0x33, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x54, 0x55, 0x55, 0x45,
+    0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43,
+    0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x23, 0x22, 0x22, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x33, 0x23, 0x22, 0x22, 0x32, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44,
+    0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44,
+    0x44, 0x54, 0x45, 0x44, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x34, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x43, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55, 0x55, 0x65, 0x56, 0x55, 0x55, 0x55, 0x44, 0x44,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x65, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+    0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x54, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x55,
+    0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x66, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77,
+    0x67, 0x66, 0x66, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00, 0x40, 0x44, 0x55, 0x65, 0x66, 0x76, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x55, 0x44, 0x04, 0x00, 0x00, 0x40, 0x44, 0x55,
+    0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x55, 0x44, 0x04, 0x00,
+    0x00, 0x40, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66,
+    0x55, 0x44, 0x04, 0x00, 0x00, 0x30, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x66, 0x66, 0x55, 0x44, 0x03, 0x00, 0x00, 0x30, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x44, 0x03, 0x00, 0x00, 0x33, 0x44, 0x55,
+    0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x44, 0x33, 0x00,
+    0x00, 0x33, 0x43, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66,
+    0x55, 0x34, 0x33, 0x00, 0x00, 0x33, 0x43, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x66, 0x66, 0x55, 0x34, 0x33, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x66, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45, 0x34, 0x33, 0x00, 0x00, 0x33, 0x43, 0x54,
+    0x65, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45, 0x34, 0x33, 0x00,
+    0x00, 0x30, 0x33, 0x54, 0x55, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55,
+    0x45, 0x33, 0x03, 0x00, 0x00, 0x20, 0x32, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x66, 0x66, 0x55, 0x44, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x43, 0x55, 0x65, 0x66, 0x76,
+    0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x55, 0x34, 0x23, 0x02, 0x00, 0x00, 0x20, 0x22, 0x43,
+    0x54, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x45, 0x34, 0x22, 0x02, 0x00,
+    0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x66, 0x66, 0x66, 0x55, 0x44,
+    0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x56, 0x55, 0x44, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x43, 0x54, 0x55, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22,
+    0x33, 0x44, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x33, 0x22, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x33,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x34, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44,
+    0x44, 0x55, 0x55, 0x44, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+    0x23, 0x22, 0x22, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x44, 0x44,
+    0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x33, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x44, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x56, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x55, 0x55, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54,
+    0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x54, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56,
+    0x45, 0x44, 0x00, 0x00, 0x00, 0x40, 0x44, 0x55, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x67, 0x66, 0x56, 0x55, 0x44, 0x04, 0x00, 0x00, 0x40, 0x44, 0x55, 0x66, 0x66, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x55, 0x44, 0x04, 0x00, 0x00, 0x40, 0x44, 0x55,
+    0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x44, 0x04, 0x00,
+    0x00, 0x40, 0x54, 0x55, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66,
+    0x55, 0x45, 0x04, 0x00, 0x00, 0x44, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x67, 0x66, 0x56, 0x45, 0x44, 0x00, 0x00, 0x33, 0x54, 0x65, 0x66, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65,
+    0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x44, 0x55, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66,
+    0x55, 0x44, 0x33, 0x00, 0x00, 0x33, 0x44, 0x55, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x67, 0x66, 0x55, 0x44, 0x33, 0x00, 0x00, 0x33, 0x43, 0x55, 0x66, 0x76, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x34, 0x33, 0x00, 0x00, 0x33, 0x43, 0x55,
+    0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x34, 0x33, 0x00,
+    0x00, 0x22, 0x43, 0x54, 0x65, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56,
+    0x45, 0x34, 0x22, 0x00, 0x00, 0x22, 0x33, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x67, 0x66, 0x56, 0x45, 0x33, 0x22, 0x00, 0x00, 0x20, 0x32, 0x44, 0x55, 0x66, 0x76, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x44, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x43,
+    0x55, 0x65, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x55, 0x34, 0x23, 0x02, 0x00,
+    0x00, 0x20, 0x22, 0x43, 0x54, 0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x45,
+    0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x66,
+    0x66, 0x66, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x32, 0x43, 0x54, 0x55, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+    0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x33, 0x43, 0x54, 0x55, 0x65, 0x66, 0x66, 0x56, 0x55, 0x45, 0x34, 0x33,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44,
+    0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x43, 0x44, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x44, 0x34, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x44, 0x44, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x66, 0x66, 0x66,
+    0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x55, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54,
+    0x65, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x66, 0x56, 0x45, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x44, 0x55, 0x66, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66,
+    0x55, 0x44, 0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
+    0x77, 0x77, 0x66, 0x66, 0x55, 0x45, 0x04, 0x00, 0x00, 0x40, 0x54, 0x65, 0x66, 0x76, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x45, 0x04, 0x00, 0x00, 0x40, 0x54, 0x65,
+    0x66, 0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67, 0x66, 0x56, 0x45, 0x04, 0x00,
+    0x00, 0x44, 0x54, 0x65, 0x66, 0x77, 0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x66,
+    0x56, 0x45, 0x44, 0x00, 0x00, 0x44, 0x54, 0x65, 0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66,
+    0x76, 0x77, 0x77, 0x66, 0x56, 0x45, 0x44, 0x00, 0x00, 0x33, 0x54, 0x65, 0x66, 0x77, 0x77, 0x67,
+    0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65,
+    0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x54, 0x65, 0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x77, 0x66,
+    0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65, 0x66, 0x77, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66,
+    0x76, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x44, 0x65, 0x66, 0x77, 0x77, 0x77,
+    0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x66, 0x56, 0x44, 0x33, 0x00, 0x00, 0x33, 0x43, 0x55,
+    0x66, 0x76, 0x77, 0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x77, 0x67, 0x66, 0x55, 0x34, 0x33, 0x00,
+    0x00, 0x22, 0x43, 0x55, 0x66, 0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67, 0x66,
+    0x55, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54, 0x65, 0x66, 0x77, 0x77, 0x77, 0x67, 0x76, 0x77,
+    0x77, 0x77, 0x66, 0x56, 0x45, 0x34, 0x22, 0x00, 0x00, 0x22, 0x33, 0x54, 0x65, 0x66, 0x77, 0x77,
+    0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45, 0x33, 0x22, 0x00, 0x00, 0x20, 0x32, 0x44,
+    0x55, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x55, 0x44, 0x23, 0x02, 0x00,
+    0x00, 0x20, 0x32, 0x43, 0x54, 0x65, 0x66, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x66, 0x56, 0x45,
+    0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x22, 0x43, 0x54, 0x55, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77,
+    0x66, 0x66, 0x55, 0x45, 0x34, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x32, 0x44, 0x55, 0x65, 0x66,
+    0x66, 0x76, 0x67, 0x66, 0x66, 0x56, 0x55, 0x44, 0x23, 0x22, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22,
+    0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34, 0x22, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x33,
+    0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x44, 0x55, 0x55, 0x66, 0x66, 0x55,
+    0x55, 0x44, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x54,
+    0x55, 0x55, 0x55, 0x55, 0x45, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x22, 0x22, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33,
+    0x23, 0x22, 0x22, 0x32, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x44, 0x44, 0x54, 0x55, 0x55, 0x45,
+    0x44, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x44, 0x54, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x55, 0x65, 0x66, 0x66, 0x76, 0x77, 0x77, 0x67,
+    0x66, 0x66, 0x56, 0x55, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x66, 0x66, 0x76,
+    0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    0x65, 0x66, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x67, 0x66, 0x56, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x40, 0x54, 0x55, 0x66, 0x66, 0x77, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x66, 0x66,
+    0x55, 0x45, 0x04, 0x00, 0x00, 0x40, 0x54, 0x65, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x76, 0x67, 0x66, 0x56, 0x45, 0x04, 0x00, 0x00, 0x40, 0x54, 0x65, 0x66, 0x77, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x66, 0x56, 0x45, 0x04, 0x00, 0x00, 0x44, 0x54, 0x65,
+    0x66, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x66, 0x56, 0x45, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x67,
+    0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x76, 0x67, 0x66, 0x55, 0x44, 0x00, 0x00, 0x43, 0x54, 0x66, 0x76, 0x67, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x67, 0x66, 0x45, 0x34, 0x00, 0x00, 0x43, 0x54, 0x66,
+    0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x67, 0x66, 0x45, 0x34, 0x00,
+    0x00, 0x33, 0x54, 0x65, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x67,
+    0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x76, 0x67, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65, 0x76, 0x77, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x67, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x44, 0x65,
+    0x66, 0x77, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x66, 0x56, 0x44, 0x33, 0x00,
+    0x00, 0x33, 0x43, 0x55, 0x66, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x66,
+    0x55, 0x34, 0x33, 0x00, 0x00, 0x22, 0x43, 0x55, 0x66, 0x76, 0x67, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x76, 0x67, 0x66, 0x55, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54, 0x65, 0x76, 0x77, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x77, 0x67, 0x56, 0x45, 0x34, 0x22, 0x00, 0x00, 0x20, 0x32, 0x54,
+    0x65, 0x66, 0x77, 0x67, 0x66, 0x66, 0x66, 0x66, 0x76, 0x77, 0x66, 0x56, 0x45, 0x23, 0x02, 0x00,
+    0x00, 0x20, 0x32, 0x44, 0x55, 0x66, 0x76, 0x77, 0x66, 0x66, 0x66, 0x66, 0x77, 0x67, 0x66, 0x55,
+    0x44, 0x23, 0x02, 0x00, 0x00, 0x20, 0x22, 0x43, 0x54, 0x65, 0x66, 0x76, 0x77, 0x66, 0x66, 0x77,
+    0x67, 0x66, 0x56, 0x45, 0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x22, 0x33, 0x44, 0x55, 0x66, 0x66,
+    0x76, 0x77, 0x77, 0x67, 0x66, 0x66, 0x55, 0x44, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x43, 0x54, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x45, 0x34, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x45, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55,
+    0x55, 0x65, 0x56, 0x55, 0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x33, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x44, 0x54, 0x45, 0x44, 0x44, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x45, 0x44,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x22, 0x22, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x55,
+    0x55, 0x65, 0x56, 0x55, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x44, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x45, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45,
+    0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x66, 0x66, 0x66, 0x77, 0x77, 0x77, 0x77,
+    0x66, 0x66, 0x66, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x40, 0x54, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x45, 0x04, 0x00, 0x00, 0x40, 0x54, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x56, 0x45, 0x04, 0x00, 0x00, 0x40, 0x55, 0x66, 0x66, 0x66, 0x66, 0x56,
+    0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x55, 0x04, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x66, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66,
+    0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x65, 0x66, 0x66, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x66, 0x66, 0x56, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x43, 0x54, 0x66, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66,
+    0x66, 0x45, 0x34, 0x00, 0x00, 0x43, 0x54, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x66, 0x66, 0x66, 0x66, 0x45, 0x34, 0x00, 0x00, 0x33, 0x54, 0x65, 0x66, 0x66, 0x66, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x66, 0x66, 0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65,
+    0x76, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x67, 0x56, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x44, 0x65, 0x66, 0x67, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x76, 0x66,
+    0x56, 0x44, 0x33, 0x00, 0x00, 0x22, 0x43, 0x55, 0x66, 0x67, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55,
+    0x66, 0x66, 0x76, 0x66, 0x55, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54, 0x66, 0x76, 0x66, 0x66,
+    0x56, 0x55, 0x55, 0x65, 0x66, 0x66, 0x67, 0x66, 0x45, 0x34, 0x22, 0x00, 0x00, 0x22, 0x33, 0x54,
+    0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x65, 0x66, 0x66, 0x66, 0x66, 0x56, 0x45, 0x33, 0x22, 0x00,
+    0x00, 0x20, 0x32, 0x44, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55,
+    0x44, 0x23, 0x02, 0x00, 0x00, 0x20, 0x22, 0x43, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x55, 0x34, 0x22, 0x02, 0x00, 0x00, 0x00, 0x22, 0x33, 0x54, 0x65, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x45, 0x33, 0x22, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x43, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x34, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x45, 0x34, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55,
+    0x55, 0x66, 0x66, 0x55, 0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x55, 0x55, 0x44,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x32, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x33, 0x33, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x43, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x65,
+    0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x00, 0x00,
+    0x00, 0x50, 0x55, 0x65, 0x66, 0x66, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x66, 0x66,
+    0x56, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55,
+    0x55, 0x55, 0x65, 0x66, 0x66, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x66, 0x66, 0x56, 0x55, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x55, 0x05, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x66, 0x55, 0x55, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x55, 0x55, 0x66, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x66, 0x66, 0x55, 0x45, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x54, 0x55, 0x66,
+    0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x66, 0x55, 0x45, 0x44, 0x45, 0x44, 0x44, 0x54,
+    0x44, 0x54, 0x55, 0x66, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55,
+    0x45, 0x44, 0x44, 0x54, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x66, 0x55, 0x55, 0x55, 0x45, 0x44, 0x44, 0x54, 0x55, 0x55, 0x55, 0x66, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x43, 0x55, 0x66, 0x66, 0x66, 0x55, 0x55, 0x45, 0x44, 0x44, 0x54, 0x55, 0x55, 0x66, 0x66,
+    0x66, 0x55, 0x34, 0x00, 0x00, 0x43, 0x54, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x44, 0x54,
+    0x55, 0x66, 0x66, 0x66, 0x66, 0x45, 0x34, 0x00, 0x00, 0x33, 0x54, 0x66, 0x66, 0x66, 0x66, 0x55,
+    0x55, 0x44, 0x44, 0x55, 0x55, 0x66, 0x66, 0x66, 0x66, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x65,
+    0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x56, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x54, 0x65, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x66, 0x66, 0x66,
+    0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x43, 0x65, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x54, 0x55,
+    0x65, 0x66, 0x66, 0x66, 0x56, 0x34, 0x33, 0x00, 0x00, 0x22, 0x43, 0x55, 0x66, 0x66, 0x66, 0x66,
+    0x55, 0x45, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x55, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x56, 0x45, 0x34, 0x22, 0x00,
+    0x00, 0x20, 0x32, 0x54, 0x65, 0x66, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x66, 0x56,
+    0x45, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x43, 0x55, 0x66, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x55, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x66, 0x66,
+    0x66, 0x55, 0x55, 0x66, 0x66, 0x66, 0x56, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x44, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x55, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x44, 0x55,
+    0x65, 0x66, 0x66, 0x56, 0x55, 0x44, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x54, 0x55, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x55, 0x45,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x33, 0x33, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+    0x54, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x56, 0x55,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+    0x66, 0x66, 0x66, 0x56, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x66, 0x56, 0x65, 0x66,
+    0x66, 0x00, 0x00, 0x66, 0x66, 0x56, 0x65, 0x66, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x65,
+    0x66, 0x55, 0x55, 0x66, 0x06, 0x00, 0x00, 0x60, 0x66, 0x55, 0x55, 0x66, 0x56, 0x55, 0x00, 0x00,
+    0x00, 0x50, 0x55, 0x66, 0x56, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x65,
+    0x66, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x66, 0x56, 0x45, 0x54, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x45, 0x54, 0x65, 0x66, 0x55, 0x05, 0x00, 0x00, 0x44, 0x55, 0x66, 0x55, 0x45, 0x54, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x45, 0x54, 0x55, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x65, 0x66,
+    0x55, 0x45, 0x54, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x45, 0x54, 0x55, 0x66, 0x56, 0x44, 0x00,
+    0x00, 0x44, 0x65, 0x66, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55,
+    0x66, 0x56, 0x44, 0x00, 0x00, 0x44, 0x65, 0x66, 0x55, 0x55, 0x45, 0x44, 0x00, 0x00, 0x00, 0x00,
+    0x44, 0x54, 0x55, 0x55, 0x66, 0x56, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x56, 0x55, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x65, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x66, 0x55, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x55, 0x66, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x60, 0x66,
+    0x66, 0x55, 0x44, 0x00, 0x00, 0x43, 0x55, 0x66, 0x66, 0x06, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x00, 0x60, 0x66, 0x66, 0x55, 0x34, 0x00, 0x00, 0x43, 0x54, 0x66, 0x66, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x66, 0x45, 0x34, 0x00, 0x00, 0x33, 0x54, 0x66,
+    0x66, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x66, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x54, 0x65, 0x66, 0x06, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x60, 0x66,
+    0x56, 0x45, 0x33, 0x00, 0x00, 0x32, 0x44, 0x65, 0x66, 0x66, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00,
+    0x00, 0x00, 0x66, 0x66, 0x56, 0x44, 0x23, 0x00, 0x00, 0x22, 0x43, 0x55, 0x66, 0x66, 0x06, 0x00,
+    0x00, 0x45, 0x54, 0x00, 0x00, 0x60, 0x66, 0x66, 0x55, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54,
+    0x66, 0x67, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x76, 0x66, 0x45, 0x34, 0x22, 0x00,
+    0x00, 0x20, 0x32, 0x54, 0x65, 0x66, 0x66, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x66, 0x66, 0x56,
+    0x45, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x43, 0x55, 0x66, 0x66, 0x66, 0x55, 0x44, 0x44, 0x55,
+    0x66, 0x66, 0x66, 0x55, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x66, 0x56,
+    0x55, 0x44, 0x44, 0x55, 0x65, 0x66, 0x56, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x44, 0x55, 0x66, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x66, 0x56, 0x55, 0x55, 0x65, 0x66, 0x56, 0x45, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x65, 0x66, 0x66, 0x66, 0x66,
+    0x56, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x54, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x44, 0x44, 0x54, 0x55, 0x65, 0x56, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x33, 0x33, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x44, 0x44, 0x54, 0x45, 0x44, 0x44, 0x33, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x55,
+    0x66, 0x66, 0x66, 0x66, 0x55, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
+    0x54, 0x55, 0x55, 0x66, 0x06, 0x00, 0x00, 0x60, 0x66, 0x55, 0x55, 0x45, 0x54, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00, 0x66, 0x66, 0x55, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x66, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x66, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x56, 0x55, 0x65, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x56, 0x55, 0x65, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x65,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x56, 0x55, 0x00, 0x00,
+    0x00, 0x50, 0x55, 0x56, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55,
+    0x65, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x56, 0x45, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x44, 0x54, 0x65, 0x55, 0x05, 0x00, 0x00, 0x44, 0x65, 0x55, 0x45, 0x44, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x54, 0x55, 0x56, 0x44, 0x00, 0x00, 0x44, 0x55, 0x55,
+    0x55, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55,
+    0x55, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x66,
+    0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x66, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x55, 0x44, 0x00, 0x00, 0x43, 0x55, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x66, 0x55, 0x34, 0x00, 0x00, 0x43, 0x54, 0x66, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x45, 0x34, 0x00, 0x00, 0x33, 0x54, 0x66,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x54, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x56, 0x45, 0x33, 0x00, 0x00, 0x33, 0x44, 0x65, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x56, 0x44, 0x33, 0x00, 0x00, 0x22, 0x43, 0x65, 0x06, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x56, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x54,
+    0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x66, 0x45, 0x34, 0x22, 0x00,
+    0x00, 0x20, 0x32, 0x54, 0x65, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x56,
+    0x45, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x44, 0x55, 0x66, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00,
+    0x00, 0x00, 0x66, 0x55, 0x44, 0x23, 0x02, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x66, 0x56,
+    0x55, 0x44, 0x44, 0x55, 0x65, 0x66, 0x56, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x44, 0x55, 0x66, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x66, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x56, 0x45, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x44, 0x54, 0x55,
+    0x66, 0x55, 0x55, 0x66, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x44, 0x44, 0x54, 0x55, 0x66, 0x66, 0x55, 0x45, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x55, 0x55, 0x55, 0x55, 0x44, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x55, 0x55, 0x55, 0x55,
+    0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x23, 0x32, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x33, 0x33, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x44, 0x44, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x44, 0x44, 0x55, 0x55, 0x44, 0x44, 0x33, 0x43, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x05, 0x00, 0x00, 0x50,
+    0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x55, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x54, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x45, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x45, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x45, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x05, 0x00, 0x00, 0x44, 0x55, 0x55,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x06, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x44, 0x00,
+    0x00, 0x43, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x34, 0x00, 0x00, 0x43, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x34, 0x00, 0x00, 0x33, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x33, 0x00,
+    0x00, 0x33, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x45, 0x33, 0x00, 0x00, 0x33, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x33, 0x00, 0x00, 0x22, 0x43, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x34, 0x22, 0x00, 0x00, 0x22, 0x43, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x34, 0x22, 0x00,
+    0x00, 0x20, 0x32, 0x54, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x45, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x43, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x34, 0x23, 0x02, 0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x44, 0x55, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x54, 0x65, 0x56, 0x55, 0x45, 0x54, 0x55, 0x65, 0x56, 0x45, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+    0x55, 0x55, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x54, 0x55,
+    0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x33, 0x33, 0x22,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x22, 0x33, 0x33, 0x22, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x30, 0x33, 0x33, 0x33, 0x04, 0x40, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x33, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x44, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x44, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x44, 0x05, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55,
+    0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00,
+    0x00, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50,
+    0x55, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x05, 0x00, 0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x05, 0x00, 0x00, 0x44, 0x55, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x44, 0x00,
+    0x00, 0x44, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x55, 0x44, 0x00, 0x00, 0x44, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x44, 0x00, 0x00, 0x44, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x44, 0x00, 0x00, 0x44, 0x05, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x44, 0x00,
+    0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x34, 0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x00, 0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x00,
+    0x00, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x33, 0x00, 0x00, 0x33, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x00, 0x00, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x00, 0x00, 0x20, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x02, 0x00,
+    0x00, 0x20, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x23, 0x02, 0x00, 0x00, 0x20, 0x32, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x30, 0x23, 0x02, 0x00, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34, 0x33, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33,
+    0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x33, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x33, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x34,
+    0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x33, 0x44, 0x05, 0x00, 0x50, 0x55, 0x55, 0x05,
+    0x00, 0x50, 0x44, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x54, 0x55,
+    0x55, 0x45, 0x54, 0x55, 0x55, 0x45, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x33, 0x44, 0x54, 0x55, 0x45, 0x54, 0x55, 0x45, 0x44, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x54, 0x55, 0x55, 0x55, 0x55, 0x45, 0x44, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+    0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+//EOF
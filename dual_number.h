@@ -0,0 +1,172 @@
+/**
+  ******************************************************************************
+  * @file    dual_number.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Forward mode automatic differentiation, header only (C++).
+  *          A Dual<T, N> carries a value and its derivatives with respect to
+  *          N inputs. Kinematics written once as a template over the scalar
+  *          type (see limb_kinematics.h) give the position when run with
+  *          double and the position plus the exact Jacobian in the same pass
+  *          when run with Dual<double, N>, so no Jacobian has to be derived
+  *          by hand. Fixed size, no heap, everything inline: with N known at
+  *          compile time the loops unroll to straight line FPU code.
+  ******************************************************************************
+  */
+#ifndef __DUAL_NUMBER_H_
+#define __DUAL_NUMBER_H_
+
+#ifdef __cplusplus
+
+#include <math.h>
+
+template <typename T, int N>
+struct Dual {
+    T v;        // value
+    T d[N];     // d value / d input i
+
+    Dual() : v(0) { for (int i = 0; i < N; i++) d[i] = 0; }
+    Dual( T value ) : v(value) { for (int i = 0; i < N; i++) d[i] = 0; }
+
+    // input number i (0 .. N-1) with the given value
+    static Dual variable( T value, int i )
+    {
+        Dual x(value);
+        x.d[i] = 1;
+        return x;
+    }
+
+    Dual &operator+=( const Dual &b ) { v += b.v; for (int i = 0; i < N; i++) d[i] += b.d[i]; return *this; }
+    Dual &operator-=( const Dual &b ) { v -= b.v; for (int i = 0; i < N; i++) d[i] -= b.d[i]; return *this; }
+    Dual &operator*=( const Dual &b ) { *this = *this * b; return *this; }
+    Dual &operator/=( const Dual &b ) { *this = *this / b; return *this; }
+};
+
+// plain numbers next to a Dual<T, N> are converted to T (so 2 * x works)
+template <typename T> struct DualScalar { typedef T type; };
+
+/* Arithmetic ----------------------------------------------------------------*/
+
+template <typename T, int N>
+inline Dual<T, N> operator-( const Dual<T, N> &a )
+{
+    Dual<T, N> r;
+    r.v = -a.v;
+    for (int i = 0; i < N; i++) r.d[i] = -a.d[i];
+    return r;
+}
+
+template <typename T, int N>
+inline Dual<T, N> operator+( const Dual<T, N> &a, const Dual<T, N> &b )
+{
+    Dual<T, N> r;
+    r.v = a.v + b.v;
+    for (int i = 0; i < N; i++) r.d[i] = a.d[i] + b.d[i];
+    return r;
+}
+
+template <typename T, int N>
+inline Dual<T, N> operator-( const Dual<T, N> &a, const Dual<T, N> &b )
+{
+    Dual<T, N> r;
+    r.v = a.v - b.v;
+    for (int i = 0; i < N; i++) r.d[i] = a.d[i] - b.d[i];
+    return r;
+}
+
+template <typename T, int N>
+inline Dual<T, N> operator*( const Dual<T, N> &a, const Dual<T, N> &b )
+{
+    Dual<T, N> r;
+    r.v = a.v * b.v;
+    for (int i = 0; i < N; i++) r.d[i] = a.d[i] * b.v + a.v * b.d[i];
+    return r;
+}
+
+template <typename T, int N>
+inline Dual<T, N> operator/( const Dual<T, N> &a, const Dual<T, N> &b )
+{
+    Dual<T, N> r;
+    T inv = 1 / b.v;
+    r.v = a.v * inv;
+    for (int i = 0; i < N; i++) r.d[i] = (a.d[i] - r.v * b.d[i]) * inv;
+    return r;
+}
+
+// with plain numbers, cheaper than promoting them to Dual
+template <typename T, int N>
+inline Dual<T, N> operator+( const Dual<T, N> &a, typename DualScalar<T>::type b ) { Dual<T, N> r = a; r.v += b; return r; }
+template <typename T, int N>
+inline Dual<T, N> operator+( typename DualScalar<T>::type a, const Dual<T, N> &b ) { return b + a; }
+template <typename T, int N>
+inline Dual<T, N> operator-( const Dual<T, N> &a, typename DualScalar<T>::type b ) { Dual<T, N> r = a; r.v -= b; return r; }
+template <typename T, int N>
+inline Dual<T, N> operator-( typename DualScalar<T>::type a, const Dual<T, N> &b ) { return -b + a; }
+
+template <typename T, int N>
+inline Dual<T, N> operator*( const Dual<T, N> &a, typename DualScalar<T>::type b )
+{
+    Dual<T, N> r;
+    r.v = a.v * b;
+    for (int i = 0; i < N; i++) r.d[i] = a.d[i] * b;
+    return r;
+}
+template <typename T, int N>
+inline Dual<T, N> operator*( typename DualScalar<T>::type a, const Dual<T, N> &b ) { return b * a; }
+template <typename T, int N>
+inline Dual<T, N> operator/( const Dual<T, N> &a, typename DualScalar<T>::type b ) { return a * (1 / b); }
+template <typename T, int N>
+inline Dual<T, N> operator/( typename DualScalar<T>::type a, const Dual<T, N> &b ) { return Dual<T, N>(a) / b; }
+
+/* Comparisons, on the value -------------------------------------------------*/
+
+template <typename T, int N> inline bool operator<( const Dual<T, N> &a, typename DualScalar<T>::type b ) { return a.v < b; }
+template <typename T, int N> inline bool operator>( const Dual<T, N> &a, typename DualScalar<T>::type b ) { return a.v > b; }
+template <typename T, int N> inline bool operator<( const Dual<T, N> &a, const Dual<T, N> &b ) { return a.v < b.v; }
+template <typename T, int N> inline bool operator>( const Dual<T, N> &a, const Dual<T, N> &b ) { return a.v > b.v; }
+
+/* Functions -----------------------------------------------------------------*/
+
+// derivative of f at a.v is df: chain rule on every input
+template <typename T, int N>
+inline Dual<T, N> dualChain( const Dual<T, N> &a, T f, T df )
+{
+    Dual<T, N> r;
+    r.v = f;
+    for (int i = 0; i < N; i++) r.d[i] = df * a.d[i];
+    return r;
+}
+
+template <typename T, int N>
+inline Dual<T, N> sin( const Dual<T, N> &a ) { return dualChain(a, (T)sin(a.v), (T)cos(a.v)); }
+template <typename T, int N>
+inline Dual<T, N> cos( const Dual<T, N> &a ) { return dualChain(a, (T)cos(a.v), (T)-sin(a.v)); }
+
+template <typename T, int N>
+inline Dual<T, N> sqrt( const Dual<T, N> &a )
+{
+    T s = (T)sqrt(a.v);
+    return dualChain(a, s, (T)0.5 / s);
+}
+
+template <typename T, int N>
+inline Dual<T, N> atan2( const Dual<T, N> &y, const Dual<T, N> &x )
+{
+    Dual<T, N> r;
+    T inv = 1 / (x.v * x.v + y.v * y.v);
+    r.v = (T)atan2(y.v, x.v);
+    for (int i = 0; i < N; i++) r.d[i] = (x.v * y.d[i] - y.v * x.d[i]) * inv;
+    return r;
+}
+
+// value of a plain number or of a Dual, for code templated on the scalar
+inline double dualValue( double a ) { return a; }
+inline float dualValue( float a ) { return a; }
+template <typename T, int N>
+inline T dualValue( const Dual<T, N> &a ) { return a.v; }
+
+#endif  // __cplusplus
+
+#endif  //__DUAL_NUMBER_H_
+//EOF
@@ -0,0 +1,304 @@
+/**
+  ******************************************************************************
+  * @file    hand_grasp.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Free object held by the hand (see hand_grasp.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_grasp.h"
+#include <math.h>
+
+/* Global variables ----------------------------------------------------------*/
+GraspObject handGrasp;
+
+/* Static Functions ----------------------------------------------------------*/
+
+static float dot3( const float a[3], const float b[3] )
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+static void cross3( const float a[3], const float b[3], float out[3] )
+{
+    out[0] = a[1]*b[2] - a[2]*b[1];
+    out[1] = a[2]*b[0] - a[0]*b[2];
+    out[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+// Force on the object from one contact, N. n: unit, from the center to the contact;
+// u: velocity of what touches it there, mm/s; h: substep, s
+static void contactForce( const GraspObject *object, GraspContact *contact, const float n[3], float depth,
+                          const float u[3], float stiffness, float h, float force[3] )
+{
+    float arm[3], spin[3], vr[3], vt[3], vn, fn, ft[3], ftNorm, limit;
+    int k;
+
+    if (depth <= 0.0f)
+    {
+        contact->touching = 0;
+        contact->slip[0] = contact->slip[1] = contact->slip[2] = 0.0f;
+        force[0] = force[1] = force[2] = 0.0f;
+        return;
+    }
+    contact->touching = 1;
+
+    // velocity of the other side against the surface of the object
+    for (k = 0; k < 3; k++) arm[k] = object->radius * n[k];
+    cross3(object->w, arm, spin);
+    for (k = 0; k < 3; k++) vr[k] = u[k] - object->v[k] - spin[k];
+    vn = dot3(vr, n);
+
+    // normal: spring on the depth, damping on the rate it goes in, never pulling
+    fn = stiffness * depth - object->damping * vn;
+    if (fn < 0.0f) fn = 0.0f;
+
+    // tangential: the slip spring is stretched by the sliding, kept in the tangent plane,
+    // and damped like the normal
+    for (k = 0; k < 3; k++) vt[k] = vr[k] - vn * n[k];
+    for (k = 0; k < 3; k++) contact->slip[k] += vt[k] * h;
+    vn = dot3(contact->slip, n);
+    for (k = 0; k < 3; k++)
+    {
+        contact->slip[k] -= vn * n[k];
+        ft[k] = object->tangentStiffness * contact->slip[k] + object->damping * vt[k];
+    }
+    ftNorm = sqrtf(dot3(ft, ft));
+    limit = object->staticFriction * fn;
+    if ((ftNorm > limit) && (ftNorm > 0.0f))
+    {
+        // slipping: the force drops to the kinetic one, the spring gives way to hold it
+        float scale = object->kineticFriction * fn / ftNorm;
+        for (k = 0; k < 3; k++)
+        {
+            ft[k] *= scale;
+            contact->slip[k] = ft[k] / object->tangentStiffness;
+        }
+    }
+
+    for (k = 0; k < 3; k++) force[k] = ft[k] - fn * n[k];
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   graspInit
+  * @brief  A sphere at rest, no gravity, no table, default contact: 0.2 N/mm
+  *         (the fingers' scene gain) and 1 N/mm across, about half critical
+  *         damping, friction 0.8 / 0.6.
+  * @param  object: the object.
+  * @param  x, y, z: center, hand frame, mm.
+  * @param  radius: mm.
+  * @param  mass: kg.
+  * @retval None.
+  */
+void graspInit( GraspObject *object, float x, float y, float z, float radius, float mass )
+{
+    int j;
+
+    object->c[0] = x;
+    object->c[1] = y;
+    object->c[2] = z;
+    for (j = 0; j < 3; j++)
+    {
+        object->v[j] = 0.0f;
+        object->w[j] = 0.0f;
+        object->gravity[j] = 0.0f;
+    }
+    object->radius = radius;
+    object->mass = mass;
+    object->inertia = 0.4f * mass * radius * radius;
+    object->drag = 0.5f;
+    object->hasTable = 0;
+    for (j = 0; j <= GRASP_MAX_POINTS; j++)
+    {
+        object->contact[j].touching = 0;
+        object->contact[j].slip[0] = object->contact[j].slip[1] = object->contact[j].slip[2] = 0.0f;
+    }
+    object->lastValid = 0;
+    object->held = 0;
+    graspSetContact(object, 0.2f, 1.0f, sqrtf(0.2f * mass * 1e-3f), 0.8f, 0.6f);
+}
+
+/*******************************************************************************
+  * @name   graspSetGravity
+  * @brief  Gravity in the hand frame, so its direction says how the hand is
+  *         mounted.
+  * @param  object: the object.
+  * @param  gx, gy, gz: mm/s^2 (9810 for 1 g).
+  * @retval None.
+  */
+void graspSetGravity( GraspObject *object, float gx, float gy, float gz )
+{
+    object->gravity[0] = gx;
+    object->gravity[1] = gy;
+    object->gravity[2] = gz;
+}
+
+/*******************************************************************************
+  * @name   graspSetContact
+  * @brief  Contact of the hand points and the table with the object.
+  * @param  object: the object.
+  * @param  stiffness: N/mm, along the normal.
+  * @param  tangentStiffness: N/mm, the slip spring (stiffer than the normal, or
+  *         a light object held by a soft squeeze rolls out of it).
+  * @param  damping: N/(mm/s), along the normal and across.
+  * @param  staticFriction: the slip spring holds up to this times the normal force,
+  * @param  kineticFriction: and slides at this times it once it gave way.
+  * @retval None.
+  */
+void graspSetContact( GraspObject *object, float stiffness, float tangentStiffness, float damping,
+                      float staticFriction, float kineticFriction )
+{
+    object->stiffness = stiffness;
+    object->tangentStiffness = (tangentStiffness > 0.0f) ? tangentStiffness : stiffness;
+    object->damping = damping;
+    object->staticFriction = staticFriction;
+    object->kineticFriction = (kineticFriction < staticFriction) ? kineticFriction : staticFriction;
+}
+
+/*******************************************************************************
+  * @name   graspSetTable
+  * @brief  A plane the object rests on when it is not held.
+  * @param  object: the object.
+  * @param  x, y, z: a point of the plane, mm.
+  * @param  normalX, normalY, normalZ: up from the plane (normalised here).
+  * @param  stiffness: N/mm, 0 for no table.
+  * @retval None.
+  */
+void graspSetTable( GraspObject *object, float x, float y, float z, float normalX, float normalY, float normalZ,
+                    float stiffness )
+{
+    float norm = sqrtf(normalX * normalX + normalY * normalY + normalZ * normalZ);
+
+    object->hasTable = (stiffness > 0.0f) && (norm > 0.0f);
+    if (!object->hasTable) return;
+    object->tableP[0] = x;
+    object->tableP[1] = y;
+    object->tableP[2] = z;
+    object->tableN[0] = normalX / norm;
+    object->tableN[1] = normalY / norm;
+    object->tableN[2] = normalZ / norm;
+    object->tableStiffness = stiffness;
+}
+
+/*******************************************************************************
+  * @name   graspStep
+  * @brief  Moves the object on by dt under the hand points, the table and
+  *         gravity, in GRASP_ITERATIONS substeps with each point moving in a
+  *         straight line from where it was at the last step, and gives the
+  *         reaction on each point. A fixed amount of work, no allocation.
+  * @param  object: the object.
+  * @param  count: hand points, up to GRASP_MAX_POINTS.
+  * @param  points: hand frame, mm.
+  * @param  gains: N per unit of force of each point (its limb gain); the
+  *         forces come back in those units, so they go where the scene
+  *         forces go. 0 for a point that only pushes nothing back.
+  * @param  dt: since the last step, s.
+  * @param  forces: out, on each point, averaged over the substeps.
+  * @retval None.
+  */
+void graspStep( GraspObject *object, int count, const float points[][3], const float gains[], float dt,
+                float forces[][3] )
+{
+    float pointV[GRASP_MAX_POINTS][3], h, invMass, invInertia, damp;
+    int i, j, k;
+
+    if (count > GRASP_MAX_POINTS) count = GRASP_MAX_POINTS;
+    for (j = 0; j < count; j++) forces[j][0] = forces[j][1] = forces[j][2] = 0.0f;
+    if (dt <= 0.0f) return;
+    if (dt > GRASP_MAX_DT) dt = GRASP_MAX_DT;
+
+    // the points' velocity over the step, and where they start
+    for (j = 0; j < count; j++)
+    {
+        for (k = 0; k < 3; k++)
+        {
+            if (!object->lastValid) object->lastPoints[j][k] = points[j][k];
+            pointV[j][k] = (points[j][k] - object->lastPoints[j][k]) / dt;
+        }
+    }
+
+    h = dt / GRASP_ITERATIONS;
+    invMass = (object->mass > 0.0f) ? 1000.0f / object->mass : 0.0f;             // N/kg in mm/s^2
+    invInertia = (object->inertia > 0.0f) ? 1000.0f / object->inertia : 0.0f;    // N mm / kg mm^2 in rad/s^2
+    damp = 1.0f / (1.0f + object->drag * h);
+
+    for (i = 1; i <= GRASP_ITERATIONS; i++)
+    {
+        float total[3], torque[3], f[3], n[3], q[3], arm[3], tau[3], d, s = (float)i / GRASP_ITERATIONS;
+
+        for (k = 0; k < 3; k++)
+        {
+            total[k] = object->gravity[k] * object->mass * 1e-3f;
+            torque[k] = 0.0f;
+        }
+
+        for (j = 0; j < count; j++)
+        {
+            for (k = 0; k < 3; k++)
+            {
+                float p = object->lastPoints[j][k] + (points[j][k] - object->lastPoints[j][k]) * s;
+                q[k] = p - object->c[k];
+            }
+            d = sqrtf(dot3(q, q));
+            if (d > 1e-6f)
+            {
+                for (k = 0; k < 3; k++) n[k] = q[k] / d;
+            }
+            else
+            {
+                n[0] = 1.0f; n[1] = 0.0f; n[2] = 0.0f;
+            }
+            contactForce(object, &object->contact[j], n, object->radius - d, pointV[j], object->stiffness, h, f);
+            for (k = 0; k < 3; k++)
+            {
+                total[k] += f[k];
+                arm[k] = object->radius * n[k];
+                if (gains[j] > 0.0f) forces[j][k] -= f[k] / gains[j] / GRASP_ITERATIONS;
+            }
+            cross3(arm, f, tau);
+            for (k = 0; k < 3; k++) torque[k] += tau[k];
+        }
+
+        if (object->hasTable)
+        {
+            const float still[3] = { 0.0f, 0.0f, 0.0f };
+            for (k = 0; k < 3; k++)
+            {
+                n[k] = -object->tableN[k];
+                q[k] = object->c[k] - object->tableP[k];
+            }
+            d = dot3(q, object->tableN);
+            contactForce(object, &object->contact[GRASP_MAX_POINTS], n, object->radius - d, still,
+                         object->tableStiffness, h, f);
+            for (k = 0; k < 3; k++)
+            {
+                total[k] += f[k];
+                arm[k] = object->radius * n[k];
+            }
+            cross3(arm, f, tau);
+            for (k = 0; k < 3; k++) torque[k] += tau[k];
+        }
+
+        // semi-implicit Euler: velocities first, the new ones move the object
+        for (k = 0; k < 3; k++)
+        {
+            object->v[k] = (object->v[k] + total[k] * invMass * h) * damp;
+            object->w[k] = (object->w[k] + torque[k] * invInertia * h) * damp;
+            object->c[k] += object->v[k] * h;
+        }
+    }
+
+    object->held = 0;
+    for (j = 0; j < count; j++)
+    {
+        for (k = 0; k < 3; k++) object->lastPoints[j][k] = points[j][k];
+        object->held += object->contact[j].touching;
+    }
+    object->lastValid = 1;
+}
+//EOF
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    hand_grasp.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   One free sphere the hand can grasp (HAND_GRASP_OBJECT in main.h):
+  *          a rigid body with mass, gravity and friction, stepped at the
+  *          render rate (the servo rate with HAND_SERVO_RATE_HZ) from the
+  *          contact points, and resting on a table plane when it is let go.
+  *          Each contact (every hand point, and the table) is a spring on
+  *          the depth along the normal, with some damping, and a tangential
+  *          spring-slider for the friction: the tangential displacement
+  *          since the contact started stretches a spring, which sticks
+  *          while its force stays under staticFriction * normal force and
+  *          slips at kineticFriction * normal force otherwise. The forces
+  *          of a tick are integrated in GRASP_ITERATIONS substeps with the
+  *          hand points moving on in a straight line (semi-implicit Euler,
+  *          so a stiff squeeze stays stable at 1 kHz), and the hand gets
+  *          back the average force of its contacts over them. Units: mm, mm/s, kg, N, rad.
+  *          Only needs math.h, see tools/sim_hand_grasp.c.
+  ******************************************************************************
+  */
+#ifndef __HAND_GRASP_H_
+#define __HAND_GRASP_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#define GRASP_MAX_POINTS        4       // hand contact points
+#define GRASP_ITERATIONS        4       // substeps per step
+#define GRASP_MAX_DT            0.005f  // s, a longer step (a stall) is cut to this
+
+typedef struct {
+    int touching;
+    float slip[3];              // tangential spring stretch, mm
+} GraspContact;
+
+typedef struct {
+    // state
+    float c[3];                 // center, mm
+    float v[3];                 // mm/s
+    float w[3];                 // rad/s
+    // body
+    float radius;               // mm
+    float mass;                 // kg
+    float inertia;              // kg mm^2, solid sphere
+    float gravity[3];           // mm/s^2
+    float drag;                 // 1/s, air drag on v and w
+    // contacts
+    float stiffness;            // N/mm along the normal
+    float tangentStiffness;     // N/mm, the slip spring
+    float damping;              // N/(mm/s)
+    float staticFriction, kineticFriction;
+    int hasTable;
+    float tableP[3], tableN[3]; // a point of the table, its unit normal (up)
+    float tableStiffness;       // N/mm
+    GraspContact contact[GRASP_MAX_POINTS + 1];     // the points, then the table
+    float lastPoints[GRASP_MAX_POINTS][3];
+    int lastValid;
+    int held;                   // points touching after the last step
+} GraspObject;
+
+extern GraspObject handGrasp;
+
+/******* Function prototypes ****/
+void graspInit( GraspObject *object, float x, float y, float z, float radius, float mass );
+void graspSetGravity( GraspObject *object, float gx, float gy, float gz );
+void graspSetContact( GraspObject *object, float stiffness, float tangentStiffness, float damping,
+                      float staticFriction, float kineticFriction );
+void graspSetTable( GraspObject *object, float x, float y, float z, float normalX, float normalY, float normalZ,
+                    float stiffness );
+void graspStep( GraspObject *object, int count, const float points[][3], const float gains[], float dt,
+                float forces[][3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_GRASP_H_
+//EOF
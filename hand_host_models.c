@@ -0,0 +1,297 @@
+/**
+  ******************************************************************************
+  * @file    hand_host_models.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host contact frames, packing on the host and blending on the
+  *          device (see hand_host_models.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_host_models.h"
+#include <math.h>
+
+/* Global variables ----------------------------------------------------------*/
+HostModels handHostModels;
+
+/* Static Functions ----------------------------------------------------------*/
+
+static void putInt16( float value, uint8_t * buffer )
+{
+    long v = lrintf(value);
+    if (v > 32767) v = 32767;
+    if (v < -32768) v = -32768;
+    buffer[0] = (uint8_t)((uint32_t)v & 0xFF);
+    buffer[1] = (uint8_t)(((uint32_t)v >> 8) & 0xFF);
+}
+
+static int16_t getInt16( const uint8_t * buffer )
+{
+    return (int16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static uint32_t getUint32( const uint8_t * buffer )
+{
+    return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+// one entry of a frame into a model, 1 if it is for one of our points
+static int decodeEntry( const HostModels *host, const uint8_t * entry, HandLocalModel models[] )
+{
+    HandLocalModel *model;
+    int point = entry[0], k;
+    float length;
+
+    if (point >= host->points) return 0;
+    model = &models[point];
+    model->type = entry[1];
+    for (k = 0; k < 3; k++)
+    {
+        model->p[k] = getInt16(&entry[2 + 2 * k]) / HOST_MODELS_POSITION_SCALE;
+    }
+    model->stiffness = (entry[14] | (entry[15] << 8)) / HOST_MODELS_STIFFNESS_SCALE;
+    if (model->type == LOCAL_SPHERE)
+    {
+        model->radius = getInt16(&entry[8]) / HOST_MODELS_POSITION_SCALE;
+        return 1;
+    }
+    if (model->type != LOCAL_PLANE)
+    {
+        model->type = LOCAL_NONE;
+        return 1;
+    }
+    for (k = 0; k < 3; k++)
+    {
+        model->n[k] = getInt16(&entry[8 + 2 * k]) / HOST_MODELS_NORMAL_SCALE;
+    }
+    length = sqrtf(model->n[0]*model->n[0] + model->n[1]*model->n[1] + model->n[2]*model->n[2]);
+    if (!(length > 0.0f))
+    {
+        model->type = LOCAL_NONE;
+        return 1;
+    }
+    for (k = 0; k < 3; k++) model->n[k] /= length;
+    return 1;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   hostModelsInit
+  * @brief  No models yet, every point is in free space.
+  * @param  host: state.
+  * @param  points: contact points, at most HOST_MODELS_MAX_POINTS.
+  * @retval None.
+  */
+void hostModelsInit( HostModels *host, int points )
+{
+    HandLocalModel none;
+    int j;
+
+    none.type = LOCAL_NONE;
+    host->points = (points > HOST_MODELS_MAX_POINTS) ? HOST_MODELS_MAX_POINTS : points;
+    for (j = 0; j < HOST_MODELS_MAX_POINTS; j++) localModelHold(&host->blend[j], &none);
+    host->valid = 0;
+    host->timestamp_us = 0;
+    host->period_us = 0.0;
+    host->arrival_us = 0.0;
+    host->accepted = 0;
+    host->rejected = 0;
+    host->stale = 0;
+}
+
+/*******************************************************************************
+  * @name   hostModelsPack
+  * @brief  Packs a host contact frame, the points in free space are left out.
+  * @param  frame: at least HOST_MODELS_MAX_FRAME_SIZE bytes.
+  * @param  seq: frame counter.
+  * @param  timestamp_us: host clock when the models were computed.
+  * @param  models: one per contact point, the thumb first.
+  * @param  points: number of models, at most HOST_MODELS_MAX_POINTS.
+  * @retval number of bytes in the frame.
+  */
+int hostModelsPack( uint8_t *frame, uint8_t seq, uint32_t timestamp_us, const HandLocalModel models[], int points )
+{
+    uint8_t * payload = &frame[3];
+    int n = HOST_MODELS_HEADER, count = 0, j, k;
+
+    if (points > HOST_MODELS_MAX_POINTS) points = HOST_MODELS_MAX_POINTS;
+    payload[0] = seq;
+    for (k = 0; k < 4; k++) payload[1 + k] = (timestamp_us >> (8 * k)) & 0xFF;
+    for (j = 0; j < points; j++)
+    {
+        const HandLocalModel *model = &models[j];
+        uint8_t * entry = &payload[n];
+        float stiffness = model->stiffness * HOST_MODELS_STIFFNESS_SCALE;
+        uint32_t s;
+
+        if ((model->type != LOCAL_PLANE) && (model->type != LOCAL_SPHERE)) continue;
+        entry[0] = (uint8_t)j;
+        entry[1] = (uint8_t)model->type;
+        for (k = 0; k < 3; k++) putInt16(model->p[k] * HOST_MODELS_POSITION_SCALE, &entry[2 + 2 * k]);
+        if (model->type == LOCAL_SPHERE)
+        {
+            putInt16(model->radius * HOST_MODELS_POSITION_SCALE, &entry[8]);
+            putInt16(0.0f, &entry[10]);
+            putInt16(0.0f, &entry[12]);
+        }
+        else
+        {
+            for (k = 0; k < 3; k++) putInt16(model->n[k] * HOST_MODELS_NORMAL_SCALE, &entry[8 + 2 * k]);
+        }
+        s = (stiffness <= 0.0f) ? 0 : (stiffness >= 65535.0f) ? 65535 : (uint32_t)lrintf(stiffness);
+        entry[14] = s & 0xFF;
+        entry[15] = s >> 8;
+        n += HOST_MODELS_ENTRY;
+        count++;
+    }
+    payload[5] = (uint8_t)count;
+    return telemetryFinishFrame(frame, HOST_MODELS_FRAME_TYPE, n);
+}
+
+/*******************************************************************************
+  * @name   hostModelsReceive
+  * @brief  Checks a host contact frame and starts blending to its models.
+  *         Each blend starts from what is rendered right now, the current
+  *         gain included, and a point coming out of free space starts from
+  *         its new model with no stiffness, so a frame never steps the
+  *         force, not even after the stream stopped.
+  * @param  host: state.
+  * @param  frame: whole frame starting at the sync byte.
+  * @param  now_us: device clock.
+  * @retval 1 if the frame was used, 0 if it was bad or older than the last.
+  */
+int hostModelsReceive( HostModels *host, const uint8_t *frame, double now_us )
+{
+    HandLocalModel models[HOST_MODELS_MAX_POINTS];
+    const uint8_t * payload = &frame[3];
+    uint8_t length = frame[2];
+    uint32_t timestamp;
+    double duration = HOST_MODELS_MAX_BLEND_US;
+    float gain;
+    int count, i, j;
+
+    if ((frame[1] != HOST_MODELS_FRAME_TYPE) || (length < HOST_MODELS_HEADER))
+    {
+        host->rejected++;
+        return 0;
+    }
+    count = payload[5];
+    if ((count > HOST_MODELS_MAX_POINTS) || (length != HOST_MODELS_HEADER + HOST_MODELS_ENTRY * count) ||
+        (telemetryCrc8(&frame[1], length + 2) != payload[length]))
+    {
+        host->rejected++;
+        return 0;
+    }
+
+    timestamp = getUint32(&payload[1]);
+    if (host->valid)
+    {
+        int32_t step = (int32_t)(timestamp - host->timestamp_us);
+        if (step <= 0)
+        {
+            host->stale++;
+            return 0;
+        }
+        // the period of a running stream, a restart (or a device clock that went back) keeps the longest blend
+        if ((now_us >= host->arrival_us) && (now_us - host->arrival_us < HOST_MODELS_HOLD_US))
+        {
+            host->period_us = (host->period_us > 0.0) ? 0.8 * host->period_us + 0.2 * step : step;
+            if (host->period_us < duration) duration = host->period_us;
+        }
+    }
+
+    for (j = 0; j < HOST_MODELS_MAX_POINTS; j++) models[j].type = LOCAL_NONE;
+    for (i = 0; i < count; i++) decodeEntry(host, &payload[HOST_MODELS_HEADER + HOST_MODELS_ENTRY * i], models);
+
+    gain = hostModelsGain(host, now_us);
+    for (j = 0; j < host->points; j++)
+    {
+        HandModelBlend *blend = &host->blend[j];
+        HandLocalModel from;
+        localModelBlendAt(blend, now_us, &from);
+        from.stiffness *= gain;
+        if ((from.type == LOCAL_NONE) || (gain <= 0.0f))
+        {
+            from = models[j];
+            from.stiffness = 0.0f;
+        }
+        blend->from = from;
+        blend->to = models[j];
+        blend->start_us = now_us;
+        blend->duration_us = duration;
+        blend->gain = 1.0f;
+    }
+
+    host->valid = 1;
+    host->timestamp_us = timestamp;
+    host->arrival_us = now_us;
+    host->accepted++;
+    return 1;
+}
+
+/*******************************************************************************
+  * @name   hostModelsGain
+  * @brief  1 while frames arrive, then the hold and the decay. If the
+  *         device clock went back since the last frame its age is unknown,
+  *         the models are dropped as if it was too old.
+  * @param  host: state.
+  * @param  now_us: device clock.
+  * @retval 0 to 1.
+  */
+float hostModelsGain( const HostModels *host, double now_us )
+{
+    double age = now_us - host->arrival_us;
+
+    if (!host->valid || (age < 0.0) || (age >= HOST_MODELS_DROP_US)) return 0.0f;
+    if (age <= HOST_MODELS_HOLD_US) return 1.0f;
+    return expf((float)(-(age - HOST_MODELS_HOLD_US) / HOST_MODELS_DECAY_US));
+}
+
+/*******************************************************************************
+  * @name   hostModelsBlends
+  * @brief  The blends to render, with the gain of now, for the servo
+  *         (handServoPublishBlends). The gain only changes on the scale of
+  *         HOST_MODELS_DECAY_US, so it can be taken at the loop rate.
+  * @param  host: state.
+  * @param  now_us: device clock.
+  * @param  blends: out, host->points of them.
+  * @retval None.
+  */
+void hostModelsBlends( const HostModels *host, double now_us, HandModelBlend blends[] )
+{
+    float gain = hostModelsGain(host, now_us);
+    int j;
+
+    for (j = 0; j < host->points; j++)
+    {
+        blends[j] = host->blend[j];
+        blends[j].gain = gain;
+        if (gain <= 0.0f)
+        {
+            blends[j].from.type = LOCAL_NONE;
+            blends[j].to.type = LOCAL_NONE;
+        }
+    }
+}
+
+/*******************************************************************************
+  * @name   hostModelsForces
+  * @brief  Contact forces of the host models on the points, now.
+  * @param  host: state.
+  * @param  points: host->points contact points, mm.
+  * @param  now_us: device clock.
+  * @param  forces: in the units of sceneQueryPoints.
+  * @retval None.
+  */
+void hostModelsForces( const HostModels *host, const float points[][3], double now_us, float forces[][3] )
+{
+    HandModelBlend blends[HOST_MODELS_MAX_POINTS];
+    int j;
+
+    hostModelsBlends(host, now_us, blends);
+    for (j = 0; j < host->points; j++) localModelBlendForce(&blends[j], points[j], now_us, forces[j]);
+}
+//EOF
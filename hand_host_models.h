@@ -0,0 +1,88 @@
+/**
+  ******************************************************************************
+  * @file    hand_host_models.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Local contact models computed on the host (HAND_HOST_PHYSICS in
+  *          main.h). The host runs the physics of the scene, reads the hand
+  *          from the hand pose stream and sends, at its own rate, one local
+  *          model per contact point (hand_local_model.h) tagged with its
+  *          clock. The device renders them at servo rate:
+  *           - each frame is blended in over the host period (from its
+  *             timestamps, at most HOST_MODELS_MAX_BLEND_US), starting from
+  *             the model rendered when it arrives, so a 500 Hz host does not
+  *             give 500 Hz force steps;
+  *           - frames older than the last one are dropped;
+  *           - when frames stop, the last models are held for
+  *             HOST_MODELS_HOLD_US, then their force decays with the time
+  *             constant HOST_MODELS_DECAY_US and they are dropped, so the
+  *             hand is let go softly instead of the last wall staying on.
+  *          Only needs math.h, the host library (host/hand_host_link.h) and
+  *          tools/hand_core_pty.c build it too.
+  ******************************************************************************
+  */
+#ifndef __HAND_HOST_MODELS_H_
+#define __HAND_HOST_MODELS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "hand_local_model.h"
+#include "haplink_telemetry.h"
+
+/* Host contact frame --------------------------------------------------------*/
+// Sent by the host as a telemetry frame (haplink_telemetry.h):
+//    [0xA5]['C'][len][payload][crc8]
+// payload: [seq][host timestamp us, uint32][count], then count entries of
+//    [point][type][x y z][a b c][stiffness]
+//    point:      0 thumb, 1 + limb for the fingers
+//    type:       LOCAL_PLANE or LOCAL_SPHERE (hand_local_model.h)
+//    x y z:      plane point or sphere center, 1/100 mm, int16 each
+//    a b c:      plane: unit normal in 1/16384, int16 each
+//                sphere: radius in 1/100 mm (a), b = c = 0
+//    stiffness:  1/1000, uint16 (1.0 is the limb's gain)
+// Points without an entry are in free space. All multi-byte values little endian.
+#define HOST_MODELS_FRAME_TYPE      'C'
+#define HOST_MODELS_HEADER          6       // seq, timestamp, count
+#define HOST_MODELS_ENTRY           16
+#define HOST_MODELS_MAX_POINTS      4
+#define HOST_MODELS_MAX_FRAME_SIZE  (HOST_MODELS_HEADER + HOST_MODELS_ENTRY * HOST_MODELS_MAX_POINTS + TELEMETRY_FRAME_OVERHEAD)
+#define HOST_MODELS_POSITION_SCALE  100.0f  // counts per mm
+#define HOST_MODELS_NORMAL_SCALE    16384.0f
+#define HOST_MODELS_STIFFNESS_SCALE 1000.0f
+
+/* Timing, device side */
+#define HOST_MODELS_MAX_BLEND_US    4000.0  // longest blend to a new frame (a 250 Hz host)
+#define HOST_MODELS_HOLD_US         20000.0 // no frame for this long: start letting go
+#define HOST_MODELS_DECAY_US        50000.0 // time constant of the force after that
+#define HOST_MODELS_DROP_US         (HOST_MODELS_HOLD_US + 5.0 * HOST_MODELS_DECAY_US)
+
+typedef struct {
+    int points;                 // contact points rendered
+    HandModelBlend blend[HOST_MODELS_MAX_POINTS];
+    int valid;                  // a frame was accepted
+    uint32_t timestamp_us;      // host clock of the last accepted frame
+    double period_us;           // host period, from the timestamps
+    double arrival_us;          // device clock of the last accepted frame
+    uint32_t accepted, rejected, stale;
+} HostModels;
+
+extern HostModels handHostModels;
+
+/******* Function prototypes ****/
+void hostModelsInit( HostModels *host, int points );
+int hostModelsPack( uint8_t *frame, uint8_t seq, uint32_t timestamp_us, const HandLocalModel models[], int points );
+int hostModelsReceive( HostModels *host, const uint8_t *frame, double now_us );
+float hostModelsGain( const HostModels *host, double now_us );
+void hostModelsBlends( const HostModels *host, double now_us, HandModelBlend blends[] );
+void hostModelsForces( const HostModels *host, const float points[][3], double now_us, float forces[][3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_HOST_MODELS_H_
+//EOF
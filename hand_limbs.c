@@ -0,0 +1,114 @@
+/**
+  ******************************************************************************
+  * @file    hand_limbs.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Limb table and force output of the 2-DOF fingers (see
+  *          hand_limbs.h), the kinematics are in hand_limbs_kinematics.cpp.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_limbs.h"
+#include "haplink_position.h"
+#include "haplink_motors.h"
+#include "hand_virtual_environment.h"
+#include "haplink_telemetry_streams.h"
+
+/* Limbs ---------------------------------------------------------------------*/
+
+const HandLimb handLimbs[HAND_LIMB_COUNT] =
+{
+    // HAND_FINGER_1
+    { MOTOR_4, MOTOR_5,  1.0,  1.0, DELTATHETA_A_1, DELTATHETA_B_1,
+      NORMAL_XF, NORMAL_YF, NORMAL_ZF1,
+      handLimbPaddleKinematics, handLimbPaddleJacobian },
+    // HAND_FINGER_2, mounted mirrored: encoders and torques flipped
+    { MOTOR_6, MOTOR_7, -1.0, -1.0, DELTATHETA_A_2, DELTATHETA_B_2,
+      NORMAL_XF, NORMAL_YF, NORMAL_ZF2,
+      handLimbPaddleKinematics, handLimbPaddleJacobian },
+};
+
+HandLimbState handLimbState;
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   initHandLimbs
+  * @brief  Zeroes the limb state and reads the starting pose.
+  * @param  None.
+  * @retval None.
+  */
+void initHandLimbs( void )
+{
+    for (int i = 0; i < HAND_LIMB_COUNT; i++)
+    {
+        handLimbState.torqueA[i] = 0.0;
+        handLimbState.torqueB[i] = 0.0;
+    }
+    calculateHandLimbs();
+}
+
+/*******************************************************************************
+  * @name   calculateHandLimbs
+  * @brief  Reads the encoders of every limb and updates its position, limb
+  *         and hand frames. The Jacobians go stale until asked for.
+  * @param  None.
+  * @retval None.
+  */
+void calculateHandLimbs( void )
+{
+    for (int i = 0; i < HAND_LIMB_COUNT; i++)
+    {
+        const HandLimb *limb = &handLimbs[i];
+        double thetaMotorA = limb->encoderSign * calculatePositionMotor(limb->motorA);
+        double thetaMotorB = limb->encoderSign * calculatePositionMotor(limb->motorB);
+
+        limb->kinematics(limb, i, thetaMotorA, thetaMotorB, &handLimbState);
+        handLimbState.jacobianValid[i] = 0;
+        handLimbState.x[i] = handLimbState.rx[i] + limb->normalX;   // axes aligned, no rotation needed
+        handLimbState.y[i] = handLimbState.ry[i] + limb->normalY;
+    }
+}
+
+/*******************************************************************************
+  * @name   handLimbOutputForce
+  * @brief  Turns a force on limb i into motor torques (Jacobian transpose,
+  *         then the sector ratios) and outputs them. A zero force outputs
+  *         zero torques without touching the Jacobian.
+  * @param  i: HAND_FINGER_1 ...
+  * @param  forceX, forceY: N, hand frame (axes aligned with the limb frame).
+  * @retval None.
+  */
+void handLimbOutputForce( int i, double forceX, double forceY )
+{
+    const HandLimb *limb = &handLimbs[i];
+
+    if ((forceX == 0.0) && (forceY == 0.0))
+    {
+        handLimbState.torqueA[i] = 0.0;
+        handLimbState.torqueB[i] = 0.0;
+        outputTorqueMotor(limb->motorA, 0.0);
+        outputTorqueMotor(limb->motorB, 0.0);
+        return;
+    }
+
+    // Jacobian at this pose, once
+    if (!handLimbState.jacobianValid[i])
+    {
+        limb->jacobian(limb, i, &handLimbState);
+        handLimbState.jacobianValid[i] = 1;
+        countJacobianEvaluation();
+    }
+
+    /* Force to Torque*/
+    double torqueX = (handLimbState.J00[i]*forceX + handLimbState.J10[i]*forceY)*0.001;
+    double torqueY = (handLimbState.J01[i]*forceX + handLimbState.J11[i]*forceY)*0.001;
+
+    handLimbState.torqueA[i] = limb->torqueSign*((torqueX*R_MA)/R_A);
+    handLimbState.torqueB[i] = limb->torqueSign*((torqueY*R_MB)/R_B);
+    outputTorqueMotor(limb->motorA, handLimbState.torqueA[i]);
+    outputTorqueMotor(limb->motorB, handLimbState.torqueB[i]);
+}
+//EOF
@@ -0,0 +1,83 @@
+/**
+  ******************************************************************************
+  * @file    hand_limbs.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   2-DOF finger limbs described by a table instead of one copy of
+  *          the code per finger. Each HandLimb holds its motors (the encoder
+  *          of a motor has the same number), signs, paddle offsets, where its
+  *          plane sits in the hand frame and its kinematics. The state of
+  *          every limb lives in one structure of arrays, updated by a single
+  *          loop over the const table (HAND_LIMB_COUNT is a compile time
+  *          constant, so the compiler can unroll it). A third finger is one
+  *          more line in handLimbs[] (hand_limbs.c) and HAND_LIMB_COUNT.
+  *          The Jacobian of a limb is only evaluated when a nonzero force has
+  *          to be turned into torques, at most once per calculateHandLimbs.
+  ******************************************************************************
+  */
+#ifndef __HAND_LIMBS_H_
+#define __HAND_LIMBS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "main.h"
+
+// Limbs, index into handLimbs[] and HandLimbState
+#define HAND_FINGER_1       0   // motors 4 and 5
+#define HAND_FINGER_2       1   // motors 6 and 7
+#define HAND_LIMB_COUNT     2
+
+typedef struct HandLimbState HandLimbState;
+
+typedef struct HandLimb {
+    int motorA, motorB;             // MOTOR_4 ... (haplink_motors.h), paddle a and b
+    double encoderSign;             // +1 or -1, motor angle to paddle convention
+    double torqueSign;              // +1 or -1, applied to the torque sent to the motors
+    double deltaThetaA;             // DELTATHETA_A_n, rad
+    double deltaThetaB;             // DELTATHETA_B_n, rad
+    double normalX, normalY, normalZ;   // limb frame origin in the hand frame, mm
+    // fills thetaA/B and rx/ry of limb i from its (signed) motor angles
+    void (*kinematics)( const struct HandLimb *limb, int i, double thetaMotorA, double thetaMotorB,
+                        HandLimbState *state );
+    // fills J of limb i at the thetaA/B already in state
+    void (*jacobian)( const struct HandLimb *limb, int i, HandLimbState *state );
+} HandLimb;
+
+struct HandLimbState {
+    double thetaA[HAND_LIMB_COUNT];     // paddle angles, rad
+    double thetaB[HAND_LIMB_COUNT];
+    double rx[HAND_LIMB_COUNT];         // limb frame, mm
+    double ry[HAND_LIMB_COUNT];
+    double x[HAND_LIMB_COUNT];          // hand frame (the thumb and sphere frame), mm
+    double y[HAND_LIMB_COUNT];
+    double J00[HAND_LIMB_COUNT];        // torque = J^T F, mm
+    double J01[HAND_LIMB_COUNT];
+    double J10[HAND_LIMB_COUNT];
+    double J11[HAND_LIMB_COUNT];
+    int jacobianValid[HAND_LIMB_COUNT]; // J is at the current pose
+    double torqueA[HAND_LIMB_COUNT];    // last output, Nm
+    double torqueB[HAND_LIMB_COUNT];
+};
+
+extern const HandLimb handLimbs[HAND_LIMB_COUNT];
+extern HandLimbState handLimbState;
+
+/******* Function prototypes ****/
+// kinematics for the table (hand_limbs_kinematics.cpp)
+void handLimbPaddleKinematics( const HandLimb *limb, int i, double thetaMotorA, double thetaMotorB,
+                               HandLimbState *state );
+void handLimbPaddleJacobian( const HandLimb *limb, int i, HandLimbState *state );
+
+void initHandLimbs( void );
+void calculateHandLimbs( void );
+void handLimbOutputForce( int i, double forceX, double forceY );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_LIMBS_H_
+//EOF
@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file    hand_limbs_kinematics.cpp
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Limb kinematics for the table in hand_limbs.c. The forward
+  *          kinematics of limb_kinematics.h run on doubles every tick for
+  *          the position, and on dual numbers for the Jacobian when a
+  *          force has to be output.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_limbs.h"
+#include "haplink_position.h"
+#include "limb_kinematics.h"
+
+static const PaddleGeometry paddleGeometry = { L_A, L_B, CX, CY };
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   handLimbPaddleKinematics
+  * @brief  Haplink paddle pair: motor angles to paddle angles through the
+  *         sector ratios, then paddleForward on doubles.
+  * @param  limb: descriptor, for the paddle offsets.
+  * @param  i: index of the limb in state.
+  * @param  thetaMotorA, thetaMotorB: motor angles in rad, encoderSign applied.
+  * @param  state: written at index i.
+  * @retval None.
+  */
+void handLimbPaddleKinematics( const HandLimb *limb, int i, double thetaMotorA, double thetaMotorB,
+                               HandLimbState *state )
+{
+    // Compute the angle of the paddles in radians
+    double thetaA = -R_MA/R_A*thetaMotorA + THETA_A_OFFSET_RAD;
+    double thetaB = -R_MA/R_A*thetaMotorB + (R_MB/R_B)*thetaA + THETA_B_OFFSET_RAD;
+
+    state->thetaA[i] = thetaA;
+    state->thetaB[i] = thetaB;
+    paddleForward(thetaA + limb->deltaThetaA, thetaB + limb->deltaThetaB, paddleGeometry,
+                  state->rx[i], state->ry[i]);
+}
+
+/*******************************************************************************
+  * @name   handLimbPaddleJacobian
+  * @brief  paddleForward again on Dual<double, 2> seeded on the two paddle
+  *         angles. J[r][j] = d r / d paddle j, so the torques are J^T F.
+  * @param  limb: descriptor, for the paddle offsets.
+  * @param  i: index of the limb in state.
+  * @param  state: thetaA/B read, J written at index i.
+  * @retval None.
+  */
+void handLimbPaddleJacobian( const HandLimb *limb, int i, HandLimbState *state )
+{
+    typedef Dual<double, 2> D;
+
+    D rx, ry;
+    paddleForward(D::variable(state->thetaA[i] + limb->deltaThetaA, 0),
+                  D::variable(state->thetaB[i] + limb->deltaThetaB, 1), paddleGeometry, rx, ry);
+
+    state->J00[i] = rx.d[0];
+    state->J01[i] = rx.d[1];
+    state->J10[i] = ry.d[0];
+    state->J11[i] = ry.d[1];
+}
+//EOF
@@ -0,0 +1,186 @@
+/**
+  ******************************************************************************
+  * @file    hand_local_model.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Local contact models (see hand_local_model.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_local_model.h"
+#include <math.h>
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   localModelBuild
+  * @brief  Model of the object closest to a point, if it is within
+  *         LOCAL_MODEL_RANGE: the object itself for a sphere, otherwise the
+  *         plane tangent to it at its closest surface point.
+  * @param  model: out.
+  * @param  scene: objects, looked up with sceneObjectsNear.
+  * @param  at: mm, the contact point or its proxy (hand_proxy.h).
+  * @retval None.
+  */
+void localModelBuild( HandLocalModel *model, const Scene *scene, const float at[3] )
+{
+    uint16_t near[SCENE_MAX_OBJECTS];
+    float lo[3], hi[3], normal[3], closest = INFINITY;
+    int n, i, k, object = -1;
+
+    for (k = 0; k < 3; k++)
+    {
+        lo[k] = at[k] - LOCAL_MODEL_RANGE;
+        hi[k] = at[k] + LOCAL_MODEL_RANGE;
+    }
+    n = sceneObjectsNear(scene, lo, hi, near, SCENE_MAX_OBJECTS);
+    for (i = 0; i < n; i++)
+    {
+        float d = sceneObjectDistance(scene, near[i], at, normal);
+        if (d < closest)
+        {
+            closest = d;
+            object = near[i];
+        }
+    }
+
+    model->type = LOCAL_NONE;
+    if ((object < 0) || !(closest < LOCAL_MODEL_RANGE)) return;
+    model->stiffness = scene->stiffness[object];
+    if (scene->type[object] == SCENE_SPHERE)
+    {
+        model->type = LOCAL_SPHERE;
+        model->p[0] = scene->px[object];
+        model->p[1] = scene->py[object];
+        model->p[2] = scene->pz[object];
+        model->radius = scene->radius[object];
+        return;
+    }
+    sceneObjectDistance(scene, object, at, normal);
+    model->type = LOCAL_PLANE;
+    for (k = 0; k < 3; k++)
+    {
+        model->n[k] = normal[k];
+        model->p[k] = at[k] - closest * normal[k];
+    }
+}
+
+/*******************************************************************************
+  * @name   localModelForce
+  * @brief  Contact force of a local model on a point.
+  * @param  model: built by localModelBuild.
+  * @param  point: mm.
+  * @param  force: stiffness * depth (mm) * normal, 0 outside.
+  * @retval None.
+  */
+void localModelForce( const HandLocalModel *model, const float point[3], float force[3] )
+{
+    float qx = point[0] - model->p[0];
+    float qy = point[1] - model->p[1];
+    float qz = point[2] - model->p[2];
+    float depth, k;
+
+    force[0] = force[1] = force[2] = 0.0f;
+    if (model->type == LOCAL_PLANE)
+    {
+        depth = -(qx*model->n[0] + qy*model->n[1] + qz*model->n[2]);
+        if (depth <= 0.0f) return;
+        k = model->stiffness * depth;
+        force[0] = k * model->n[0];
+        force[1] = k * model->n[1];
+        force[2] = k * model->n[2];
+    }
+    else if (model->type == LOCAL_SPHERE)
+    {
+        float length2 = qx*qx + qy*qy + qz*qz;
+        float length;
+        if (length2 >= model->radius * model->radius) return;
+        length = sqrtf(length2);
+        if (length <= 0.0f) return;    // center, no direction
+        k = model->stiffness * (model->radius - length) / length;
+        force[0] = k * qx;
+        force[1] = k * qy;
+        force[2] = k * qz;
+    }
+}
+
+/*******************************************************************************
+  * @name   localModelHold
+  * @brief  Blend that renders one model as it is.
+  * @param  blend: out.
+  * @param  model: model.
+  * @retval None.
+  */
+void localModelHold( HandModelBlend *blend, const HandLocalModel *model )
+{
+    blend->from = *model;
+    blend->to = *model;
+    blend->start_us = 0.0;
+    blend->duration_us = 0.0;
+    blend->gain = 1.0f;
+}
+
+/*******************************************************************************
+  * @name   localModelBlendAt
+  * @brief  Model of a blend at a time: positions, normal, radius and
+  *         stiffness go linearly from one model to the other. Models of
+  *         different types do not blend, the new one is used right away
+  *         (a model appears before the point reaches it, LOCAL_MODEL_RANGE).
+  * @param  blend: blend.
+  * @param  now_us: time, same clock as start_us.
+  * @param  model: out, without the gain.
+  * @retval None.
+  */
+void localModelBlendAt( const HandModelBlend *blend, double now_us, HandLocalModel *model )
+{
+    const HandLocalModel *a = &blend->from, *b = &blend->to;
+    float t, length;
+    int k;
+
+    *model = *b;
+    if ((blend->duration_us <= 0.0) || (a->type != b->type) || (b->type == LOCAL_NONE)) return;
+    t = (float)((now_us - blend->start_us) / blend->duration_us);
+    if (t >= 1.0f) return;
+    if (t < 0.0f) t = 0.0f;
+
+    for (k = 0; k < 3; k++) model->p[k] = a->p[k] + (b->p[k] - a->p[k]) * t;
+    model->stiffness = a->stiffness + (b->stiffness - a->stiffness) * t;
+    if (b->type == LOCAL_SPHERE)
+    {
+        model->radius = a->radius + (b->radius - a->radius) * t;
+        return;
+    }
+    for (k = 0; k < 3; k++) model->n[k] = a->n[k] + (b->n[k] - a->n[k]) * t;
+    length = sqrtf(model->n[0]*model->n[0] + model->n[1]*model->n[1] + model->n[2]*model->n[2]);
+    if (length > 0.0f)
+    {
+        for (k = 0; k < 3; k++) model->n[k] /= length;
+    }
+    else
+    {
+        for (k = 0; k < 3; k++) model->n[k] = b->n[k];     // opposite normals, no halfway
+    }
+}
+
+/*******************************************************************************
+  * @name   localModelBlendForce
+  * @brief  Contact force of a blend on a point.
+  * @param  blend: blend.
+  * @param  point: mm.
+  * @param  now_us: time, same clock as start_us.
+  * @param  force: gain * stiffness * depth (mm) * normal, 0 outside.
+  * @retval None.
+  */
+void localModelBlendForce( const HandModelBlend *blend, const float point[3], double now_us, float force[3] )
+{
+    HandLocalModel model;
+
+    localModelBlendAt(blend, now_us, &model);
+    localModelForce(&model, point, force);
+    force[0] *= blend->gain;
+    force[1] *= blend->gain;
+    force[2] *= blend->gain;
+}
+//EOF
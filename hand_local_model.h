@@ -0,0 +1,64 @@
+/**
+  ******************************************************************************
+  * @file    hand_local_model.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Local contact model of one contact point: the part of the scene
+  *          next to it, reduced to a tangent plane or a sphere. The slow
+  *          side (the background loop, or the host) builds it from the
+  *          scene with localModelBuild; the fast servo only evaluates
+  *          localModelForce, a few multiplies, until the next one comes.
+  *          The plane is the surface of the closest object, so it is good
+  *          for the distance the point moves between two builds
+  *          (LOCAL_MODEL_RANGE); a sphere of the scene is kept exact.
+  *          A HandModelBlend moves from one model to the next over a given
+  *          time and scales it by a gain, for models that arrive at a
+  *          lower rate than the servo renders them (hand_host_models.h).
+  *          Forces in the units of sceneQueryPoints. Only needs math.h.
+  ******************************************************************************
+  */
+#ifndef __HAND_LOCAL_MODEL_H_
+#define __HAND_LOCAL_MODEL_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "hand_scene.h"
+
+#define LOCAL_MODEL_RANGE       5.0f    // mm, farther objects give no model (3 mm per ms at 3 m/s)
+
+// Model types
+#define LOCAL_NONE              0   // free space
+#define LOCAL_PLANE             1   // p a point of the surface, n its outward normal
+#define LOCAL_SPHERE            2   // p center, radius
+
+typedef struct {
+    int type;
+    float p[3];         // mm
+    float n[3];
+    float radius;       // mm
+    float stiffness;
+} HandLocalModel;
+
+typedef struct {
+    HandLocalModel from, to;    // rendered from -> to between start_us and start_us + duration_us
+    double start_us;
+    double duration_us;         // 0 is to right away
+    float gain;                 // on the force, 1 normally
+} HandModelBlend;
+
+/******* Function prototypes ****/
+void localModelBuild( HandLocalModel *model, const Scene *scene, const float at[3] );
+void localModelForce( const HandLocalModel *model, const float point[3], float force[3] );
+void localModelHold( HandModelBlend *blend, const HandLocalModel *model );
+void localModelBlendAt( const HandModelBlend *blend, double now_us, HandLocalModel *model );
+void localModelBlendForce( const HandModelBlend *blend, const float point[3], double now_us, float force[3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_LOCAL_MODEL_H_
+//EOF
@@ -0,0 +1,452 @@
+/**
+  ******************************************************************************
+  * @file    hand_motion.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Motion models of the scene objects (see hand_motion.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_motion.h"
+#include <math.h>
+
+/* Global variables ----------------------------------------------------------*/
+SceneMotion handMotion;
+
+/* Static Functions ----------------------------------------------------------*/
+
+// tangent at a key from its neighbours, mm/s
+static void tangent( const float before[3], const float after[3], double dt_us, float m[3] )
+{
+    float inv = (dt_us > 0.0) ? (float)(1e6 / dt_us) : 0.0f;
+    int k;
+
+    for (k = 0; k < 3; k++) m[k] = (after[k] - before[k]) * inv;
+}
+
+// cubic Hermite from p0 (tangent m0) to p1 (tangent m1), segment of h_us, at s = 0 .. 1
+static void hermite( const float p0[3], const float m0[3], const float p1[3], const float m1[3], double h_us,
+                     float s, float out[3] )
+{
+    float s2 = s * s, s3 = s2 * s;
+    float h00 = 2.0f*s3 - 3.0f*s2 + 1.0f;
+    float h10 = s3 - 2.0f*s2 + s;
+    float h01 = -2.0f*s3 + 3.0f*s2;
+    float h11 = s3 - s2;
+    float h = (float)(h_us * 1e-6);
+    int k;
+
+    for (k = 0; k < 3; k++) out[k] = h00*p0[k] + h10*h*m0[k] + h01*p1[k] + h11*h*m1[k];
+}
+
+static void copy3( const float from[3], float to[3] )
+{
+    to[0] = from[0]; to[1] = from[1]; to[2] = from[2];
+}
+
+static void waypointsPosition( const MotionTrack *track, double now_us, float position[3] )
+{
+    const int n = track->count;
+    float m1[3], m2[3], s;
+    double u = (now_us - track->start_us) / track->segment_us;
+    int i, i0, i2, i3;
+
+    if (n == 1 || u <= 0.0)
+    {
+        copy3(track->key[0], position);
+        return;
+    }
+    if (track->loop)
+    {
+        u = fmod(u, (double)n);
+    }
+    else if (u >= n - 1)
+    {
+        copy3(track->key[n - 1], position);
+        return;
+    }
+    i = (int)u;
+    s = (float)(u - i);
+    if (track->loop)
+    {
+        i0 = (i + n - 1) % n;
+        i2 = (i + 1) % n;
+        i3 = (i + 2) % n;
+    }
+    else
+    {
+        i0 = (i > 0) ? i - 1 : 0;
+        i2 = i + 1;
+        i3 = (i + 2 < n) ? i + 2 : n - 1;
+    }
+    tangent(track->key[i0], track->key[i2], (i0 == i) ? track->segment_us : 2.0 * track->segment_us, m1);
+    tangent(track->key[i], track->key[i3], (i3 == i2) ? track->segment_us : 2.0 * track->segment_us, m2);
+    hermite(track->key[i], m1, track->key[i2], m2, track->segment_us, s, position);
+}
+
+// j-th oldest keyframe
+static int keyIndex( const MotionTrack *track, int j )
+{
+    return (track->head + j) % MOTION_MAX_KEYS;
+}
+
+static void keyframesPosition( const MotionTrack *track, double now_us, float position[3] )
+{
+    const int n = track->count;
+    int j, a, b, before, after;
+    float m1[3], m2[3];
+    double h;
+
+    if (n == 0) return;
+    a = keyIndex(track, 0);
+    if ((n == 1) || (now_us <= track->keyTime_us[a]))
+    {
+        copy3(track->key[a], position);
+        return;
+    }
+    for (j = n - 1; j > 0; j--)
+    {
+        if (track->keyTime_us[keyIndex(track, j)] <= now_us) break;
+    }
+    if (j == n - 1)
+    {
+        // past the newest key: keep going a little, then stop
+        float v[3];
+        double late = now_us - track->keyTime_us[keyIndex(track, j)];
+        a = keyIndex(track, j - 1);
+        b = keyIndex(track, j);
+        if (late > MOTION_MAX_EXTRAPOLATE_US) late = MOTION_MAX_EXTRAPOLATE_US;
+        tangent(track->key[a], track->key[b], track->keyTime_us[b] - track->keyTime_us[a], v);
+        for (int k = 0; k < 3; k++) position[k] = track->key[b][k] + v[k] * (float)(late * 1e-6);
+        return;
+    }
+    a = keyIndex(track, j);
+    b = keyIndex(track, j + 1);
+    before = keyIndex(track, (j > 0) ? j - 1 : j);
+    after = keyIndex(track, (j + 2 < n) ? j + 2 : j + 1);
+    h = track->keyTime_us[b] - track->keyTime_us[a];
+    tangent(track->key[before], track->key[b], track->keyTime_us[b] - track->keyTime_us[before], m1);
+    tangent(track->key[a], track->key[after], track->keyTime_us[after] - track->keyTime_us[a], m2);
+    hermite(track->key[a], m1, track->key[b], m2, h, (float)((now_us - track->keyTime_us[a]) / h), position);
+}
+
+static int16_t getInt16( const uint8_t * buffer )
+{
+    return (int16_t)(buffer[0] | (buffer[1] << 8));
+}
+
+static void putInt16( float value, uint8_t * buffer )
+{
+    long v = lrintf(value);
+    if (v > 32767) v = 32767;
+    if (v < -32768) v = -32768;
+    buffer[0] = (uint8_t)((uint32_t)v & 0xFF);
+    buffer[1] = (uint8_t)(((uint32_t)v >> 8) & 0xFF);
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   motionInit
+  * @brief  No tracks, every object stays where it is.
+  * @param  motion: tracks.
+  * @retval None.
+  */
+void motionInit( SceneMotion *motion )
+{
+    for (int i = 0; i < MOTION_MAX_TRACKS; i++)
+    {
+        motion->track[i].object = -1;
+        motion->track[i].type = MOTION_STILL;
+    }
+    motion->keysAccepted = 0;
+    motion->keysRejected = 0;
+}
+
+/*******************************************************************************
+  * @name   motionAttach
+  * @brief  Track of an object, a new one (still) if it has none. The object
+  *         becomes dynamic and the grid is built again.
+  * @param  motion: tracks.
+  * @param  scene: scene.
+  * @param  object: index.
+  * @retval track, -1 if the object does not exist or no track is free.
+  */
+int motionAttach( SceneMotion *motion, Scene *scene, int object )
+{
+    int i, free = -1;
+
+    if ((object < 0) || (object >= scene->count)) return -1;
+    for (i = 0; i < MOTION_MAX_TRACKS; i++)
+    {
+        if (motion->track[i].object == object) return i;
+        if ((free < 0) && (motion->track[i].object < 0)) free = i;
+    }
+    if (free < 0) return -1;
+    motion->track[free].object = object;
+    motion->track[free].type = MOTION_STILL;
+    sceneSetDynamic(scene, object);
+    if (!scene->gridValid) sceneBuildGrid(scene);
+    return free;
+}
+
+/*******************************************************************************
+  * @name   motionStop
+  * @brief  The object stays where it is now.
+  * @param  motion: tracks.
+  * @param  track: from motionAttach.
+  * @retval None.
+  */
+void motionStop( SceneMotion *motion, int track )
+{
+    if ((track < 0) || (track >= MOTION_MAX_TRACKS)) return;
+    motion->track[track].type = MOTION_STILL;
+}
+
+/*******************************************************************************
+  * @name   motionSetVelocity
+  * @brief  Constant velocity from where the object is now.
+  * @param  motion: tracks.
+  * @param  scene: scene, for the position now.
+  * @param  track: from motionAttach.
+  * @param  vx, vy, vz: mm/s.
+  * @param  now_us: getTime_us clock.
+  * @retval None.
+  */
+void motionSetVelocity( SceneMotion *motion, const Scene *scene, int track, float vx, float vy, float vz,
+                        double now_us )
+{
+    MotionTrack *t;
+
+    if ((track < 0) || (track >= MOTION_MAX_TRACKS) || (motion->track[track].object < 0)) return;
+    t = &motion->track[track];
+    t->start[0] = scene->px[t->object];
+    t->start[1] = scene->py[t->object];
+    t->start[2] = scene->pz[t->object];
+    t->velocity[0] = vx;
+    t->velocity[1] = vy;
+    t->velocity[2] = vz;
+    t->start_us = now_us;
+    t->type = MOTION_VELOCITY;
+}
+
+/*******************************************************************************
+  * @name   motionSetWaypoints
+  * @brief  Spline through waypoints, starting at the first one now.
+  * @param  motion: tracks.
+  * @param  track: from motionAttach.
+  * @param  points: positions of p, mm.
+  * @param  count: 1 to MOTION_MAX_KEYS.
+  * @param  segment_us: time from one waypoint to the next.
+  * @param  loop: 1 to go back to the first one and around again.
+  * @param  now_us: getTime_us clock.
+  * @retval 0 if ok, -1 if the arguments are not.
+  */
+int motionSetWaypoints( SceneMotion *motion, int track, const float points[][3], int count, double segment_us,
+                        int loop, double now_us )
+{
+    MotionTrack *t;
+
+    if ((track < 0) || (track >= MOTION_MAX_TRACKS) || (motion->track[track].object < 0)) return -1;
+    if ((count < 1) || (count > MOTION_MAX_KEYS) || !(segment_us > 0.0)) return -1;
+    t = &motion->track[track];
+    for (int j = 0; j < count; j++) copy3(points[j], t->key[j]);
+    t->count = count;
+    t->segment_us = segment_us;
+    t->loop = loop;
+    t->start_us = now_us;
+    t->type = MOTION_WAYPOINTS;
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   motionAddKeyframe
+  * @brief  Adds a host keyframe, the track turns to MOTION_KEYFRAMES if it
+  *         was not. The host clock is mapped with the smallest delay seen
+  *         (rising back slowly, MOTION_CLOCK_FOLLOW, for the clock drift).
+  * @param  motion: tracks.
+  * @param  track: from motionAttach.
+  * @param  host_us: host clock of the position.
+  * @param  position: p, mm.
+  * @param  now_us: getTime_us clock, when it arrived.
+  * @retval 1 if kept, 0 if older than the last one.
+  */
+int motionAddKeyframe( SceneMotion *motion, int track, uint32_t host_us, const float position[3], double now_us )
+{
+    MotionTrack *t;
+    double delay, at;
+    int i;
+
+    if ((track < 0) || (track >= MOTION_MAX_TRACKS) || (motion->track[track].object < 0)) return 0;
+    t = &motion->track[track];
+    if (t->type != MOTION_KEYFRAMES)
+    {
+        t->type = MOTION_KEYFRAMES;
+        t->count = 0;
+        t->head = 0;
+        t->synced = 0;
+    }
+    if (t->synced)
+    {
+        int32_t step = (int32_t)(host_us - t->lastHost_us);
+        if (step <= 0)
+        {
+            motion->keysRejected++;
+            return 0;
+        }
+        t->host_us += step;
+        delay = now_us - t->host_us;
+        t->offset_us = (delay < t->offset_us) ? delay : t->offset_us + (delay - t->offset_us) * MOTION_CLOCK_FOLLOW;
+    }
+    else
+    {
+        t->host_us = 0.0;
+        t->offset_us = now_us;
+        t->synced = 1;
+    }
+    t->lastHost_us = host_us;
+
+    at = t->host_us + t->offset_us + MOTION_KEY_DELAY_US;
+    if (t->count > 0)
+    {
+        double last = t->keyTime_us[keyIndex(t, t->count - 1)];
+        if (at <= last) at = last + 1.0;    // the offset came down, keep the keys in order
+    }
+    if (t->count < MOTION_MAX_KEYS)
+    {
+        i = keyIndex(t, t->count);
+        t->count++;
+    }
+    else
+    {
+        i = t->head;
+        t->head = (t->head + 1) % MOTION_MAX_KEYS;
+    }
+    copy3(position, t->key[i]);
+    t->keyTime_us[i] = at;
+    motion->keysAccepted++;
+    return 1;
+}
+
+/*******************************************************************************
+  * @name   motionPosition
+  * @brief  Where the model of a track puts the object at a time.
+  * @param  track: track.
+  * @param  now_us: getTime_us clock.
+  * @param  position: p, mm; left as it is for a still track.
+  * @retval None.
+  */
+void motionPosition( const MotionTrack *track, double now_us, float position[3] )
+{
+    switch (track->type)
+    {
+        case MOTION_VELOCITY:
+        {
+            float dt = (float)((now_us - track->start_us) * 1e-6);
+            for (int k = 0; k < 3; k++) position[k] = track->start[k] + track->velocity[k] * dt;
+            break;
+        }
+        case MOTION_WAYPOINTS:
+            waypointsPosition(track, now_us, position);
+            break;
+        case MOTION_KEYFRAMES:
+            keyframesPosition(track, now_us, position);
+            break;
+    }
+}
+
+/*******************************************************************************
+  * @name   motionUpdate
+  * @brief  Moves every tracked object to its position now. Call every render
+  *         tick, before the contact queries.
+  * @param  motion: tracks.
+  * @param  scene: scene.
+  * @param  now_us: getTime_us clock.
+  * @retval None.
+  */
+void motionUpdate( SceneMotion *motion, Scene *scene, double now_us )
+{
+    for (int i = 0; i < MOTION_MAX_TRACKS; i++)
+    {
+        const MotionTrack *track = &motion->track[i];
+        float p[3];
+
+        if ((track->object < 0) || (track->type == MOTION_STILL)) continue;
+        p[0] = scene->px[track->object];
+        p[1] = scene->py[track->object];
+        p[2] = scene->pz[track->object];
+        motionPosition(track, now_us, p);
+        sceneMoveObject(scene, track->object, p[0], p[1], p[2]);
+    }
+}
+
+/*******************************************************************************
+  * @name   motionPack
+  * @brief  Packs an object keyframe frame (host side).
+  * @param  frame: at least MOTION_MAX_FRAME_SIZE bytes.
+  * @param  host_us: host clock of the positions.
+  * @param  objects: scene indices.
+  * @param  positions: p of each, mm.
+  * @param  count: at most MOTION_FRAME_MAX_ENTRIES.
+  * @retval number of bytes in the frame.
+  */
+int motionPack( uint8_t *frame, uint32_t host_us, const uint8_t objects[], const float positions[][3], int count )
+{
+    uint8_t * payload = &frame[3];
+    int n = MOTION_FRAME_HEADER, j, k;
+
+    if (count > MOTION_FRAME_MAX_ENTRIES) count = MOTION_FRAME_MAX_ENTRIES;
+    for (k = 0; k < 4; k++) payload[k] = (host_us >> (8 * k)) & 0xFF;
+    payload[4] = (uint8_t)count;
+    for (j = 0; j < count; j++)
+    {
+        payload[n] = objects[j];
+        for (k = 0; k < 3; k++) putInt16(positions[j][k] * MOTION_POSITION_SCALE, &payload[n + 1 + 2 * k]);
+        n += MOTION_FRAME_ENTRY;
+    }
+    return telemetryFinishFrame(frame, MOTION_FRAME_TYPE, n);
+}
+
+/*******************************************************************************
+  * @name   motionReceive
+  * @brief  Checks an object keyframe frame and adds its keys, attaching a
+  *         track to the objects that have none.
+  * @param  motion: tracks.
+  * @param  scene: scene.
+  * @param  frame: whole frame starting at the sync byte.
+  * @param  now_us: getTime_us clock, when it arrived.
+  * @retval 1 if the frame was good, 0 otherwise.
+  */
+int motionReceive( SceneMotion *motion, Scene *scene, const uint8_t *frame, double now_us )
+{
+    const uint8_t * payload = &frame[3];
+    uint8_t length = frame[2];
+    uint32_t host_us;
+    int count, j, k;
+
+    if ((frame[1] != MOTION_FRAME_TYPE) || (length < MOTION_FRAME_HEADER)) return 0;
+    count = payload[4];
+    if ((count > MOTION_FRAME_MAX_ENTRIES) || (length != MOTION_FRAME_HEADER + MOTION_FRAME_ENTRY * count) ||
+        (telemetryCrc8(&frame[1], length + 2) != payload[length]))
+    {
+        return 0;
+    }
+    host_us = payload[0] | (payload[1] << 8) | (payload[2] << 16) | ((uint32_t)payload[3] << 24);
+    for (j = 0; j < count; j++)
+    {
+        const uint8_t * entry = &payload[MOTION_FRAME_HEADER + MOTION_FRAME_ENTRY * j];
+        float position[3];
+        int track = motionAttach(motion, scene, entry[0]);
+        if (track < 0)
+        {
+            motion->keysRejected++;
+            continue;
+        }
+        for (k = 0; k < 3; k++) position[k] = getInt16(&entry[1 + 2 * k]) / MOTION_POSITION_SCALE;
+        motionAddKeyframe(motion, track, host_us, position, now_us);
+    }
+    return 1;
+}
+//EOF
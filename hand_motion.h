@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    hand_motion.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Moving scene objects. A track gives one object of the scene
+  *          (hand_scene.h) a motion model, and motionUpdate moves the
+  *          object to where its model is every render tick, so a moving
+  *          target renders smoothly at the servo rate whatever rate its
+  *          motion comes at. Models (positions are the object's p, as it
+  *          was added, hand frame in mm; no rotation):
+  *           - MOTION_VELOCITY: constant velocity from where it was;
+  *           - MOTION_WAYPOINTS: a Catmull-Rom spline through up to
+  *             MOTION_MAX_KEYS points, one segment every segment_us, open
+  *             (stops at the last one) or looped;
+  *           - MOTION_KEYFRAMES: positions streamed by the host with its
+  *             clock ('M' frames below), kept in a ring of MOTION_MAX_KEYS
+  *             and played MOTION_KEY_DELAY_US late on the device clock, so
+  *             the next key is normally in when the object gets to the
+  *             last one; between keys a cubic through the neighbours
+  *             (same curve as the waypoints, for uneven times), past the
+  *             last one the object keeps its velocity for
+  *             MOTION_MAX_EXTRAPOLATE_US and stops.
+  *          The tracked objects become dynamic (sceneSetDynamic), so the
+  *          grid is built again when a track is attached. Fixed arrays, a
+  *          tick costs a few multiply-adds per track.
+  *          Only needs math.h so the host tools can use it.
+  ******************************************************************************
+  */
+#ifndef __HAND_MOTION_H_
+#define __HAND_MOTION_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "hand_scene.h"
+#include "haplink_telemetry.h"
+
+#define MOTION_MAX_TRACKS           8
+#define MOTION_MAX_KEYS             8       // waypoints, or keyframes kept
+
+// Motion models
+#define MOTION_STILL                0
+#define MOTION_VELOCITY             1
+#define MOTION_WAYPOINTS            2
+#define MOTION_KEYFRAMES            3
+
+#define MOTION_KEY_DELAY_US         20000.0 // keyframes play this late (two keys at 100 Hz)
+#define MOTION_MAX_EXTRAPOLATE_US   50000.0 // past the last keyframe, then the object stops
+#define MOTION_CLOCK_FOLLOW         0.01    // how fast the host clock offset rises back after a fast frame
+
+/* Object keyframe frame -----------------------------------------------------*/
+// Sent by the host as a telemetry frame (haplink_telemetry.h):
+//    [0xA5]['M'][len][payload][crc8]
+// payload: [host timestamp us, uint32][count], then count entries of
+//    [object][x y z]
+//    object:     index in the scene (the device attaches a keyframe track to it)
+//    x y z:      new p of the object, 1/100 mm, int16 each
+// All multi-byte values little endian.
+#define MOTION_FRAME_TYPE           'M'
+#define MOTION_FRAME_HEADER         5       // timestamp, count
+#define MOTION_FRAME_ENTRY          7
+#define MOTION_FRAME_MAX_ENTRIES    MOTION_MAX_TRACKS
+#define MOTION_MAX_FRAME_SIZE       (MOTION_FRAME_HEADER + MOTION_FRAME_ENTRY * MOTION_FRAME_MAX_ENTRIES + TELEMETRY_FRAME_OVERHEAD)
+#define MOTION_POSITION_SCALE       100.0f  // counts per mm
+
+typedef struct {
+    int object;                 // scene index, -1 for a free track
+    uint8_t type;
+    float start[3];             // MOTION_VELOCITY: p at start_us
+    float velocity[3];          // mm/s
+    double start_us;
+    // MOTION_WAYPOINTS: key[0 .. count - 1] every segment_us
+    // MOTION_KEYFRAMES: ring, oldest at head, keyTime_us on the device clock
+    int count, head, loop;
+    double segment_us;
+    float key[MOTION_MAX_KEYS][3];
+    double keyTime_us[MOTION_MAX_KEYS];
+    // host clock: device = host + offset_us, host times unwrapped from uint32
+    int synced;
+    double offset_us;
+    double host_us;
+    uint32_t lastHost_us;
+} MotionTrack;
+
+typedef struct {
+    MotionTrack track[MOTION_MAX_TRACKS];
+    uint32_t keysAccepted, keysRejected;
+} SceneMotion;
+
+extern SceneMotion handMotion;
+
+/******* Function prototypes ****/
+void motionInit( SceneMotion *motion );
+int motionAttach( SceneMotion *motion, Scene *scene, int object );
+void motionStop( SceneMotion *motion, int track );
+void motionSetVelocity( SceneMotion *motion, const Scene *scene, int track, float vx, float vy, float vz,
+                        double now_us );
+int motionSetWaypoints( SceneMotion *motion, int track, const float points[][3], int count, double segment_us,
+                        int loop, double now_us );
+int motionAddKeyframe( SceneMotion *motion, int track, uint32_t host_us, const float position[3], double now_us );
+void motionPosition( const MotionTrack *track, double now_us, float position[3] );
+void motionUpdate( SceneMotion *motion, Scene *scene, double now_us );
+int motionPack( uint8_t *frame, uint32_t host_us, const uint8_t objects[], const float positions[][3], int count );
+int motionReceive( SceneMotion *motion, Scene *scene, const uint8_t *frame, double now_us );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_MOTION_H_
+//EOF
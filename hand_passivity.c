@@ -0,0 +1,97 @@
+/**
+  ******************************************************************************
+  * @file    hand_passivity.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Passivity observer and controller (see hand_passivity.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_passivity.h"
+#include <math.h>
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   passivityReset
+  * @brief  Clears the observer, the next update only records the position.
+  * @param  port: port.
+  * @param  axes: 1 to PASSIVITY_MAX_AXES.
+  * @retval None.
+  */
+void passivityReset( PassivityPort *port, int axes )
+{
+    int k;
+
+    port->axes = (axes > PASSIVITY_MAX_AXES) ? PASSIVITY_MAX_AXES : axes;
+    port->valid = 0;
+    for (k = 0; k < PASSIVITY_MAX_AXES; k++)
+    {
+        port->lastX[k] = 0.0f;
+        port->lastForce[k] = 0.0f;
+        port->lastDamping[k] = 0.0f;
+    }
+    port->energy = 0.0f;
+    port->dissipated = 0.0f;
+    port->damping = 0.0f;
+}
+
+/*******************************************************************************
+  * @name   passivityUpdate
+  * @brief  Observes the last tick and adds the damping for the next one.
+  *         The energy is -lastForce . (x - lastX), the force that was really
+  *         held over the tick. While the environment pushes nothing (free
+  *         space) it stores nothing either, so a positive sum is dropped
+  *         there and an old contact cannot pay for chatter on the next one.
+  * @param  port: port of this contact point.
+  * @param  x: position now, mm.
+  * @param  force: force of the environment on the user for the next tick, N;
+  *         the damping is added to it.
+  * @param  dt: s since the last update.
+  * @param  maxDamping: N s/m, 0 only observes.
+  * @retval damping used, N s/m.
+  */
+float passivityUpdate( PassivityPort *port, const float x[], float force[], float dt, float maxDamping )
+{
+    float moved2 = 0.0f, environment2 = 0.0f, damping = 0.0f;
+    float dx[PASSIVITY_MAX_AXES];
+    int k;
+
+    if (!port->valid)
+    {
+        for (k = 0; k < port->axes; k++) dx[k] = 0.0f;
+        port->valid = 1;
+    }
+    else
+    {
+        for (k = 0; k < port->axes; k++)
+        {
+            dx[k] = x[k] - port->lastX[k];
+            moved2 += dx[k] * dx[k];
+            port->energy -= port->lastForce[k] * dx[k];
+            port->dissipated -= port->lastDamping[k] * dx[k];
+        }
+    }
+    for (k = 0; k < port->axes; k++) environment2 += force[k] * force[k];
+    if ((environment2 == 0.0f) && (port->energy > 0.0f)) port->energy = 0.0f;
+
+    // b v^2 dt = -energy over the next tick at the same velocity, b in N s/m and mm
+    if ((port->energy < 0.0f) && (moved2 > 0.0f) && (dt > 0.0f))
+    {
+        damping = -port->energy * 1000.0f * dt / moved2;
+        if (damping > maxDamping) damping = maxDamping;
+    }
+    for (k = 0; k < port->axes; k++)
+    {
+        float f = (damping > 0.0f) ? -damping * dx[k] / (1000.0f * dt) : 0.0f;    // N
+        force[k] += f;
+        port->lastDamping[k] = f;
+        port->lastForce[k] = force[k];
+        port->lastX[k] = x[k];
+    }
+    port->damping = damping;
+    return damping;
+}
+//EOF
@@ -0,0 +1,47 @@
+/**
+  ******************************************************************************
+  * @file    hand_passivity.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Time domain passivity observer and controller for one contact
+  *          point (a port): the thumb or a finger. Every tick the observer
+  *          adds the energy the virtual environment took from the user
+  *          during the last tick (minus the force held over the tick times
+  *          the displacement). A sampled stiff wall gives back more than it
+  *          took, which is what makes it chatter; when the sum goes negative
+  *          the controller adds a damping force sized to dissipate exactly
+  *          the deficit over the next tick, at most maxDamping. O(1) per
+  *          tick and per axis. Only needs math.h, see tools/sim_passivity.c.
+  ******************************************************************************
+  */
+#ifndef __HAND_PASSIVITY_H_
+#define __HAND_PASSIVITY_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#define PASSIVITY_MAX_AXES      3
+
+typedef struct {
+    int axes;                           // 3 for the thumb, 2 for a finger
+    int valid;                          // 0 until the first update
+    float lastX[PASSIVITY_MAX_AXES];    // mm
+    float lastForce[PASSIVITY_MAX_AXES];    // N, output held over the last tick (damping included)
+    float lastDamping[PASSIVITY_MAX_AXES];  // N, damping part of it
+    float energy;                       // mJ, taken from the user so far, negative = generated
+    float dissipated;                   // mJ, taken out by the damping so far
+    float damping;                      // N s/m, on the last tick
+} PassivityPort;
+
+/******* Function prototypes ****/
+void passivityReset( PassivityPort *port, int axes );
+float passivityUpdate( PassivityPort *port, const float x[], float force[], float dt, float maxDamping );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_PASSIVITY_H_
+//EOF
@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    hand_proxy.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   God-object contact (see hand_proxy.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_proxy.h"
+#include <math.h>
+
+/* Static Functions ----------------------------------------------------------*/
+
+static float dot3( const float a[3], const float b[3] )
+{
+    return a[0]*b[0] + a[1]*b[1] + a[2]*b[2];
+}
+
+// surfaces the proxy rests on (their normals, the largest stiffness and
+// friction) and the distance to the closest of the others
+static int proxyConstraints( HandProxy *proxy, const Scene *scene, const uint16_t near[], int n,
+                             float normals[PROXY_MAX_CONSTRAINTS][3], float *free )
+{
+    int i, k, active = 0;
+
+    proxy->stiffness = 0.0f;
+    proxy->staticFriction = 0.0f;
+    proxy->kineticFriction = 0.0f;
+    *free = INFINITY;
+    for (i = 0; i < n; i++)
+    {
+        float normal[3];
+        float d = sceneObjectDistance(scene, near[i], proxy->p, normal);
+        if (d < PROXY_CONTACT_EPSILON)
+        {
+            if (active < PROXY_MAX_CONSTRAINTS)
+            {
+                for (k = 0; k < 3; k++) normals[active][k] = normal[k];
+            }
+            active++;
+            if (scene->stiffness[near[i]] > proxy->stiffness) proxy->stiffness = scene->stiffness[near[i]];
+            if (scene->staticFriction[near[i]] > proxy->staticFriction)
+            {
+                proxy->staticFriction = scene->staticFriction[near[i]];
+                proxy->kineticFriction = scene->kineticFriction[near[i]];
+            }
+        }
+        else if (d < *free)
+        {
+            *free = d;
+        }
+    }
+    return active;
+}
+
+// friction cone on one surface: start is where the proxy rested the tick
+// before (on proxy->normal), proxy->p where it slid to without friction; the
+// proxy stays at start or goes part of the way. 1 if it moved it
+static int proxyFriction( HandProxy *proxy, const Scene *scene, const uint16_t near[], int n,
+                          const float start[3], const float device[3] )
+{
+    const float *surface = proxy->normal;
+    float normal[3], offset[3], slid[3], depth, tangent, cone, closest;
+    int i, k;
+
+    // the device against start, along the normal and across
+    for (k = 0; k < 3; k++) offset[k] = device[k] - start[k];
+    depth = -dot3(offset, surface);
+    if (depth <= 0.0f)
+    {
+        proxy->sliding = 0;
+        return 0;
+    }
+    for (k = 0; k < 3; k++) offset[k] += depth * surface[k];
+    tangent = sqrtf(dot3(offset, offset));
+
+    // stick: inside the cone (the kinetic one once it slides)
+    cone = (proxy->sliding ? proxy->kineticFriction : proxy->staticFriction) * depth;
+    if (tangent <= cone)
+    {
+        proxy->sliding = 0;
+        for (k = 0; k < 3; k++) proxy->p[k] = start[k];
+        return 1;
+    }
+
+    // slip: from start toward the frictionless proxy, to the kinetic cone, back onto the surface
+    proxy->sliding = 1;
+    cone = 1.0f - proxy->kineticFriction * depth / tangent;
+    for (k = 0; k < 3; k++)
+    {
+        slid[k] = proxy->p[k];
+        proxy->p[k] = start[k] + (slid[k] - start[k]) * cone;
+    }
+    closest = INFINITY;
+    for (i = 0; i < n; i++)
+    {
+        float d = sceneObjectDistance(scene, near[i], proxy->p, normal);
+        if (d < 0.0f)
+        {
+            for (k = 0; k < 3; k++) proxy->p[k] -= d * normal[k];
+            d = 0.0f;
+        }
+        if (d < closest) closest = d;
+    }
+    // off a hollow surface: the frictionless one then
+    if (closest >= PROXY_CONTACT_EPSILON)
+    {
+        for (k = 0; k < 3; k++) proxy->p[k] = slid[k];
+    }
+    return 1;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   handProxyReset
+  * @brief  Forgets the proxy, the next update starts it at the device.
+  * @param  proxy: proxy.
+  * @retval None.
+  */
+void handProxyReset( HandProxy *proxy )
+{
+    proxy->valid = 0;
+    proxy->contacts = 0;
+    proxy->sliding = 0;
+    proxy->normal[0] = proxy->normal[1] = proxy->normal[2] = 0.0f;
+    proxy->stiffness = 0.0f;
+    proxy->staticFriction = 0.0f;
+    proxy->kineticFriction = 0.0f;
+}
+
+/*******************************************************************************
+  * @name   handProxyUpdate
+  * @brief  Moves the proxy toward the device, PROXY_ITERATIONS times:
+  *         the part of the move going into a surface it rests on is
+  *         removed (it slides), the move stops at the distance of the
+  *         closest other surface (it cannot jump over an object however
+  *         fast the device goes) and any surface it still went into pushes
+  *         it back out along its normal. A device that starts inside an
+  *         object puts the proxy on the closest surface, and so does an
+  *         object moving onto the proxy: it pushes the proxy ahead of it.
+  *         With friction on the surface it rested on, the friction cone
+  *         then decides how much of the slide it keeps.
+  * @param  proxy: proxy of this contact point.
+  * @param  scene: objects, looked up with sceneObjectsNear.
+  * @param  device: contact point, mm.
+  * @param  force: stiffness * (proxy - device) while the proxy rests on a
+  *         surface (across it too, with friction), 0 otherwise; same units
+  *         as sceneQueryPoints (multiply by the limb gain / 1000 for N).
+  * @retval number of surfaces the proxy rests on.
+  */
+int handProxyUpdate( HandProxy *proxy, Scene *scene, const float device[3], float force[3] )
+{
+    uint16_t near[SCENE_MAX_OBJECTS];
+    float normals[PROXY_MAX_CONSTRAINTS][3];
+    float lo[3], hi[3], start[3], free;
+    int n, i, k, a, pass, iteration, active, rested;
+
+    if (!proxy->valid)
+    {
+        for (k = 0; k < 3; k++) proxy->p[k] = device[k];
+        proxy->valid = 1;
+    }
+
+    // everything the proxy could touch on its way to the device
+    for (k = 0; k < 3; k++)
+    {
+        lo[k] = fminf(proxy->p[k], device[k]) - PROXY_SEARCH_MARGIN;
+        hi[k] = fmaxf(proxy->p[k], device[k]) + PROXY_SEARCH_MARGIN;
+    }
+    n = sceneObjectsNear(scene, lo, hi, near, SCENE_MAX_OBJECTS);
+
+    // objects that moved into the proxy since the last tick (hand_motion.h) carry it out
+    for (i = 0; i < n; i++)
+    {
+        float normal[3];
+        float d = sceneObjectDistance(scene, near[i], proxy->p, normal);
+        if (d < 0.0f)
+        {
+            for (k = 0; k < 3; k++) proxy->p[k] -= d * normal[k];
+        }
+    }
+
+    rested = proxy->contacts;
+    for (k = 0; k < 3; k++) start[k] = proxy->p[k];
+
+    for (iteration = 0; iteration < PROXY_ITERATIONS; iteration++)
+    {
+        float dir[3], length, step;
+
+        active = proxyConstraints(proxy, scene, near, n, normals, &free);
+        if (active > PROXY_MAX_CONSTRAINTS) active = PROXY_MAX_CONSTRAINTS;
+
+        // slide: drop the part of the move that goes into a surface (twice, for creases)
+        for (k = 0; k < 3; k++) dir[k] = device[k] - proxy->p[k];
+        for (pass = 0; pass < 2; pass++)
+        {
+            for (a = 0; a < active; a++)
+            {
+                float into = dot3(dir, normals[a]);
+                if (into < 0.0f)
+                {
+                    for (k = 0; k < 3; k++) dir[k] -= into * normals[a][k];
+                }
+            }
+        }
+        for (a = 0; a < active; a++)
+        {
+            if (dot3(dir, normals[a]) < -PROXY_CONTACT_EPSILON) dir[0] = dir[1] = dir[2] = 0.0f;   // in a corner
+        }
+
+        length = sqrtf(dot3(dir, dir));
+        if (length < PROXY_CONTACT_EPSILON) break;
+        step = (length < free) ? length : free;
+        for (k = 0; k < 3; k++) proxy->p[k] += dir[k] * (step / length);
+
+        // back onto the surfaces it went into
+        for (i = 0; i < n; i++)
+        {
+            float normal[3];
+            float d = sceneObjectDistance(scene, near[i], proxy->p, normal);
+            if (d < 0.0f)
+            {
+                for (k = 0; k < 3; k++) proxy->p[k] -= d * normal[k];
+            }
+        }
+    }
+
+    active = proxyConstraints(proxy, scene, near, n, normals, &free);
+
+    // friction, on the surface it already rested on (in a crease or a corner the
+    // surfaces hold it already)
+    if ((active == 1) && (rested == 1) && (proxy->staticFriction > 0.0f) &&
+        proxyFriction(proxy, scene, near, n, start, device))
+    {
+        active = proxyConstraints(proxy, scene, near, n, normals, &free);
+    }
+    if (active == 1)
+    {
+        for (k = 0; k < 3; k++) proxy->normal[k] = normals[0][k];
+    }
+    else
+    {
+        proxy->sliding = 0;
+    }
+    proxy->contacts = active;
+    for (k = 0; k < 3; k++) force[k] = (active > 0) ? proxy->stiffness * (proxy->p[k] - device[k]) : 0.0f;
+    return active;
+}
+//EOF
@@ -0,0 +1,62 @@
+/**
+  ******************************************************************************
+  * @file    hand_proxy.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   God-object (proxy) contact for the points of the hand. Each
+  *          contact point has a proxy that follows the device in free space
+  *          and stays on the surface of the scene objects when the device
+  *          goes into them: every tick it moves toward the device as far as
+  *          the free space allows, slides along the surfaces it touches and
+  *          is put back on them, a fixed number of times
+  *          (PROXY_ITERATIONS). The force is the spring from the device to
+  *          the proxy, so it never flips when the device crosses the middle
+  *          of a thin or small object, which the penetration depth force of
+  *          sceneQueryPoints does.
+  *          Friction (sceneSetFriction) is a friction cone on the proxy: on
+  *          one surface it rested on the tick before, the proxy stays where it
+  *          was while the device is inside the cone of staticFriction around
+  *          the normal, so the spring pulls back across the surface too
+  *          (stick); past it the proxy slides after the device, held on the
+  *          cone of kineticFriction, until the device comes back inside
+  *          that one (slip). Two floats and a flag of state, a few
+  *          multiply-adds per tick. Only needs math.h, see
+  *          tools/sim_hand_proxy.c and tools/sim_hand_friction.c.
+  ******************************************************************************
+  */
+#ifndef __HAND_PROXY_H_
+#define __HAND_PROXY_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "hand_scene.h"
+
+#define PROXY_ITERATIONS        4       // constraint iterations per tick
+#define PROXY_CONTACT_EPSILON   0.01f   // mm, closer to a surface than this is touching it
+#define PROXY_MAX_CONSTRAINTS   3       // surfaces the proxy can rest on at once
+#define PROXY_SEARCH_MARGIN     1.0f    // mm around the move where objects are looked for
+
+typedef struct {
+    float p[3];             // proxy, mm
+    float stiffness;        // largest of the objects it rests on
+    float staticFriction;   // largest of the objects it rests on
+    float kineticFriction;
+    int sliding;            // 1 while it slides on them, 0 while it sticks
+    float normal[3];        // of the surface it rests on, when it is only one
+    int contacts;           // surfaces it rests on after the last update
+    int valid;              // 0 until the first update
+} HandProxy;
+
+/******* Function prototypes ****/
+void handProxyReset( HandProxy *proxy );
+int handProxyUpdate( HandProxy *proxy, Scene *scene, const float device[3], float force[3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_PROXY_H_
+//EOF
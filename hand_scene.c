@@ -0,0 +1,661 @@
+/**
+  ******************************************************************************
+  * @file    hand_scene.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Primitive pool and contact queries (see hand_scene.h). Every
+  *          primitive is a signed distance: negative inside, with the
+  *          outward normal, and a point inside an object is pushed out with
+  *          stiffness * depth along that normal.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_scene.h"
+#include <math.h>
+
+/* Global Variables ----------------------------------------------------------*/
+Scene handScene;
+
+/* Static Functions ----------------------------------------------------------*/
+
+// next free slot, filled with what every type has, -1 if the pool is full
+static int sceneAdd( Scene *scene, int type, float x, float y, float z, float ax, float ay, float az,
+                     float radius, float stiffness )
+{
+    int i = scene->count;
+
+    if (i >= SCENE_MAX_OBJECTS) return -1;
+    scene->type[i] = (uint8_t)type;
+    scene->px[i] = x;  scene->py[i] = y;  scene->pz[i] = z;
+    scene->ax[i] = ax; scene->ay[i] = ay; scene->az[i] = az;
+    scene->radius[i] = radius;
+    scene->stiffness[i] = stiffness;
+    scene->staticFriction[i] = 0.0f;
+    scene->kineticFriction[i] = 0.0f;
+    scene->invLength2[i] = 0.0f;
+    scene->sdf[i] = 0;
+    scene->dynamic[i] = 0;
+    scene->count = i + 1;
+    scene->gridValid = 0;
+    return i;
+}
+
+// 1 / |a - p|^2 for the objects with an axis, 0 if the ends are the same point
+static void sceneSetAxis( Scene *scene, int i )
+{
+    float dx = scene->ax[i] - scene->px[i];
+    float dy = scene->ay[i] - scene->py[i];
+    float dz = scene->az[i] - scene->pz[i];
+    float length2 = dx*dx + dy*dy + dz*dz;
+
+    scene->invLength2[i] = (length2 > 0.0f) ? 1.0f / length2 : 0.0f;
+}
+
+// |v| - radius with v / |v| as the normal, straight up at the center
+static float roundDistance( float vx, float vy, float vz, float radius, float normal[3] )
+{
+    float length = sqrtf(vx*vx + vy*vy + vz*vz);
+
+    if (length > 0.0f)
+    {
+        float inv = 1.0f / length;
+        normal[0] = vx * inv; normal[1] = vy * inv; normal[2] = vz * inv;
+    }
+    else
+    {
+        normal[0] = 0.0f; normal[1] = 0.0f; normal[2] = 1.0f;
+    }
+    return length - radius;
+}
+
+static float boxDistance( const Scene *scene, int i, const float point[3], float normal[3] )
+{
+    float q[3] = { point[0] - scene->px[i], point[1] - scene->py[i], point[2] - scene->pz[i] };
+    float half[3] = { scene->ax[i], scene->ay[i], scene->az[i] };
+    float outside[3], largest = -INFINITY;
+    int axis = 0, k;
+
+    for (k = 0; k < 3; k++)
+    {
+        float d = fabsf(q[k]) - half[k];
+        outside[k] = (d > 0.0f) ? ((q[k] > 0.0f) ? d : -d) : 0.0f;
+        if (d > largest) { largest = d; axis = k; }
+    }
+    if (largest > 0.0f)
+    {
+        // outside: distance to the closest point of the surface
+        return roundDistance(outside[0], outside[1], outside[2], 0.0f, normal);
+    }
+    // inside: out through the closest face
+    normal[0] = normal[1] = normal[2] = 0.0f;
+    normal[axis] = (q[axis] >= 0.0f) ? 1.0f : -1.0f;
+    return largest;
+}
+
+static float cylinderDistance( const Scene *scene, int i, const float point[3], float normal[3] )
+{
+    float axisX = scene->ax[i] - scene->px[i];
+    float axisY = scene->ay[i] - scene->py[i];
+    float axisZ = scene->az[i] - scene->pz[i];
+    float qx = point[0] - scene->px[i], qy = point[1] - scene->py[i], qz = point[2] - scene->pz[i];
+    float t = (qx*axisX + qy*axisY + qz*axisZ) * scene->invLength2[i];     // 0 .. 1 between the caps
+    float length = sqrtf(axisX*axisX + axisY*axisY + axisZ*axisZ);
+    float radial[3];
+    float side = roundDistance(qx - axisX*t, qy - axisY*t, qz - axisZ*t, scene->radius[i], radial);
+    float cap = ((t < 0.5f) ? -t : t - 1.0f) * length;                  // outside the caps if > 0
+    float capSign = (t < 0.5f) ? -1.0f : 1.0f;
+    float inv = (length > 0.0f) ? capSign / length : 0.0f;
+    int k;
+
+    if ((side > 0.0f) && (cap > 0.0f))
+    {
+        // past a rim
+        float d = sqrtf(side*side + cap*cap);
+        float a = side / d, b = cap / d;
+        normal[0] = radial[0]*a + axisX*inv*b;
+        normal[1] = radial[1]*a + axisY*inv*b;
+        normal[2] = radial[2]*a + axisZ*inv*b;
+        return d;
+    }
+    if (side > cap)
+    {
+        for (k = 0; k < 3; k++) normal[k] = radial[k];
+        return side;
+    }
+    normal[0] = axisX*inv; normal[1] = axisY*inv; normal[2] = axisZ*inv;
+    return cap;
+}
+
+// box around object i, 0 for the half spaces that have none and the
+// dynamic objects that do not keep theirs
+static int objectBounds( const Scene *scene, int i, float lo[3], float hi[3] )
+{
+    float p[3] = { scene->px[i], scene->py[i], scene->pz[i] };
+    float a[3] = { scene->ax[i], scene->ay[i], scene->az[i] };
+    float r = scene->radius[i];
+    int k;
+
+    if (scene->dynamic[i]) return 0;
+    for (k = 0; k < 3; k++)
+    {
+        switch (scene->type[i])
+        {
+            case SCENE_SPHERE:
+                lo[k] = p[k] - r; hi[k] = p[k] + r;
+                break;
+            case SCENE_BOX:
+                lo[k] = p[k] - a[k]; hi[k] = p[k] + a[k];
+                break;
+            case SCENE_SDF:
+                lo[k] = p[k]; hi[k] = a[k];
+                break;
+            case SCENE_CAPSULE:
+            case SCENE_CYLINDER:    // the capsule around it, a little larger
+                lo[k] = fminf(p[k], a[k]) - r; hi[k] = fmaxf(p[k], a[k]) + r;
+                break;
+            default:
+                return 0;
+        }
+    }
+    return 1;
+}
+
+// cell range covered by a box, clamped to the grid (the border cells reach to infinity)
+static void cellRange( const Scene *scene, const float lo[3], const float hi[3], int first[3], int last[3] )
+{
+    int k;
+
+    for (k = 0; k < 3; k++)
+    {
+        float f0 = (lo[k] - scene->gridMin[k]) * scene->gridInvCell[k];
+        float f1 = (hi[k] - scene->gridMin[k]) * scene->gridInvCell[k];
+        // NaN goes to cell 0
+        first[k] = !(f0 >= 0.0f) ? 0 : (f0 >= SCENE_GRID_N) ? SCENE_GRID_N - 1 : (int)f0;
+        last[k] = !(f1 >= 0.0f) ? 0 : (f1 >= SCENE_GRID_N) ? SCENE_GRID_N - 1 : (int)f1;
+    }
+}
+
+static int cellIndex( int x, int y, int z )
+{
+    return (z * SCENE_GRID_N + y) * SCENE_GRID_N + x;
+}
+
+// cell of contact point j, from the cache while the point stays inside it
+static int pointCell( Scene *scene, int j, const float point[3] )
+{
+    int c[3], k;
+
+    if ((j < SCENE_MAX_POINTS) && (scene->lastCell[j] >= 0) &&
+        (point[0] >= scene->lastLo[j][0]) && (point[0] < scene->lastHi[j][0]) &&
+        (point[1] >= scene->lastLo[j][1]) && (point[1] < scene->lastHi[j][1]) &&
+        (point[2] >= scene->lastLo[j][2]) && (point[2] < scene->lastHi[j][2]))
+    {
+        return scene->lastCell[j];
+    }
+    cellRange(scene, point, point, c, c);
+    if (j < SCENE_MAX_POINTS)
+    {
+        for (k = 0; k < 3; k++)
+        {
+            scene->lastLo[j][k] = (c[k] == 0) ? -INFINITY : scene->gridMin[k] + c[k] * scene->gridCell[k];
+            scene->lastHi[j][k] = (c[k] == SCENE_GRID_N - 1) ? INFINITY
+                                                              : scene->gridMin[k] + (c[k] + 1) * scene->gridCell[k];
+        }
+        scene->lastCell[j] = cellIndex(c[0], c[1], c[2]);
+    }
+    return cellIndex(c[0], c[1], c[2]);
+}
+
+// pushes point out of object i, 1 if it was inside
+static int addContact( const Scene *scene, int i, const float point[3], float force[3] )
+{
+    float normal[3];
+    float depth = -sceneObjectDistance(scene, i, point, normal);
+
+    if (depth > 0.0f)
+    {
+        float k = scene->stiffness[i] * depth;
+        force[0] += k * normal[0];
+        force[1] += k * normal[1];
+        force[2] += k * normal[2];
+        return 1;
+    }
+    return 0;
+}
+
+// inside the grid box the field, outside it the distance to the box (the
+// tool leaves a margin around the mesh, so that is no contact either way)
+static float sdfDistance( const Scene *scene, int i, const float point[3], float normal[3] )
+{
+    float lo[3] = { scene->px[i], scene->py[i], scene->pz[i] };
+    float hi[3] = { scene->ax[i], scene->ay[i], scene->az[i] };
+    float outside[3], d;
+    int k, out = 0;
+
+    for (k = 0; k < 3; k++)
+    {
+        outside[k] = (point[k] < lo[k]) ? point[k] - lo[k] : (point[k] > hi[k]) ? point[k] - hi[k] : 0.0f;
+        out |= (outside[k] != 0.0f);
+    }
+    if (out)
+    {
+        return roundDistance(outside[0], outside[1], outside[2], 0.0f, normal);
+    }
+    d = sdfGridSample(scene->sdf[i], point[0] - lo[0], point[1] - lo[1], point[2] - lo[2], normal);
+    roundDistance(normal[0], normal[1], normal[2], 0.0f, normal);
+    return d;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   sceneClear
+  * @brief  Removes every object.
+  * @param  scene: scene.
+  * @retval None.
+  */
+void sceneClear( Scene *scene )
+{
+    scene->count = 0;
+    scene->gridValid = 0;
+}
+
+/*******************************************************************************
+  * @name   sceneAddSphere
+  * @brief  Adds a solid sphere.
+  * @param  scene: scene.
+  * @param  x, y, z: center, mm.
+  * @param  radius: mm.
+  * @param  stiffness: scale on the limb gain, 1.0 = the limb's own.
+  * @retval index of the object, -1 if the scene is full.
+  */
+int sceneAddSphere( Scene *scene, float x, float y, float z, float radius, float stiffness )
+{
+    return sceneAdd(scene, SCENE_SPHERE, x, y, z, 0.0f, 0.0f, 0.0f, radius, stiffness);
+}
+
+/*******************************************************************************
+  * @name   sceneAddBox
+  * @brief  Adds a solid box aligned with the hand frame axes.
+  * @param  scene: scene.
+  * @param  x, y, z: center, mm.
+  * @param  halfX, halfY, halfZ: half of the size along each axis, mm.
+  * @param  stiffness: scale on the limb gain.
+  * @retval index of the object, -1 if the scene is full.
+  */
+int sceneAddBox( Scene *scene, float x, float y, float z, float halfX, float halfY, float halfZ,
+                 float stiffness )
+{
+    return sceneAdd(scene, SCENE_BOX, x, y, z, halfX, halfY, halfZ, 0.0f, stiffness);
+}
+
+/*******************************************************************************
+  * @name   sceneAddHalfSpace
+  * @brief  Adds everything behind a plane (a table, a wall).
+  * @param  scene: scene.
+  * @param  x, y, z: a point of the plane, mm.
+  * @param  normalX, normalY, normalZ: pointing out of the solid side, any
+  *         length but zero.
+  * @param  stiffness: scale on the limb gain.
+  * @retval index of the object, -1 if the scene is full or the normal is 0.
+  */
+int sceneAddHalfSpace( Scene *scene, float x, float y, float z, float normalX, float normalY, float normalZ,
+                       float stiffness )
+{
+    float length = sqrtf(normalX*normalX + normalY*normalY + normalZ*normalZ);
+
+    if (!(length > 0.0f)) return -1;
+    return sceneAdd(scene, SCENE_HALF_SPACE, x, y, z, normalX / length, normalY / length, normalZ / length,
+                    0.0f, stiffness);
+}
+
+/*******************************************************************************
+  * @name   sceneAddCapsule
+  * @brief  Adds a solid capsule: every point within radius of a segment.
+  * @param  scene: scene.
+  * @param  x0, y0, z0, x1, y1, z1: ends of the segment, mm.
+  * @param  radius: mm.
+  * @param  stiffness: scale on the limb gain.
+  * @retval index of the object, -1 if the scene is full.
+  */
+int sceneAddCapsule( Scene *scene, float x0, float y0, float z0, float x1, float y1, float z1,
+                     float radius, float stiffness )
+{
+    int i = sceneAdd(scene, SCENE_CAPSULE, x0, y0, z0, x1, y1, z1, radius, stiffness);
+
+    if (i >= 0) sceneSetAxis(scene, i);
+    return i;
+}
+
+/*******************************************************************************
+  * @name   sceneAddCylinder
+  * @brief  Adds a solid cylinder with flat caps.
+  * @param  scene: scene.
+  * @param  x0, y0, z0, x1, y1, z1: centers of the two caps, mm.
+  * @param  radius: mm.
+  * @param  stiffness: scale on the limb gain.
+  * @retval index of the object, -1 if the scene is full.
+  */
+int sceneAddCylinder( Scene *scene, float x0, float y0, float z0, float x1, float y1, float z1,
+                      float radius, float stiffness )
+{
+    int i = sceneAdd(scene, SCENE_CYLINDER, x0, y0, z0, x1, y1, z1, radius, stiffness);
+
+    if (i >= 0) sceneSetAxis(scene, i);
+    return i;
+}
+
+/*******************************************************************************
+  * @name   sceneAddSdf
+  * @brief  Adds a distance field object (hand_sdf.h, made by
+  *         tools/gen_sdf.c), not rotated.
+  * @param  scene: scene.
+  * @param  grid: the field, usually const in flash; kept by pointer.
+  * @param  x, y, z: where the first sample of the grid goes, mm.
+  * @param  stiffness: scale on the limb gain.
+  * @retval index of the object, -1 if the scene is full.
+  */
+int sceneAddSdf( Scene *scene, const SdfGrid *grid, float x, float y, float z, float stiffness )
+{
+    int i = sceneAdd(scene, SCENE_SDF, x, y, z, x + (grid->nx - 1) * grid->voxel,
+                     y + (grid->ny - 1) * grid->voxel, z + (grid->nz - 1) * grid->voxel, 0.0f, stiffness);
+
+    if (i >= 0) scene->sdf[i] = grid;
+    return i;
+}
+
+/*******************************************************************************
+  * @name   sceneSetDynamic
+  * @brief  Marks an object that will move: it leaves the grid cells and is
+  *         tested by every point. Drops the grid, call sceneBuildGrid again.
+  * @param  scene: scene.
+  * @param  object: index.
+  * @retval None.
+  */
+void sceneSetDynamic( Scene *scene, int object )
+{
+    if ((object < 0) || (object >= scene->count) || scene->dynamic[object]) return;
+    scene->dynamic[object] = 1;
+    scene->gridValid = 0;
+}
+
+/*******************************************************************************
+  * @name   sceneSetFriction
+  * @brief  Friction of an object's surface: a point resting on it sticks
+  *         until the tangential force passes staticFriction times the
+  *         normal force, then slides against kineticFriction times it.
+  * @param  scene: scene.
+  * @param  object: index.
+  * @param  staticFriction: 0 for a frictionless surface (the default).
+  * @param  kineticFriction: at most staticFriction.
+  * @retval None.
+  */
+void sceneSetFriction( Scene *scene, int object, float staticFriction, float kineticFriction )
+{
+    if ((object < 0) || (object >= scene->count)) return;
+    if (staticFriction < 0.0f) staticFriction = 0.0f;
+    if (kineticFriction < 0.0f) kineticFriction = 0.0f;
+    scene->staticFriction[object] = staticFriction;
+    scene->kineticFriction[object] = (kineticFriction < staticFriction) ? kineticFriction : staticFriction;
+}
+
+/*******************************************************************************
+  * @name   sceneMoveObject
+  * @brief  Moves an object (no rotation): its first point p goes to x, y, z
+  *         and the second one, for the types where it is a point, with it.
+  *         Cheap enough for every tick on dynamic objects; moving a static
+  *         one drops the grid.
+  * @param  scene: scene.
+  * @param  object: index.
+  * @param  x, y, z: new p, mm (the center, the plane point or the first
+  *         end, as it was added).
+  * @retval None.
+  */
+void sceneMoveObject( Scene *scene, int object, float x, float y, float z )
+{
+    int i = object;
+    float dx, dy, dz;
+
+    if ((i < 0) || (i >= scene->count)) return;
+    dx = x - scene->px[i];
+    dy = y - scene->py[i];
+    dz = z - scene->pz[i];
+    scene->px[i] = x;
+    scene->py[i] = y;
+    scene->pz[i] = z;
+    if ((scene->type[i] == SCENE_CAPSULE) || (scene->type[i] == SCENE_CYLINDER) || (scene->type[i] == SCENE_SDF))
+    {
+        scene->ax[i] += dx;
+        scene->ay[i] += dy;
+        scene->az[i] += dz;
+    }
+    if (!scene->dynamic[i]) scene->gridValid = 0;
+}
+
+/*******************************************************************************
+  * @name   sceneBuildGrid
+  * @brief  Broad phase: spreads the objects over SCENE_GRID_N^3 cells
+  *         covering their bounding boxes (every cell a box touches gets the
+  *         object, half spaces and dynamic objects go to a list tested
+  *         everywhere). Fixed arrays, two passes over the objects. Call
+  *         once the scene is loaded, and again after editing it.
+  * @param  scene: scene.
+  * @retval 0 if ok, -1 if the cells need more than SCENE_GRID_MAX_REFS
+  *         entries (the queries then test every object).
+  */
+int sceneBuildGrid( Scene *scene )
+{
+    float lo[3], hi[3], sceneLo[3] = { INFINITY, INFINITY, INFINITY }, sceneHi[3] = { -INFINITY, -INFINITY, -INFINITY };
+    int first[3], last[3], i, k, x, y, z, c;
+    uint32_t total;
+
+    scene->gridValid = 0;
+    scene->unboundedCount = 0;
+    for (i = 0; i < SCENE_MAX_POINTS; i++) scene->lastCell[i] = -1;
+
+    // grid over the bounded objects
+    for (i = 0; i < scene->count; i++)
+    {
+        if (!objectBounds(scene, i, lo, hi))
+        {
+            scene->unbounded[scene->unboundedCount++] = (uint16_t)i;
+            continue;
+        }
+        for (k = 0; k < 3; k++)
+        {
+            sceneLo[k] = fminf(sceneLo[k], lo[k]);
+            sceneHi[k] = fmaxf(sceneHi[k], hi[k]);
+        }
+    }
+    for (k = 0; k < 3; k++)
+    {
+        float size = sceneHi[k] - sceneLo[k];
+        if (!(size > 0.0f))     // nothing bounded, or flat
+        {
+            sceneLo[k] = (sceneLo[k] < INFINITY) ? sceneLo[k] : 0.0f;
+            size = 1.0f;
+        }
+        scene->gridMin[k] = sceneLo[k];
+        scene->gridCell[k] = size / SCENE_GRID_N;
+        scene->gridInvCell[k] = SCENE_GRID_N / size;
+    }
+
+    // count the entries of each cell in gridStart[c + 1]
+    for (c = 0; c <= SCENE_GRID_CELLS; c++) scene->gridStart[c] = 0;
+    total = 0;
+    for (i = 0; i < scene->count; i++)
+    {
+        if (!objectBounds(scene, i, lo, hi)) continue;
+        cellRange(scene, lo, hi, first, last);
+        for (z = first[2]; z <= last[2]; z++)
+            for (y = first[1]; y <= last[1]; y++)
+                for (x = first[0]; x <= last[0]; x++)
+                {
+                    scene->gridStart[cellIndex(x, y, z) + 1]++;
+                    total++;
+                }
+    }
+    if (total > SCENE_GRID_MAX_REFS) return -1;
+
+    // prefix sums, then fill: gridStart[c] walks up to the end of cell c ...
+    for (c = 0; c < SCENE_GRID_CELLS; c++) scene->gridStart[c + 1] += scene->gridStart[c];
+    for (i = 0; i < scene->count; i++)
+    {
+        if (!objectBounds(scene, i, lo, hi)) continue;
+        cellRange(scene, lo, hi, first, last);
+        for (z = first[2]; z <= last[2]; z++)
+            for (y = first[1]; y <= last[1]; y++)
+                for (x = first[0]; x <= last[0]; x++)
+                {
+                    scene->gridRefs[scene->gridStart[cellIndex(x, y, z)]++] = (uint16_t)i;
+                }
+    }
+    // ... which is the start of cell c + 1, shift back by one
+    for (c = SCENE_GRID_CELLS; c > 0; c--) scene->gridStart[c] = scene->gridStart[c - 1];
+    scene->gridStart[0] = 0;
+
+    scene->gridValid = 1;
+    return 0;
+}
+
+/*******************************************************************************
+  * @name   sceneObjectsNear
+  * @brief  Objects that may reach into a box: those of the grid cells it
+  *         covers, each once, and the half spaces; every object without a
+  *         grid.
+  * @param  scene: scene.
+  * @param  lo, hi: corners of the box, mm.
+  * @param  objects: indices out.
+  * @param  max: size of objects, SCENE_MAX_OBJECTS is always enough.
+  * @retval number of objects.
+  */
+int sceneObjectsNear( const Scene *scene, const float lo[3], const float hi[3], uint16_t objects[], int max )
+{
+    uint32_t seen[(SCENE_MAX_OBJECTS + 31) / 32] = { 0 };
+    int first[3], last[3], i, n = 0, x, y, z;
+
+    if (!scene->gridValid)
+    {
+        for (i = 0; (i < scene->count) && (n < max); i++) objects[n++] = (uint16_t)i;
+        return n;
+    }
+    for (i = 0; (i < scene->unboundedCount) && (n < max); i++) objects[n++] = scene->unbounded[i];
+    cellRange(scene, lo, hi, first, last);
+    for (z = first[2]; z <= last[2]; z++)
+        for (y = first[1]; y <= last[1]; y++)
+            for (x = first[0]; x <= last[0]; x++)
+            {
+                int c = cellIndex(x, y, z);
+                for (i = scene->gridStart[c]; (i < scene->gridStart[c + 1]) && (n < max); i++)
+                {
+                    uint16_t object = scene->gridRefs[i];
+                    if (seen[object >> 5] & (1u << (object & 31))) continue;
+                    seen[object >> 5] |= 1u << (object & 31);
+                    objects[n++] = object;
+                }
+            }
+    return n;
+}
+
+/*******************************************************************************
+  * @name   sceneObjectDistance
+  * @brief  Signed distance from a point to one object.
+  * @param  scene: scene.
+  * @param  object: index, 0 .. count - 1.
+  * @param  point: mm.
+  * @param  normal: unit, out of the object at the closest surface point.
+  * @retval mm, negative inside.
+  */
+float sceneObjectDistance( const Scene *scene, int object, const float point[3], float normal[3] )
+{
+    int i = object;
+    float qx = point[0] - scene->px[i];
+    float qy = point[1] - scene->py[i];
+    float qz = point[2] - scene->pz[i];
+
+    switch (scene->type[i])
+    {
+        case SCENE_SPHERE:
+            return roundDistance(qx, qy, qz, scene->radius[i], normal);
+
+        case SCENE_BOX:
+            return boxDistance(scene, i, point, normal);
+
+        case SCENE_HALF_SPACE:
+            normal[0] = scene->ax[i]; normal[1] = scene->ay[i]; normal[2] = scene->az[i];
+            return qx*scene->ax[i] + qy*scene->ay[i] + qz*scene->az[i];
+
+        case SCENE_CAPSULE:
+        {
+            float axisX = scene->ax[i] - scene->px[i];
+            float axisY = scene->ay[i] - scene->py[i];
+            float axisZ = scene->az[i] - scene->pz[i];
+            float t = (qx*axisX + qy*axisY + qz*axisZ) * scene->invLength2[i];
+            if (t < 0.0f) t = 0.0f;
+            if (t > 1.0f) t = 1.0f;
+            return roundDistance(qx - axisX*t, qy - axisY*t, qz - axisZ*t, scene->radius[i], normal);
+        }
+
+        case SCENE_CYLINDER:
+            return cylinderDistance(scene, i, point, normal);
+
+        case SCENE_SDF:
+            return sdfDistance(scene, i, point, normal);
+    }
+    normal[0] = normal[1] = normal[2] = 0.0f;
+    return INFINITY;
+}
+
+/*******************************************************************************
+  * @name   sceneQueryPoints
+  * @brief  Contact forces on a set of points from the whole scene.
+  *         Overlapping objects add up. With a grid (sceneBuildGrid) each
+  *         point tests the objects of its cell and the half spaces;
+  *         otherwise every object is tested in one pass over the objects
+  *         (each object loaded once for all the points).
+  * @param  scene: scene, its cell cache is updated.
+  * @param  count: number of points, the first SCENE_MAX_POINTS keep their
+  *         cell between calls (pass them in the same order every tick).
+  * @param  points: mm.
+  * @param  forces: sum of stiffness * depth (mm) * normal over the objects
+  *         the point is inside; multiply by the limb gain / 1000 for N.
+  * @param  contacts: number of objects each point is inside, may be NULL.
+  * @retval None.
+  */
+void sceneQueryPoints( Scene *scene, int count, const float points[][3], float forces[][3],
+                       int contacts[] )
+{
+    int i, j, n;
+
+    for (j = 0; j < count; j++)
+    {
+        forces[j][0] = forces[j][1] = forces[j][2] = 0.0f;
+        n = 0;
+        if (scene->gridValid)
+        {
+            int cell = pointCell(scene, j, points[j]);
+            for (i = scene->gridStart[cell]; i < scene->gridStart[cell + 1]; i++)
+            {
+                n += addContact(scene, scene->gridRefs[i], points[j], forces[j]);
+            }
+            for (i = 0; i < scene->unboundedCount; i++)
+            {
+                n += addContact(scene, scene->unbounded[i], points[j], forces[j]);
+            }
+        }
+        if (contacts) contacts[j] = n;
+    }
+    if (scene->gridValid) return;
+
+    for (i = 0; i < scene->count; i++)
+    {
+        for (j = 0; j < count; j++)
+        {
+            n = addContact(scene, i, points[j], forces[j]);
+            if (contacts) contacts[j] += n;
+        }
+    }
+}
+//EOF
@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file    hand_scene.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Scene of solid primitives felt by the thumb and the fingers.
+  *          A fixed size pool, stored as a structure of arrays of floats
+  *          (the F446 FPU is single precision), filled at startup or at
+  *          runtime with the sceneAdd functions. sceneQueryPoints runs every
+  *          contact point against every object in one pass, so a tick costs
+  *          objects x points distance evaluations, whatever the poses.
+  *          With more than a few objects, sceneBuildGrid (once the scene is
+  *          loaded) sorts them into a uniform grid and each point only tests
+  *          the objects of its cell; editing the scene drops the grid until
+  *          it is built again. Objects made dynamic (sceneSetDynamic) stay
+  *          out of the cells and are tested by every point, like the half
+  *          spaces, so sceneMoveObject can move them every tick without a
+  *          rebuild (hand_motion.h moves them).
+  *          Positions in mm, hand frame (the thumb frame). Each object has a
+  *          stiffness that scales the gain of the limb touching it, 1.0 is
+  *          the limb's own gain (K_DELTA_THUMB, K_FINGERS), and static and
+  *          kinetic friction coefficients (sceneSetFriction, none by default)
+  *          that the proxy contact renders (hand_proxy.h).
+  *          Only needs math.h so the host tools can use it.
+  ******************************************************************************
+  */
+#ifndef __HAND_SCENE_H_
+#define __HAND_SCENE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "hand_sdf.h"
+
+// Sizes, the host tools build with bigger ones
+#ifndef SCENE_MAX_OBJECTS
+#define SCENE_MAX_OBJECTS       64
+#endif
+#define SCENE_MAX_POINTS        4   // contact points with a cached cell (thumb and fingers)
+#ifndef SCENE_GRID_N
+#define SCENE_GRID_N            8   // cells per axis
+#endif
+#define SCENE_GRID_CELLS        (SCENE_GRID_N * SCENE_GRID_N * SCENE_GRID_N)
+#ifndef SCENE_GRID_MAX_REFS
+#define SCENE_GRID_MAX_REFS     (16 * SCENE_MAX_OBJECTS)    // object entries over all cells
+#endif
+#if (SCENE_GRID_MAX_REFS > 65535) || (SCENE_MAX_OBJECTS > 65535)
+#error "the grid stores uint16_t indices"
+#endif
+
+// Object types, and what ax/ay/az and radius hold for each
+#define SCENE_SPHERE            0   // p center, radius
+#define SCENE_BOX               1   // p center, a half sizes (axis aligned)
+#define SCENE_HALF_SPACE        2   // p a point of the plane, a unit outward normal
+#define SCENE_CAPSULE           3   // p and a the ends of the axis, radius
+#define SCENE_CYLINDER          4   // p and a the centers of the caps, radius
+#define SCENE_SDF               5   // p and a the corners of the grid in sdf (hand_sdf.h)
+
+typedef struct {
+    int count;
+    uint8_t type[SCENE_MAX_OBJECTS];
+    float px[SCENE_MAX_OBJECTS], py[SCENE_MAX_OBJECTS], pz[SCENE_MAX_OBJECTS];
+    float ax[SCENE_MAX_OBJECTS], ay[SCENE_MAX_OBJECTS], az[SCENE_MAX_OBJECTS];
+    float radius[SCENE_MAX_OBJECTS];
+    float stiffness[SCENE_MAX_OBJECTS];
+    float staticFriction[SCENE_MAX_OBJECTS], kineticFriction[SCENE_MAX_OBJECTS];
+    float invLength2[SCENE_MAX_OBJECTS];    // capsule, cylinder: 1 / |a - p|^2
+    const SdfGrid *sdf[SCENE_MAX_OBJECTS];  // SCENE_SDF only
+    uint8_t dynamic[SCENE_MAX_OBJECTS];     // moves, kept out of the grid cells
+    // broad phase (sceneBuildGrid): objects of cell c are
+    // gridRefs[gridStart[c] .. gridStart[c + 1] - 1], half spaces and dynamic
+    // objects are in every cell
+    int gridValid;
+    float gridMin[3], gridCell[3], gridInvCell[3];
+    uint16_t gridStart[SCENE_GRID_CELLS + 1];
+    uint16_t gridRefs[SCENE_GRID_MAX_REFS];
+    int unboundedCount;
+    uint16_t unbounded[SCENE_MAX_OBJECTS];
+    // last cell of each contact point and its bounds, a point that stays in it skips the lookup
+    int lastCell[SCENE_MAX_POINTS];
+    float lastLo[SCENE_MAX_POINTS][3], lastHi[SCENE_MAX_POINTS][3];
+} Scene;
+
+extern Scene handScene;
+
+/******* Function prototypes ****/
+void sceneClear( Scene *scene );
+int sceneAddSphere( Scene *scene, float x, float y, float z, float radius, float stiffness );
+int sceneAddBox( Scene *scene, float x, float y, float z, float halfX, float halfY, float halfZ,
+                 float stiffness );
+int sceneAddHalfSpace( Scene *scene, float x, float y, float z, float normalX, float normalY, float normalZ,
+                       float stiffness );
+int sceneAddCapsule( Scene *scene, float x0, float y0, float z0, float x1, float y1, float z1,
+                     float radius, float stiffness );
+int sceneAddCylinder( Scene *scene, float x0, float y0, float z0, float x1, float y1, float z1,
+                      float radius, float stiffness );
+int sceneAddSdf( Scene *scene, const SdfGrid *grid, float x, float y, float z, float stiffness );
+void sceneSetDynamic( Scene *scene, int object );
+void sceneSetFriction( Scene *scene, int object, float staticFriction, float kineticFriction );
+void sceneMoveObject( Scene *scene, int object, float x, float y, float z );
+int sceneBuildGrid( Scene *scene );
+int sceneObjectsNear( const Scene *scene, const float lo[3], const float hi[3], uint16_t objects[], int max );
+float sceneObjectDistance( const Scene *scene, int object, const float point[3], float normal[3] );
+void sceneQueryPoints( Scene *scene, int count, const float points[][3], float forces[][3],
+                       int contacts[] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_SCENE_H_
+//EOF
@@ -0,0 +1,82 @@
+/**
+  ******************************************************************************
+  * @file    hand_sdf.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Trilinear distance and gradient lookups in an SdfGrid
+  *          (hand_sdf.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_sdf.h"
+#include <math.h>
+
+/* Static Functions ----------------------------------------------------------*/
+
+static float sample( const SdfGrid *grid, int index )
+{
+    if (grid->bits == 8) return ((const int8_t *)grid->data)[index];
+    return ((const int16_t *)grid->data)[index];
+}
+
+// cell holding f (in samples) along an axis of n samples, and where in it
+static int cellOf( float f, int n, float *t )
+{
+    int i;
+
+    if (!(f > 0.0f)) { *t = 0.0f; return 0; }   // NaN too
+    if (f >= n - 1) { *t = 1.0f; return n - 2; }
+    i = (int)f;
+    *t = f - i;
+    return i;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   sdfGridSample
+  * @brief  Distance and gradient at a point of the grid: trilinear
+  *         interpolation of the 8 samples around it, and the exact
+  *         derivative of that interpolation. Points outside the grid are
+  *         clamped to its border.
+  * @param  grid: the field.
+  * @param  x, y, z: mm from the first sample.
+  * @param  gradient: d distance / d position, about unit length near the
+  *         surface, may be NULL.
+  * @retval mm, negative inside.
+  */
+float sdfGridSample( const SdfGrid *grid, float x, float y, float z, float gradient[3] )
+{
+    float inv = 1.0f / grid->voxel;
+    float tx, ty, tz;
+    int ix = cellOf(x * inv, grid->nx, &tx);
+    int iy = cellOf(y * inv, grid->ny, &ty);
+    int iz = cellOf(z * inv, grid->nz, &tz);
+    int sx = 1, sy = grid->nx, sz = grid->nx * grid->ny;
+    int i = iz * sz + iy * sy + ix;
+
+    float c000 = sample(grid, i),           c100 = sample(grid, i + sx);
+    float c010 = sample(grid, i + sy),      c110 = sample(grid, i + sy + sx);
+    float c001 = sample(grid, i + sz),      c101 = sample(grid, i + sz + sx);
+    float c011 = sample(grid, i + sz + sy), c111 = sample(grid, i + sz + sy + sx);
+
+    // along x first, then y, then z
+    float c00 = c000 + (c100 - c000) * tx, c10 = c010 + (c110 - c010) * tx;
+    float c01 = c001 + (c101 - c001) * tx, c11 = c011 + (c111 - c011) * tx;
+    float c0 = c00 + (c10 - c00) * ty, c1 = c01 + (c11 - c01) * ty;
+
+    if (gradient)
+    {
+        float k = grid->scale * inv;
+        float dx00 = c100 - c000, dx10 = c110 - c010, dx01 = c101 - c001, dx11 = c111 - c011;
+        float dx0 = dx00 + (dx10 - dx00) * ty, dx1 = dx01 + (dx11 - dx01) * ty;
+        float dy0 = c10 - c00, dy1 = c11 - c01;
+        gradient[0] = k * (dx0 + (dx1 - dx0) * tz);
+        gradient[1] = k * (dy0 + (dy1 - dy0) * tz);
+        gradient[2] = k * (c1 - c0);
+    }
+    return grid->scale * (c0 + (c1 - c0) * tz);
+}
+//EOF
@@ -0,0 +1,42 @@
+/**
+  ******************************************************************************
+  * @file    hand_sdf.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Signed distance field objects for shapes the primitives of
+  *          hand_scene.h cannot describe (cups, tools). A grid of distances
+  *          sampled every voxel mm, stored in flash as int8 or int16 counts
+  *          times a scale, made from a mesh by tools/gen_sdf.c. The distance
+  *          and its gradient at any point come from the 8 samples around it
+  *          by trilinear interpolation: constant time per point, whatever
+  *          the mesh. Samples are indexed (z * ny + y) * nx + x, negative
+  *          inside the object. Only needs math.h and stdint.h.
+  ******************************************************************************
+  */
+#ifndef __HAND_SDF_H_
+#define __HAND_SDF_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+typedef struct {
+    int nx, ny, nz;         // samples per axis, at least 2
+    float voxel;            // mm between samples
+    float scale;            // mm per count
+    int bits;               // 8 (data is int8_t) or 16 (int16_t)
+    const void *data;       // nx * ny * nz samples
+} SdfGrid;
+
+/******* Function prototypes ****/
+float sdfGridSample( const SdfGrid *grid, float x, float y, float z, float gradient[3] );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_SDF_H_
+//EOF
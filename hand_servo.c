@@ -0,0 +1,254 @@
+/**
+  ******************************************************************************
+  * @file    hand_servo.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Fast servo interrupt and its handoff with the main loop (see
+  *          hand_servo.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_servo.h"
+#include "hand_virtual_environment.h"
+#include "hand_proxy.h"
+#include "hand_host_models.h"
+#include "hand_motion.h"
+#include "delta_thumb.h"
+#include "haplink_time.h"
+
+#ifdef HAND_SERVO_RATE_HZ
+
+/* Global variables ----------------------------------------------------------*/
+// local models (as blends), the interrupt reads servoModels[servoModelFront]
+static HandModelBlend servoModels[2][HAND_CONTACT_POINTS];
+static volatile uint8_t servoModelFront = 0;
+// positions and telemetry of the last tick, servoSequence is odd while they are written
+static float servoPoints[HAND_CONTACT_POINTS][3];
+static HandTelemetry servoTelemetry;
+static volatile uint32_t servoSequence = 0;
+static volatile uint32_t servoTicks = 0;
+static double servoTickMaxUs = 0.0;
+
+/* Static Functions ----------------------------------------------------------*/
+
+// one tick of the interrupt: kinematics, local models, torques
+static void handServoTick( void )
+{
+    float points[HAND_CONTACT_POINTS][3];
+    float forces[HAND_CONTACT_POINTS][3];
+    const HandModelBlend *models;
+    double start_us = getTime_us();
+    int j, k;
+
+    deltaThumbHandler();    // Motors 1, 2, 3
+    calculateHandLimbs();   // Fingers (hand_limbs.h)
+    getHandContactPoints(points);
+
+    models = servoModels[servoModelFront];
+    for (j = 0; j < HAND_CONTACT_POINTS; j++) localModelBlendForce(&models[j], points[j], start_us, forces[j]);
+#ifdef HAND_GRASP_OBJECT
+    addHandGraspForces(points, forces, start_us);   // the free object at the servo rate
+#endif
+    outputHandForces(points, forces);
+
+    servoTicks++;
+    double took_us = getTime_us() - start_us;
+    if (took_us > servoTickMaxUs) servoTickMaxUs = took_us;
+
+    // the loop only runs between ticks, publishing at the end is as early as at the start
+    servoSequence++;
+    __DMB();
+    for (j = 0; j < HAND_CONTACT_POINTS; j++)
+    {
+        for (k = 0; k < 3; k++) servoPoints[j][k] = points[j][k];
+    }
+    fillHandTelemetry(&servoTelemetry);
+    servoTelemetry.servoTickMaxUs = servoTickMaxUs;
+    __DMB();
+    servoSequence++;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   initHandServo
+  * @brief  Starts Timer 5 at HAND_SERVO_RATE_HZ, its interrupt renders the
+  *         hand from then on. Call after initHandScene; until the first
+  *         models are published the servo renders free space.
+  * @param  None.
+  * @retval None.
+  */
+void initHandServo( void )
+{
+    TIM_TimeBaseInitTypeDef_mort  TIM_TimeBaseStructure5;
+    NVIC_InitTypeDef_mort NVIC_InitStructure;
+
+    HandLocalModel none;
+    none.type = LOCAL_NONE;
+    for (int j = 0; j < HAND_CONTACT_POINTS; j++)
+    {
+        localModelHold(&servoModels[0][j], &none);
+        localModelHold(&servoModels[1][j], &none);
+    }
+
+    /* TIM5 clock enable */
+    RCC_APB1PeriphClockCmd(RCC_APB1Periph_TIM5, ENABLE);
+
+    /* Enable the TIM5 global Interrupt, below the encoders and the time keeper */
+    NVIC_InitStructure.NVIC_IRQChannel = TIM5_IRQn;
+    NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = 1;
+    NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+    NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+    NVIC_Init_mort(&NVIC_InitStructure);
+
+    /* Time base configuration: 1 MHz count (APB1 timers run at SystemCoreClock / 2) */
+    TIM_TimeBaseStructure5.TIM_Period = 1000000 / HAND_SERVO_RATE_HZ - 1;
+    TIM_TimeBaseStructure5.TIM_Prescaler = (uint16_t)(SystemCoreClock / 2 / 1000000 - 1);
+    TIM_TimeBaseStructure5.TIM_ClockDivision = 0;
+    TIM_TimeBaseStructure5.TIM_CounterMode = TIM_CounterMode_Up_MORT;
+    TIM_TimeBaseStructure5.TIM_RepetitionCounter = 0;
+    TIM_TimeBaseInit_mort(TIM5_MORT, &TIM_TimeBaseStructure5);
+
+    /* TIM Interrupts enable */
+    TIM_ITConfig_mort(TIM5_MORT, TIM_IT_Update, ENABLE);
+
+    /* TIM5 enable counter */
+    TIM_Cmd_mort(TIM5_MORT, ENABLE);
+}
+
+/*******************************************************************************
+  * @name   getHandServoPoints
+  * @brief  Contact points of the last servo tick, safe to call from the
+  *         main loop while the interrupt runs.
+  * @param  points: the thumb, then every limb, hand frame in mm.
+  * @retval 0 before the first tick, 1 otherwise.
+  */
+int getHandServoPoints( float points[HAND_CONTACT_POINTS][3] )
+{
+    uint32_t sequence;
+    int j, k;
+
+    do
+    {
+        sequence = servoSequence;
+        __DMB();
+        for (j = 0; j < HAND_CONTACT_POINTS; j++)
+        {
+            for (k = 0; k < 3; k++) points[j][k] = servoPoints[j][k];
+        }
+        __DMB();
+    } while ((sequence & 1) || (sequence != servoSequence));
+    return (sequence != 0);
+}
+
+/*******************************************************************************
+  * @name   getHandServoTelemetry
+  * @brief  Hand state of the last servo tick for the telemetry streams (see
+  *         getHandTelemetry), safe to call from the main loop while the
+  *         interrupt runs.
+  * @param  telemetry: out, the sphere is not filled unless it is the free object.
+  * @retval 0 before the first tick, 1 otherwise.
+  */
+int getHandServoTelemetry( HandTelemetry *telemetry )
+{
+    uint32_t sequence;
+
+    do
+    {
+        sequence = servoSequence;
+        __DMB();
+        *telemetry = servoTelemetry;
+        __DMB();
+    } while ((sequence & 1) || (sequence != servoSequence));
+    return (sequence != 0);
+}
+
+/*******************************************************************************
+  * @name   handServoPublishBlends
+  * @brief  Hands new blends of local models to the servo, it takes them on
+  *         its next tick and evaluates them every tick. Main loop only (one
+  *         writer).
+  * @param  blends: one per contact point, times on the getTime_us clock.
+  * @retval None.
+  */
+void handServoPublishBlends( const HandModelBlend blends[HAND_CONTACT_POINTS] )
+{
+    uint8_t back = 1 - servoModelFront;
+
+    for (int j = 0; j < HAND_CONTACT_POINTS; j++) servoModels[back][j] = blends[j];
+    __DMB();
+    servoModelFront = back;
+}
+
+/*******************************************************************************
+  * @name   handServoPublishModels
+  * @brief  Hands new local models to the servo, rendered as they are.
+  * @param  models: one per contact point.
+  * @retval None.
+  */
+void handServoPublishModels( const HandLocalModel models[HAND_CONTACT_POINTS] )
+{
+    HandModelBlend blends[HAND_CONTACT_POINTS];
+
+    for (int j = 0; j < HAND_CONTACT_POINTS; j++) localModelHold(&blends[j], &models[j]);
+    handServoPublishBlends(blends);
+}
+
+/*******************************************************************************
+  * @name   updateHandLocalModels
+  * @brief  Slow side, call every main loop: the scene (through the proxies
+  *         with HAND_PROXY_RENDERING, its moving objects where they are
+  *         now) at the last servo positions, reduced to one local model per
+  *         contact point and published. With
+  *         HAND_HOST_PHYSICS the models come from the host instead
+  *         (hand_host_models.h) and are only passed on.
+  * @param  None.
+  * @retval None.
+  */
+void updateHandLocalModels( void )
+{
+#ifdef HAND_HOST_PHYSICS
+    HandModelBlend blends[HAND_CONTACT_POINTS];
+    hostModelsBlends(&handHostModels, getTime_us(), blends);
+    handServoPublishBlends(blends);
+#else
+    float points[HAND_CONTACT_POINTS][3];
+    HandLocalModel models[HAND_CONTACT_POINTS];
+
+    if (!getHandServoPoints(points)) return;
+    motionUpdate(&handMotion, &handScene, getTime_us());
+    for (int j = 0; j < HAND_CONTACT_POINTS; j++)
+    {
+#ifdef HAND_PROXY_RENDERING
+        // around the proxy, so the model stays on the near side of thin objects
+        static HandProxy proxies[HAND_CONTACT_POINTS];
+        float spring[3];
+        handProxyUpdate(&proxies[j], &handScene, points[j], spring);
+        localModelBuild(&models[j], &handScene, proxies[j].p);
+#else
+        localModelBuild(&models[j], &handScene, points[j]);
+#endif
+    }
+    handServoPublishModels(models);
+#endif
+}
+
+uint32_t getHandServoTicks( void )
+{
+    return servoTicks;
+}
+
+/* Interrupt callback --------------------------------------------------------*/
+void TIM5_IRQHandler(void)
+{
+    if (TIM_GetITStatus_mort(TIM5_MORT, TIM_IT_Update) != RESET)
+    {
+        TIM_ClearITPendingBit_mort(TIM5_MORT, TIM_IT_Update);
+        handServoTick();
+    }
+}
+
+#endif  //HAND_SERVO_RATE_HZ
+//EOF
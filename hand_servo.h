@@ -0,0 +1,55 @@
+/**
+  ******************************************************************************
+  * @file    hand_servo.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Two rate rendering (HAND_SERVO_RATE_HZ in main.h). A TIM5
+  *          interrupt at HAND_SERVO_RATE_HZ owns the actuation path: it
+  *          reads the encoders, runs the kinematics, renders the local
+  *          contact models (hand_local_model.h) and outputs the torques
+  *          (outputHandForces). The main loop, as fast as it goes, reads the
+  *          positions the interrupt left, runs the scene (and the proxies)
+  *          and publishes new local models. Nothing waits on anything:
+  *           - models go through a double buffer, the loop writes the one
+  *             the interrupt is not reading and flips the index; the
+  *             interrupt cannot be preempted by the loop, so it always
+  *             finishes with the buffer it took;
+  *           - positions, and the hand state for the telemetry streams
+  *             (HandTelemetry), go through a sequence count, odd while the
+  *             interrupt writes them, the loop copies again if it changed.
+  *          The models are published as blends (HandModelBlend) that the
+  *          interrupt evaluates at its own rate; handServoPublishBlends is
+  *          also the entry for models computed elsewhere (the host,
+  *          hand_host_models.h).
+  ******************************************************************************
+  */
+#ifndef __HAND_SERVO_H_
+#define __HAND_SERVO_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include "main.h"
+#include "hand_local_model.h"
+#include "hand_limbs.h"
+#include "hand_virtual_environment.h"
+
+#define HAND_CONTACT_POINTS     (1 + HAND_LIMB_COUNT)   // the thumb, then every limb
+
+/******* Function prototypes ****/
+void initHandServo( void );
+void updateHandLocalModels( void );
+void handServoPublishModels( const HandLocalModel models[HAND_CONTACT_POINTS] );
+void handServoPublishBlends( const HandModelBlend blends[HAND_CONTACT_POINTS] );
+int getHandServoPoints( float points[HAND_CONTACT_POINTS][3] );
+int getHandServoTelemetry( HandTelemetry *telemetry );
+uint32_t getHandServoTicks( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAND_SERVO_H_
+//EOF
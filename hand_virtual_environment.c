@@ -15,151 +15,300 @@
 #include "delta_thumb.h"
 #include "haplink_motors.h"
 #include "haplink_position.h"
+#include "hand_limbs.h"
+#include "haplink_filters.h"
+#include "haplink_time.h"
+#include "hand_scene.h"
+#include "hand_proxy.h"
+#include "hand_passivity.h"
+#include "hand_host_models.h"
+#include "hand_motion.h"
+#include "hand_grasp.h"
+#include "haplink_telemetry_streams.h"
+#include "hand_servo.h"
 
 /* Global Variables ----------------------------------------------------------*/
 //variables needed declared in other files:
 extern double J00, J01, J10, J11; //jacobian variables
-extern double J00_f1, J01_f1, J10_f1, J11_f1; //jacobian variables
-extern double J00_f2, J01_f2, J10_f2, J11_f2; //jacobian variables
 extern double rx, ry, dx, dy; // 2-DOF position variables
 extern double xH, dxH; //1-DOF position variables
 double TorqueX, TorqueY, ForceX, ForceY, ForceH;
-double TorqueMotor4, TorqueMotor5, TorqueMotor6, TorqueMotor7;
-double xf1_global, yf1_global, xf2_global, yf2_global;
+double TorqueMotor1, TorqueMotor2, TorqueMotor3;
+
+// Passivity ports: the thumb, then every limb
+static PassivityPort handPassivity[1 + HAND_LIMB_COUNT];
+#ifdef HAND_PASSIVITY_MAX_DAMPING
+    #define PASSIVITY_DAMPING_LIMIT ((float)HAND_PASSIVITY_MAX_DAMPING)
+#else
+    #define PASSIVITY_DAMPING_LIMIT 0.0f    // observer only
+#endif
 
 
 /*******************************************************************************
-  * @name   renderOutsideSphere
-  * @brief  Render sphere at a specified location
+  * @name   initHandScene
+  * @brief  Default scene: the sphere of SPHERE1_X/Y/Z/RADIUS, swinging with
+  *         HAND_SPHERE_SWING_MM, or free on its table with HAND_GRASP_OBJECT
+  *         (handGrasp, then handScene starts empty). Objects can be added or
+  *         changed at runtime through handScene (hand_scene.h), call
+  *         sceneBuildGrid again afterwards, and moved through handMotion
+  *         (hand_motion.h).
   * @param  None.
   * @retval None.
   */
-void renderOutsideSphere( void ) {
-    /********************* THUMB *************************/
-
-    // Check if thumb is inside sphere
-    double dist = sphereDistance(deltaThumbX, deltaThumbY, deltaThumbZ) / 1000.0;
-    double torque1, torque2, torque3, F_coeff;
-    double Fx=0, Fy=0, Fz=0;
-    static double Fx_prev=0, Fy_prev=0, Fz_prev=0;
-    static double alpha = 0.6; // how much of new value to include
+void initHandScene( void ) {
+    sceneClear(&handScene);
+#ifdef HAND_GRASP_OBJECT
+    graspInit(&handGrasp, SPHERE1_X, SPHERE1_Y, SPHERE1_Z, SPHERE1_RADIUS, HAND_GRASP_OBJECT);
+    graspSetGravity(&handGrasp, GRASP_GRAVITY_X, GRASP_GRAVITY_Y, GRASP_GRAVITY_Z);
+    graspSetContact(&handGrasp, handGrasp.stiffness, handGrasp.tangentStiffness, handGrasp.damping,
+                    SPHERE1_STATIC_FRICTION, SPHERE1_KINETIC_FRICTION);
+    // the table touches the sphere straight below its center
+    double down = SPHERE1_RADIUS / sqrt(GRASP_GRAVITY_X * GRASP_GRAVITY_X + GRASP_GRAVITY_Y * GRASP_GRAVITY_Y +
+                                        GRASP_GRAVITY_Z * GRASP_GRAVITY_Z);
+    graspSetTable(&handGrasp, SPHERE1_X + down * GRASP_GRAVITY_X, SPHERE1_Y + down * GRASP_GRAVITY_Y,
+                  SPHERE1_Z + down * GRASP_GRAVITY_Z, -GRASP_GRAVITY_X, -GRASP_GRAVITY_Y, -GRASP_GRAVITY_Z,
+                  GRASP_TABLE_STIFFNESS);
+#else
+    sceneSetFriction(&handScene, sceneAddSphere(&handScene, SPHERE1_X, SPHERE1_Y, SPHERE1_Z, SPHERE1_RADIUS, 1.0f),
+                     SPHERE1_STATIC_FRICTION, SPHERE1_KINETIC_FRICTION);
+#endif
+    sceneBuildGrid(&handScene);
+    motionInit(&handMotion);
+#if defined(HAND_SPHERE_SWING_MM) && !defined(HAND_GRASP_OBJECT)
+    const float swing[4][3] = {
+        { SPHERE1_X, SPHERE1_Y, SPHERE1_Z },
+        { SPHERE1_X + HAND_SPHERE_SWING_MM, SPHERE1_Y, SPHERE1_Z },
+        { SPHERE1_X, SPHERE1_Y, SPHERE1_Z },
+        { SPHERE1_X - HAND_SPHERE_SWING_MM, SPHERE1_Y, SPHERE1_Z } };
+    motionSetWaypoints(&handMotion, motionAttach(&handMotion, &handScene, 0), swing, 4,
+                       HAND_SPHERE_SWING_S * 1e6 / 4, 1, getTime_us());
+#endif
+    passivityReset(&handPassivity[0], 3);
+    for (int i = 0; i < HAND_LIMB_COUNT; i++) passivityReset(&handPassivity[1 + i], 2);
+    hostModelsInit(&handHostModels, 1 + HAND_LIMB_COUNT);
+}
 
+/*******************************************************************************
+  * @name   getHandContactPoints
+  * @brief  Contact points of the hand from the last kinematics update
+  *         (deltaThumbHandler, calculateHandLimbs).
+  * @param  points: the thumb, then every limb, hand frame in mm.
+  * @retval None.
+  */
+void getHandContactPoints( float points[][3] ) {
+    points[0][0] = (float)deltaThumbX;
+    points[0][1] = (float)deltaThumbY;
+    points[0][2] = (float)deltaThumbZ;
+    for (int i = 0; i < HAND_LIMB_COUNT; i++) {
+        points[1 + i][0] = (float)handLimbState.x[i];
+        points[1 + i][1] = (float)handLimbState.y[i];
+        points[1 + i][2] = (float)handLimbs[i].normalZ;
+    }
+}
 
-    if (dist < (SPHERE1_RADIUS / 1000.0)) {
-        // Calculate the forces to apply in order to resist the user
-        F_coeff = K_DELTA_THUMB * ((SPHERE1_RADIUS / 1000.0) - dist) / dist;
+/*******************************************************************************
+  * @name   renderHandScene
+  * @brief  Render every object of handScene on the thumb and the fingers
+  * @param  None.
+  * @retval None.
+  */
+void renderHandScene( void ) {
+    // Contact points: the thumb, then every limb, hand frame in mm
+    float points[1 + HAND_LIMB_COUNT][3];
+    float sceneForces[1 + HAND_LIMB_COUNT][3];
+    getHandContactPoints(points);
+#ifndef HAND_HOST_PHYSICS
+    // The moving objects (hand_motion.h) where they are this tick
+    motionUpdate(&handMotion, &handScene, getTime_us());
+#endif
+#if defined(HAND_HOST_PHYSICS)
+    // The host runs the scene, its local models (hand_host_models.h)
+    hostModelsForces(&handHostModels, points, getTime_us(), sceneForces);
+#elif defined(HAND_PROXY_RENDERING)
+    // A proxy per point, held on the surfaces while the point is inside
+    static HandProxy proxies[1 + HAND_LIMB_COUNT];
+    for (int j = 0; j < 1 + HAND_LIMB_COUNT; j++) {
+        handProxyUpdate(&proxies[j], &handScene, points[j], sceneForces[j]);
+    }
+#else
+    // One pass over the scene for all of them
+    sceneQueryPoints(&handScene, 1 + HAND_LIMB_COUNT, points, sceneForces, 0);
+#endif
+#ifdef HAND_GRASP_OBJECT
+    addHandGraspForces(points, sceneForces, getTime_us());
+#endif
+    outputHandForces(points, sceneForces);
+}
 
-        Fx = F_coeff * (deltaThumbX - SPHERE1_X) / 1000.0;
-        Fy = F_coeff * (deltaThumbY - SPHERE1_Y) / 1000.0;
-        Fz = F_coeff * (deltaThumbZ - SPHERE1_Z) / 1000.0;
+/*******************************************************************************
+  * @name   receiveHostModels
+  * @brief  Host contact frame (HOST_MODELS_FRAME_TYPE) from decodeMessage.
+  *         Ignored unless HAND_HOST_PHYSICS is on.
+  * @param  frame: whole frame starting at the sync byte.
+  * @retval 1 if the models were taken.
+  */
+int receiveHostModels( const uint8_t * frame ) {
+#ifdef HAND_HOST_PHYSICS
+    return hostModelsReceive(&handHostModels, frame, getTime_us());
+#else
+    (void)frame;
+    return 0;
+#endif
+}
 
-        // // Apply smoothing
-        // Fx = Fx * alpha + Fx_prev * (1-alpha);
-        // Fy = Fy * alpha + Fy_prev * (1-alpha);
-        // Fz = Fz * alpha + Fz_prev * (1-alpha);
+/*******************************************************************************
+  * @name   receiveObjectKeyframes
+  * @brief  Object keyframe frame (MOTION_FRAME_TYPE) from decodeMessage, the
+  *         objects it names follow the host from then on.
+  * @param  frame: whole frame starting at the sync byte.
+  * @retval 1 if the frame was good.
+  */
+int receiveObjectKeyframes( const uint8_t * frame ) {
+    return motionReceive(&handMotion, &handScene, frame, getTime_us());
+}
 
-        // // Set previous values
-        // Fx_prev = Fx;
-        // Fy_prev = Fy;
-        // Fz_prev = Fz;
+/*******************************************************************************
+  * @name   addHandGraspForces
+  * @brief  Steps the free object (HAND_GRASP_OBJECT, hand_grasp.h) to now
+  *         under the contact points and adds its reaction to their forces.
+  *         Called by renderHandScene, or by the fast servo, every tick.
+  * @param  points: from getHandContactPoints.
+  * @param  sceneForces: per point, in the units of sceneQueryPoints.
+  * @param  now_us: getTime_us of the tick.
+  * @retval None.
+  */
+void addHandGraspForces( float points[][3], float sceneForces[][3], double now_us ) {
+#ifdef HAND_GRASP_OBJECT
+    static double last_us = 0.0;
+    float gains[1 + HAND_LIMB_COUNT], forces[1 + HAND_LIMB_COUNT][3];
+
+    // N per unit of scene force, as in outputHandForces
+    gains[0] = (float)(K_DELTA_THUMB / 1000.0);
+    for (int i = 0; i < HAND_LIMB_COUNT; i++) gains[1 + i] = (float)(K_FINGERS / 1000.0);
+    graspStep(&handGrasp, 1 + HAND_LIMB_COUNT, (const float (*)[3])points, gains,
+              (last_us > 0.0) ? (float)((now_us - last_us) * 1e-6) : 0.0f, forces);
+    last_us = now_us;
+    for (int j = 0; j < 1 + HAND_LIMB_COUNT; j++) {
+        for (int k = 0; k < 3; k++) sceneForces[j][k] += forces[j][k];
+    }
+#else
+    (void)points;
+    (void)sceneForces;
+    (void)now_us;
+#endif
+}
 
-        // printf("Fx=%f, Fy=%f, Fz=%f\n", Fx, Fy, Fz);
+/*******************************************************************************
+  * @name   outputHandForces
+  * @brief  Turns the contact forces into motor torques and outputs them:
+  *         limb gains, thumb singularity scaling and filter, passivity
+  *         controller, Jacobians (only under a force) and the goTo servo.
+  *         Called by renderHandScene, or by the fast servo (hand_servo.h)
+  *         with the forces of the local models, never by both.
+  * @param  points: from getHandContactPoints.
+  * @param  sceneForces: per point, in the units of sceneQueryPoints.
+  * @retval None.
+  */
+void outputHandForces( float points[][3], float sceneForces[][3] ) {
+    /********************* THUMB *************************/
+    double torque1, torque2, torque3;
+
+    // Calculate the forces to apply in order to resist the user (N)
+    double Fx = K_DELTA_THUMB * sceneForces[0][0] / 1000.0;
+    double Fy = K_DELTA_THUMB * sceneForces[0][1] / 1000.0;
+    double Fz = K_DELTA_THUMB * sceneForces[0][2] / 1000.0;
+
+    // Saturate near singularities (precomputed map, no condition number here)
+    double scale = deltaThumbForceScale();
+    Fx *= scale;
+    Fy *= scale;
+    Fz *= scale;
+
+    // Force filter (THUMB_FORCE_FILTER in main.h)
+    static Filter forceFilter[3];
+    static double forceFilterTime_us = 0;
+    static int forceFilterReady = 0;
+    double now_us = getTime_us();
+    if (!forceFilterReady) {
+        for (int i = 0; i < 3; i++) filterInit(&forceFilter[i], THUMB_FORCE_FILTER);
+        forceFilterTime_us = now_us;
+        forceFilterReady = 1;
+    }
+    float dt = (float)((now_us - forceFilterTime_us) * 1e-6);
+    forceFilterTime_us = now_us;
+    // first tick or the clock went back: one period; a stall: at most HAND_FORCE_MAX_DT_S
+    if (!(dt > 0.0f)) dt = (float)HAND_FORCE_PERIOD_S;
+    if (dt > (float)HAND_FORCE_MAX_DT_S) dt = (float)HAND_FORCE_MAX_DT_S;
+    Fx = filterUpdate(&forceFilter[0], (float)Fx, dt);
+    Fy = filterUpdate(&forceFilter[1], (float)Fy, dt);
+    Fz = filterUpdate(&forceFilter[2], (float)Fz, dt);
+
+    // Passivity controller (HAND_PASSIVITY_MAX_DAMPING in main.h), on the force really output
+    float thumbForce[3] = { (float)Fx, (float)Fy, (float)Fz };
+    passivityUpdate(&handPassivity[0], points[0], thumbForce, dt, PASSIVITY_DAMPING_LIMIT);
+    Fx = thumbForce[0];
+    Fy = thumbForce[1];
+    Fz = thumbForce[2];
+
+    // Use jacobians to transforms forces into motor torques, only when there is a force:
+    // outside the sphere the Jacobian is not evaluated at all
+    torque1 = torque2 = torque3 = 0.0;
+    if ((Fx != 0.0) || (Fy != 0.0) || (Fz != 0.0)) {
+        // Get the jacobians
+        double J11, J12, J13, 
+               J21, J22, J23, 
+               J31, J32, J33;
+        // DeltaThumbGetJacobian (&J11, &J12, &J13, 
+        //                        &J21, &J22, &J23, 
+        //                        &J31, &J32, &J33);
+        // DeltaThumbGetJacobian_OhioVersion (&J11, &J12, &J13, 
+        //                                    &J21, &J22, &J23, 
+        //                                    &J31, &J32, &J33);
+        // analytic Jacobian of delta_calcForward, thumb frame, evaluated once per tick on demand
+        DeltaThumbGetJacobian_Fused (&J11, &J12, &J13, 
+                                     &J21, &J22, &J23, 
+                                     &J31, &J32, &J33);
+
+        /* Force to Torque*/
+        /* transpose */
+        // torque1 = J11 * Fx + J21 * Fy + J31 * Fz;
+        // torque2 = J12 * Fx + J22 * Fy + J32 * Fz;
+        // torque3 = J13 * Fx + J23 * Fy + J33 * Fz;
+        /* non - transpose */
+        torque1 = J11 * Fx + J12 * Fy + J13 * Fz;
+        torque2 = J21 * Fx + J22 * Fy + J23 * Fz;
+        torque3 = J31 * Fx + J32 * Fy + J33 * Fz;
     }
 
-    // Use jacobians to transforms forces into motor torques
-    // Get the jacobians
-    double J11, J12, J13, 
-           J21, J22, J23, 
-           J31, J32, J33;
-    // DeltaThumbGetJacobian (&J11, &J12, &J13, 
-    //                        &J21, &J22, &J23, 
-    //                        &J31, &J32, &J33);
-     DeltaThumbGetJacobian_OhioVersion (&J11, &J12, &J13, 
-                                        &J21, &J22, &J23, 
-                                        &J31, &J32, &J33);
-                                    
-    /* Force to Torque*/
-    /* transpose */
-    // torque1 = J11 * Fx + J21 * Fy + J31 * Fz;
-    // torque2 = J12 * Fx + J22 * Fy + J32 * Fz;
-    // torque3 = J13 * Fx + J23 * Fy + J33 * Fz;
-    /* non - transpose */
-    torque1 = J11 * Fx + J12 * Fy + J13 * Fz;
-    torque2 = J21 * Fx + J22 * Fy + J23 * Fz;
-    torque3 = J31 * Fx + J32 * Fy + J33 * Fz;
+    /* goTo/goToAngle position servo, zero unless a move was started */
+    double servo1, servo2, servo3;
+    getDeltaThumbServoTorque(&servo1, &servo2, &servo3);
+    torque1 += servo1;
+    torque2 += servo2;
+    torque3 += servo3;
+    TorqueMotor1 = torque1;
+    TorqueMotor2 = torque2;
+    TorqueMotor3 = torque3;
     outputTorqueMotor1(torque1);
     outputTorqueMotor2(torque2);
     outputTorqueMotor3(torque3);
 
-    /********************* FINGER 1 *************************/
-
-    // Check if finger 1 is inside sphere
-    xf1_global = getRx1() + NORMAL_XF;    // mm, translated to be in global frame
-    yf1_global = getRy1() + NORMAL_YF;    // mm, translated to be in global frame
-    double dist_f1 = sphereDistance(xf1_global, yf1_global, NORMAL_ZF1); // mm
-    double TorqueX_f1, TorqueY_f1;
-    double Fx_f1=0, Fy_f1=0;
-
-    if (dist_f1 < SPHERE1_RADIUS) {
-        // Calculate the forces to apply in order to resist the user
-        dist_f1 = dist_f1/1000.0; // m
-        xf1_global = xf1_global/1000.0; // m
-        yf1_global = yf1_global/1000.0; // m
-        Fx_f1 = K_FINGERS*(SPHERE1_RADIUS/1000.0 - dist_f1) * ((1.0/dist_f1) * (xf1_global - SPHERE1_X/1000.0)); // N
-        Fy_f1 = K_FINGERS*(SPHERE1_RADIUS/1000.0 - dist_f1) * ((1.0/dist_f1) * (yf1_global - SPHERE1_Y/1000.0)); // N
-    }
+    /********************* FINGERS *************************/
+    // one pass over the limb table (hand_limbs.h), positions in the hand frame
+    for (int i = 0; i < HAND_LIMB_COUNT; i++) {
+        // in the limb plane, the scene force along z is not felt
+        double Fx_f = K_FINGERS * sceneForces[1 + i][0] / 1000.0; // N
+        double Fy_f = K_FINGERS * sceneForces[1 + i][1] / 1000.0; // N
 
-    // Map back to local coordinate axes
-    Fx_f1 = Fx_f1;      // axes aligned, no rotation needed
-    Fy_f1 = Fy_f1;      
-
-    // Use jacobians to transforms forces into motor torques
-    /* Force to Torque*/
-    TorqueX_f1 = J00_f1*Fx_f1 + J10_f1*Fy_f1;
-    TorqueX_f1 = TorqueX_f1*0.001;
-    TorqueY_f1 = J01_f1*Fx_f1 + J11_f1*Fy_f1;
-    TorqueY_f1 = TorqueY_f1*0.001;
-            
-    TorqueMotor4 = ((TorqueX_f1*R_MA)/R_A);
-    TorqueMotor5 = ((TorqueY_f1*R_MB)/R_B); 
-            
-    outputTorqueMotor4(TorqueMotor4);
-    outputTorqueMotor5(TorqueMotor5);  
-
-    /********************* FINGER 2 *************************/
-
-    // Check if finger 2 is inside sphere
-    xf2_global = getRx2() + NORMAL_XF;      // mm, translated to be in global frame
-    yf2_global = getRy2() + NORMAL_YF;      // mm, translated to be in global frame
-    double dist_f2 = sphereDistance(xf2_global, yf2_global, NORMAL_ZF2); // mm
-    double TorqueX_f2, TorqueY_f2;
-    double Fx_f2=0, Fy_f2=0;
-
-    if (dist_f2 < SPHERE1_RADIUS) {
-        // Calculate the forces to apply in order to resist the user
-        dist_f2 = dist_f2/1000.0; // m
-        xf2_global = xf2_global/1000.0; // m
-        yf2_global = yf2_global/1000.0; // m
-        Fx_f2 = K_FINGERS*(SPHERE1_RADIUS/1000.0 - dist_f2) * ((1.0/dist_f2) * (xf2_global - SPHERE1_X/1000.0)); // N
-        Fy_f2 = K_FINGERS*(SPHERE1_RADIUS/1000.0 - dist_f2) * ((1.0/dist_f2) * (yf2_global - SPHERE1_Y/1000.0)); // N
-    }
+        float fingerForce[2] = { (float)Fx_f, (float)Fy_f };
+        passivityUpdate(&handPassivity[1 + i], points[1 + i], fingerForce, dt, PASSIVITY_DAMPING_LIMIT);
+        Fx_f = fingerForce[0];
+        Fy_f = fingerForce[1];
 
-    // Map back to local coordinate axes
-    Fx_f2 = Fx_f2; // axes aligned, no rotation needed
-    Fy_f2 = Fy_f2;
-
-    // Use jacobians to transforms forces into motor torques
-    /* Force to Torque*/
-    TorqueX_f2 = J00_f2*Fx_f2 + J10_f2*Fy_f2;
-    TorqueX_f2 = TorqueX_f2*0.001;
-    TorqueY_f2 = J01_f2*Fx_f2 + J11_f2*Fy_f2;
-    TorqueY_f2 = TorqueY_f2*0.001;
-            
-    TorqueMotor6 = -((TorqueX_f2*R_MA)/R_A);
-    TorqueMotor7 = -((TorqueY_f2*R_MB)/R_B); 
-            
-    outputTorqueMotor6(TorqueMotor6);
-    outputTorqueMotor7(TorqueMotor7);  
+        // Use jacobians to transforms forces into motor torques (zero force: zero torques, no Jacobian)
+        handLimbOutputForce(i, Fx_f, Fy_f);
+    }
+    endJacobianEvaluationTick();    // timing stream: Jacobians of this tick
 
     // if (torque1 != 0){
     //     printf("Tx=%f, Ty=%f, Tz=%f\n", torque1, torque2, torque3);
@@ -174,6 +323,59 @@ void renderOutsideSphere( void ) {
 }
 
 
+/*******************************************************************************
+  * @name   fillHandTelemetry
+  * @brief  Copies the hand state the telemetry streams show, from the
+  *         context that renders it (the servo interrupt with
+  *         HAND_SERVO_RATE_HZ, which publishes it every tick). The sphere
+  *         is only filled for the free object, the scene is the loop's.
+  * @param  telemetry: out.
+  * @retval None.
+  */
+void fillHandTelemetry( HandTelemetry *telemetry ) {
+    telemetry->thumb[0] = deltaThumbX;
+    telemetry->thumb[1] = deltaThumbY;
+    telemetry->thumb[2] = deltaThumbZ;
+    telemetry->thumbTorque[0] = TorqueMotor1;
+    telemetry->thumbTorque[1] = TorqueMotor2;
+    telemetry->thumbTorque[2] = TorqueMotor3;
+    telemetry->limbs = handLimbState;
+    for (int j = 0; j < 1 + HAND_LIMB_COUNT; j++) {
+        telemetry->passivityEnergy[j] = handPassivity[j].energy;
+        telemetry->passivityDissipated[j] = handPassivity[j].dissipated;
+        telemetry->passivityDamping[j] = handPassivity[j].damping;
+    }
+#ifdef HAND_GRASP_OBJECT
+    telemetry->sphere[0] = handGrasp.c[0];
+    telemetry->sphere[1] = handGrasp.c[1];
+    telemetry->sphere[2] = handGrasp.c[2];
+    telemetry->sphere[3] = handGrasp.radius;
+#endif
+    telemetry->servoTickMaxUs = 0.0;
+}
+
+/*******************************************************************************
+  * @name   getHandTelemetry
+  * @brief  The hand state for the telemetry streams, all from the same
+  *         tick. Main loop; the streams read the hand only through this.
+  * @param  telemetry: out.
+  * @retval None.
+  */
+void getHandTelemetry( HandTelemetry *telemetry ) {
+#ifdef HAND_SERVO_RATE_HZ
+    getHandServoTelemetry(telemetry);
+#else
+    fillHandTelemetry(telemetry);
+#endif
+#ifndef HAND_GRASP_OBJECT
+    telemetry->sphere[0] = getSphereX();
+    telemetry->sphere[1] = getSphereY();
+    telemetry->sphere[2] = getSphereZ();
+    telemetry->sphere[3] = getSphereRadius();
+#endif
+}
+
+
 /*******************************************************************************
   * @name   sphereDistance
   * @brief  Euclidean distance from user location to sphere's center
@@ -191,31 +393,88 @@ double sphereDistance( double user_x, double user_y, double user_z ) {
 }
 
 
+/*******************************************************************************
+  * @name   firstSceneSphere
+  * @brief  The sphere sent to Processing: the first one in handScene (the
+  *         free object instead with HAND_GRASP_OBJECT).
+  * @param  None.
+  * @retval index in handScene, -1 if there is no sphere.
+  */
+#ifndef HAND_GRASP_OBJECT
+static int firstSceneSphere( void ) {
+    for (int i = 0; i < handScene.count; i++) {
+        if (handScene.type[i] == SCENE_SPHERE) return i;
+    }
+    return -1;
+}
+#endif
+
 double getSphereX( void ) {
-    return SPHERE1_X;
+#ifdef HAND_GRASP_OBJECT
+    return handGrasp.c[0];
+#else
+    int i = firstSceneSphere();
+    return (i < 0) ? 0.0 : handScene.px[i];
+#endif
 }
 double getSphereY( void ) {
-    return SPHERE1_Y;
+#ifdef HAND_GRASP_OBJECT
+    return handGrasp.c[1];
+#else
+    int i = firstSceneSphere();
+    return (i < 0) ? 0.0 : handScene.py[i];
+#endif
 }
 double getSphereZ( void ) {
-    return SPHERE1_Z;
+#ifdef HAND_GRASP_OBJECT
+    return handGrasp.c[2];
+#else
+    int i = firstSceneSphere();
+    return (i < 0) ? 0.0 : handScene.pz[i];
+#endif
 }
 double getSphereRadius( void ) {
-    return SPHERE1_RADIUS;
+#ifdef HAND_GRASP_OBJECT
+    return handGrasp.radius;
+#else
+    int i = firstSceneSphere();
+    return (i < 0) ? 0.0 : handScene.radius[i];
+#endif
 }
 
 double getXf1_global( void ) {
-    return xf1_global;
+    return handLimbState.x[HAND_FINGER_1];
 }
 
 double getYf1_global( void ) {
-    return yf1_global;
+    return handLimbState.y[HAND_FINGER_1];
 }
 
 double getXf2_global( void ) {
-    return xf2_global;
+    return handLimbState.x[HAND_FINGER_2];
 }
 
 double getYf2_global( void ) {
-    return yf2_global;
+    return handLimbState.y[HAND_FINGER_2];
+}
+
+/*******************************************************************************
+  * @name   getHandTelemetryTorque
+  * @brief  Torque commanded by outputHandForces on the tick of a telemetry
+  *         copy.
+  * @param  telemetry: from getHandTelemetry.
+  * @param  motor: MOTOR_1 ... MOTOR_7.
+  * @retval torque in Nm.
+  */
+double getHandTelemetryTorque( const HandTelemetry *telemetry, int motor ) {
+    switch (motor) {
+        case MOTOR_1: return telemetry->thumbTorque[0];
+        case MOTOR_2: return telemetry->thumbTorque[1];
+        case MOTOR_3: return telemetry->thumbTorque[2];
+    }
+    for (int i = 0; i < HAND_LIMB_COUNT; i++) {
+        if (handLimbs[i].motorA == motor) return telemetry->limbs.torqueA[i];
+        if (handLimbs[i].motorB == motor) return telemetry->limbs.torqueB[i];
+    }
+    return 0.0;
 }
@@ -15,14 +15,18 @@
 #endif
 
 #include "main.h"
+#include "hand_limbs.h"
+#include <stdint.h>
 
 
 /* Virtual Environments Constants */
-// Obstacles
+// Obstacles, the default scene (initHandScene, hand_scene.h for the others)
 #define SPHERE1_X 0.0
 #define SPHERE1_Y 0.0
 #define SPHERE1_Z 35.0          // Yuichi recommendation is 110.0, Delta Z currently variable.
 #define SPHERE1_RADIUS 50.0     // Delta Z should be XX per CAD, radius should be 
+#define SPHERE1_STATIC_FRICTION 0.6     // 0 for a frictionless sphere
+#define SPHERE1_KINETIC_FRICTION 0.4
 
 // Can feel on both with Z = 70, radius = 50
 // Can feel on just F1 with Z = 35, radius = 50
@@ -43,8 +47,43 @@
 
 #define K_FINGERS 200.0
 
+// Period of outputHandForces: the time step its force filter and passivity
+// controller get is kept between 0 and HAND_FORCE_MAX_DT_S
+#ifdef HAND_SERVO_RATE_HZ
+#define HAND_FORCE_PERIOD_S (1.0 / HAND_SERVO_RATE_HZ)
+#else
+#define HAND_FORCE_PERIOD_S 0.001       // main loop, about 1 kHz
+#endif
+#define HAND_FORCE_MAX_DT_S (10 * HAND_FORCE_PERIOD_S)
+
+// Grasped object (HAND_GRASP_OBJECT in main.h): gravity in the hand frame, set
+// it to point down for how the hand is mounted; the table the object starts
+// on is under SPHERE1, square to it
+#define GRASP_GRAVITY_X 0.0
+#define GRASP_GRAVITY_Y 0.0
+#define GRASP_GRAVITY_Z -9810.0         // mm/s^2
+#define GRASP_TABLE_STIFFNESS 2.0       // N/mm
+
+// What the telemetry streams show of the hand, all from one tick (getHandTelemetry)
+typedef struct {
+    double thumb[3];                                // deltaThumbX/Y/Z, mm
+    double thumbTorque[3];                          // motors 1, 2, 3, Nm
+    HandLimbState limbs;                            // handLimbState
+    float passivityEnergy[1 + HAND_LIMB_COUNT];     // mJ taken from the user, the thumb then every limb
+    float passivityDissipated[1 + HAND_LIMB_COUNT]; // mJ taken out by the passivity damping
+    float passivityDamping[1 + HAND_LIMB_COUNT];    // N s/m, last tick
+    double sphere[4];                               // x, y, z, radius, mm (getSphereX ...)
+    double servoTickMaxUs;                          // longest servo tick, 0 without HAND_SERVO_RATE_HZ
+} HandTelemetry;
+
 /* Virtual Environments Functions*/
-void renderOutsideSphere( void );
+void initHandScene( void );
+void renderHandScene( void );
+void getHandContactPoints( float points[][3] );
+void outputHandForces( float points[][3], float sceneForces[][3] );
+void addHandGraspForces( float points[][3], float sceneForces[][3], double now_us );
+int receiveHostModels( const uint8_t * frame );
+int receiveObjectKeyframes( const uint8_t * frame );
 double sphereDistance( double user_x, double user_y, double user_z );
 
 double getSphereX( void );
@@ -57,6 +96,10 @@ double getYf1_global( void );
 double getXf2_global( void );
 double getYf2_global( void );
 
+void fillHandTelemetry( HandTelemetry *telemetry );
+void getHandTelemetry( HandTelemetry *telemetry );
+double getHandTelemetryTorque( const HandTelemetry *telemetry, int motor );
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,310 @@
+/**
+  ******************************************************************************
+  * @file    haplink_ascii_format.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Fixed precision formatter for the tab separated text protocol.
+  *          newlib's printf("%.2f") goes through dtoa and costs tens of us
+  *          per field on the F446, this writes the digits from a scaled
+  *          integer instead. Rounding is round-half-even on the exact binary
+  *          value, same as printf, so the output matches byte for byte.
+  *          Floats are scaled with integer math only; doubles use an exact
+  *          (Dekker) product so near-ties round the same way printf does.
+  *          Values too large for 64 bit scaled integers fall back to snprintf,
+  *          in exponent form if "%.Nf" would be longer than 32 characters.
+  *          Host benchmark against snprintf: tools/bench_ascii_format.c
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "haplink_ascii_format.h"
+#include <math.h>
+#include <stdio.h>
+
+/* Global Variables ----------------------------------------------------------*/
+static const uint32_t powersOfTen[ASCII_FORMAT_MAX_DECIMALS + 1] =
+{
+    1, 10, 100, 1000, 10000, 100000, 1000000
+};
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   appendScaled
+  * @brief  writes n / 10^decimals with exactly decimals digits after the point.
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  negative: 1 to write a leading '-'.
+  * @param  n: the value times 10^decimals, already rounded.
+  * @param  decimals: digits after the point.
+  * @retval new end of the string.
+  */
+static char * appendScaled( char * cursor, const char * end, int negative, uint64_t n, int decimals )
+{
+    char digits[24];
+    uint32_t n32;
+    int count = 0;
+
+    // digits come out least significant first
+    while (n > 0xFFFFFFFFu)
+    {
+        digits[count++] = (char)('0' + (n % 10));
+        n = n / 10;
+    }
+    n32 = (uint32_t)n;
+    while ((n32 > 0) || (count <= decimals))
+    {
+        digits[count++] = (char)('0' + (n32 % 10));
+        n32 = n32 / 10;
+    }
+
+    if (negative)
+    {
+        cursor = appendChar(cursor, end, '-');
+    }
+    while (count > decimals)
+    {
+        cursor = appendChar(cursor, end, digits[--count]);
+    }
+    if (decimals > 0)
+    {
+        cursor = appendChar(cursor, end, '.');
+        while (count > 0)
+        {
+            cursor = appendChar(cursor, end, digits[--count]);
+        }
+    }
+    return cursor;
+}
+
+/*******************************************************************************
+  * @name   appendNonFinite
+  * @brief  writes nan or inf the way glibc's printf does.
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  negative: sign bit of the value.
+  * @param  isNan: 1 for nan, 0 for inf.
+  * @retval new end of the string.
+  */
+static char * appendNonFinite( char * cursor, const char * end, int negative, int isNan )
+{
+    if (negative)
+    {
+        cursor = appendChar(cursor, end, '-');
+    }
+    return appendString(cursor, end, isNan ? "nan" : "inf");
+}
+
+/*******************************************************************************
+  * @name   appendFallback
+  * @brief  for values too large for the scaled integer path. "%.*f" of a
+  *         double can run to hundreds of characters, past that the value
+  *         goes out as "%.*e".
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  value: value to print.
+  * @param  decimals: digits after the point.
+  * @retval new end of the string.
+  */
+static char * appendFallback( char * cursor, const char * end, double value, int decimals )
+{
+    char text[33];
+    int length = snprintf(text, sizeof(text), "%.*f", decimals, value);
+
+    if ((length < 0) || (length >= (int)sizeof(text)))
+    {
+        // "-d." and "e+308" leave 24 digits
+        snprintf(text, sizeof(text), "%.*e", (decimals < 24) ? decimals : 24, value);
+    }
+    return appendString(cursor, end, text);
+}
+
+/*******************************************************************************
+  * @name   appendString
+  * @brief  copies text without its terminator.
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  text: null terminated string.
+  * @retval new end of the string.
+  */
+char * appendString( char * cursor, const char * end, const char * text )
+{
+    while (*text && (cursor < end))
+    {
+        *cursor++ = *text++;
+    }
+    return cursor;
+}
+
+char * appendChar( char * cursor, const char * end, char c )
+{
+    if (cursor < end)
+    {
+        *cursor++ = c;
+    }
+    return cursor;
+}
+
+void appendTerminator( char * cursor )
+{
+    *cursor = 0;
+}
+
+/*******************************************************************************
+  * @name   appendFloat
+  * @brief  same output as printf("%.*f", decimals, (double)value). The float
+  *         is split into its 24 bit mantissa and exponent so the scaling and
+  *         the rounding are exact integer operations.
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  value: value to print.
+  * @param  decimals: 0 to ASCII_FORMAT_MAX_DECIMALS.
+  * @retval new end of the string.
+  */
+char * appendFloat( char * cursor, const char * end, float value, int decimals )
+{
+    union { float f; uint32_t u; } bits;
+    uint32_t mantissa;
+    uint64_t scaled, n, remainder, half;
+    int negative, exponent, shift;
+
+    if ((decimals < 0) || (decimals > ASCII_FORMAT_MAX_DECIMALS))
+    {
+        return appendFallback(cursor, end, value, decimals);
+    }
+
+    bits.f = value;
+    negative = (int)(bits.u >> 31);
+    exponent = (int)((bits.u >> 23) & 0xFF);
+    mantissa = bits.u & 0x7FFFFF;
+
+    if (exponent == 0xFF)
+    {
+        return appendNonFinite(cursor, end, negative, mantissa != 0);
+    }
+    if (exponent == 0)
+    {
+        exponent = 1;   //denormal
+    }
+    else
+    {
+        mantissa |= 0x800000;
+    }
+
+    // |value| = mantissa * 2^shift, and mantissa * 10^6 < 2^44
+    shift = exponent - 150;
+    scaled = (uint64_t)mantissa * powersOfTen[decimals];
+    if (shift >= 0)
+    {
+        if (shift > 19)
+        {
+            return appendFallback(cursor, end, value, decimals);
+        }
+        n = scaled << shift;
+    }
+    else if (-shift >= 45)
+    {
+        n = 0;          //less than half a count
+    }
+    else
+    {
+        shift = -shift;
+        n = scaled >> shift;
+        remainder = scaled & ((1ULL << shift) - 1);
+        half = 1ULL << (shift - 1);
+        if ((remainder > half) || ((remainder == half) && (n & 1)))
+        {
+            n = n + 1;
+        }
+    }
+    return appendScaled(cursor, end, negative, n, decimals);
+}
+
+/*******************************************************************************
+  * @name   appendDouble
+  * @brief  same output as printf("%.*f", decimals, value). The product
+  *         value * 10^decimals is computed exactly as p + e (Dekker's
+  *         two-product, no fma needed) so ties and near-ties round like printf.
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  value: value to print.
+  * @param  decimals: 0 to ASCII_FORMAT_MAX_DECIMALS.
+  * @retval new end of the string.
+  */
+char * appendDouble( char * cursor, const char * end, double value, int decimals )
+{
+    const double splitter = 134217729.0; // 2^27 + 1
+    double a, scale, p, e, aHigh, aLow, sHigh, sLow, t, whole, fraction, direction;
+    uint64_t n;
+    int negative;
+
+    if ((decimals < 0) || (decimals > ASCII_FORMAT_MAX_DECIMALS))
+    {
+        return appendFallback(cursor, end, value, decimals);
+    }
+
+    negative = signbit(value) ? 1 : 0;
+    if (isnan(value) || isinf(value))
+    {
+        return appendNonFinite(cursor, end, negative, isnan(value));
+    }
+
+    a = fabs(value);
+    scale = (double)powersOfTen[decimals];
+    p = a * scale;
+    if (p >= 4503599627370496.0) // 2^52, the fraction is no longer exact
+    {
+        return appendFallback(cursor, end, value, decimals);
+    }
+
+    // e = a * scale - p exactly
+    t = splitter * a;
+    aHigh = t - (t - a);
+    aLow = a - aHigh;
+    t = splitter * scale;
+    sHigh = t - (t - scale);
+    sLow = scale - sHigh;
+    e = ((aHigh * sHigh - p) + aHigh * sLow + aLow * sHigh) + aLow * sLow;
+
+    whole = floor(p);
+    fraction = p - whole;                   //exact
+    direction = (fraction - 0.5) + e;       //sign is exact
+    n = (uint64_t)whole;
+    if ((direction > 0.0) || ((direction == 0.0) && (n & 1)))
+    {
+        n = n + 1;
+    }
+    return appendScaled(cursor, end, negative, n, decimals);
+}
+
+/*******************************************************************************
+  * @name   appendUnsigned
+  * @brief  same output as printf("%u").
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  value: value to print.
+  * @retval new end of the string.
+  */
+char * appendUnsigned( char * cursor, const char * end, uint32_t value )
+{
+    return appendScaled(cursor, end, 0, value, 0);
+}
+
+/*******************************************************************************
+  * @name   appendInt
+  * @brief  same output as printf("%i").
+  * @param  cursor: where to write.
+  * @param  end: one past the last byte it may write.
+  * @param  value: value to print.
+  * @retval new end of the string.
+  */
+char * appendInt( char * cursor, const char * end, int32_t value )
+{
+    if (value < 0)
+    {
+        return appendScaled(cursor, end, 1, (uint64_t)(-(int64_t)value), 0);
+    }
+    return appendScaled(cursor, end, 0, (uint64_t)value, 0);
+}
+//EOF
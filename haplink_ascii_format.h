@@ -0,0 +1,40 @@
+/**
+  ******************************************************************************
+  * @file    haplink_ascii_format.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Fast fixed precision number formatting for the text protocol.
+  *          Output is byte-identical to printf's "%.Nf", "%u" and "%i" but
+  *          uses scaled integers instead of newlib's dtoa, no varargs and no
+  *          locale. Each append function writes at the cursor, never past
+  *          end (one past the last byte it may use; what does not fit is
+  *          cut), and returns the new end of the string (not
+  *          null-terminated, call appendTerminator when done, with a byte
+  *          left for it).
+  ******************************************************************************
+  */
+#ifndef __HAPLINK_ASCII_FORMAT_H_
+#define __HAPLINK_ASCII_FORMAT_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+#define ASCII_FORMAT_MAX_DECIMALS   6   // "%lf" and "%f" print 6 decimals
+
+char * appendString( char * cursor, const char * end, const char * text );
+char * appendChar( char * cursor, const char * end, char c );
+char * appendFloat( char * cursor, const char * end, float value, int decimals );
+char * appendDouble( char * cursor, const char * end, double value, int decimals );
+char * appendUnsigned( char * cursor, const char * end, uint32_t value );
+char * appendInt( char * cursor, const char * end, int32_t value );
+void appendTerminator( char * cursor );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAPLINK_ASCII_FORMAT_H_
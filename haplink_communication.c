@@ -13,6 +13,15 @@
 #include "haplink_communication.h"
 #include "haplink_motors.h"
 #include "haplink_position.h"
+#include "haplink_telemetry.h"
+#include "haplink_telemetry_streams.h"
+#include "haplink_encoders.h"
+#include "delta_thumb.h"
+#include "hand_virtual_environment.h"
+#include "hand_host_models.h"
+#include "hand_motion.h"
+#include "haplink_time.h"
+#include <math.h>
 
 
 /* Global Variables ----------------------------------------------------------*/
@@ -33,9 +42,111 @@ double ry_tele = 0.0;
 double ry_tele_new_d = 0.0;
 uint16_t ry_tele_new = 0;
 
+//full hand teleoperation, see TELEOP_HAND_FRAME_TYPE
+uint8_t teleHandSequenceOut = 0;
+uint8_t teleHandSequence = 0;
+uint32_t teleHandTimestamp = 0;
+int teleHandMode = TELEOP_HAND_POSES;
+double teleHandValues[TELEOP_HAND_VALUES] = {0};
+
+//latency probe, see the 'g' message
+int pingHasBeenRequested = 0;
+uint32_t pingHostStamp = 0;
+double pingReceivedTime_us = 0.0;
+
 /* Function Definitions ------------------------------------------------------*/
 
+/*******************************************************************************
+  * @name   parseUnsigned
+  * @brief  Reads a decimal number from a text message, skipping leading spaces.
+  * @param  uint8_t ** cursor: position in the message, advanced past the number.
+  * @retval the number, 0 if there are no digits.
+  */
+static uint32_t parseUnsigned( uint8_t ** cursor )
+{
+    uint32_t value = 0;
+    uint8_t * c = *cursor;
+    while (*c == ' ')
+    {
+        c++;
+    }
+    while ((*c >= '0') && (*c <= '9'))
+    {
+        value = value * 10 + (*c - '0');
+        c++;
+    }
+    *cursor = c;
+    return value;
+}
+
+
+/*******************************************************************************
+  * @name   putInt
+  * @brief  Writes the low bytes of value little endian.
+  * @param  int32_t value: value to write.
+  * @param  uint8_t * buffer: destination.
+  * @param  int bytes: 2 or 4.
+  * @retval None
+  */
+static void putInt( int32_t value, uint8_t * buffer, int bytes )
+{
+    int i;
+    for (i = 0; i < bytes; i++)
+    {
+        buffer[i] = ((uint32_t)value >> (8 * i)) & 0xFF;
+    }
+}
 
+static uint32_t getUint( const uint8_t * buffer, int bytes )
+{
+    uint32_t value = 0;
+    int i;
+    for (i = bytes - 1; i >= 0; i--)
+    {
+        value = (value << 8) | buffer[i];
+    }
+    return value;
+}
+
+/*******************************************************************************
+  * @name   decodeHandFrame
+  * @brief  Checks and unpacks a full hand teleoperation frame.
+  * @param  uint8_t * frame: whole frame starting at the sync byte.
+  * @retval 1 if the frame was good, 0 otherwise.
+  */
+static int decodeHandFrame( uint8_t * frame )
+{
+    uint8_t length = frame[2];
+    uint8_t * payload = &frame[3];
+    int bytes, i;
+
+    if ((frame[1] != TELEOP_HAND_FRAME_TYPE) || (length < TELEOP_HAND_HEADER))
+    {
+        return 0;
+    }
+    bytes = (payload[5] == TELEOP_HAND_JOINTS) ? 4 : 2;
+    if ((length != TELEOP_HAND_HEADER + bytes * TELEOP_HAND_VALUES) ||
+        (telemetryCrc8(&frame[1], length + 2) != payload[length]))
+    {
+        return 0;
+    }
+
+    teleHandSequence = payload[0];
+    teleHandTimestamp = getUint(&payload[1], 4);
+    teleHandMode = payload[5];
+    for (i = 0; i < TELEOP_HAND_VALUES; i++)
+    {
+        if (bytes == 4)
+        {
+            teleHandValues[i] = (int32_t)getUint(&payload[TELEOP_HAND_HEADER + 4 * i], 4);
+        }
+        else
+        {
+            teleHandValues[i] = (int16_t)getUint(&payload[TELEOP_HAND_HEADER + 2 * i], 2) / TELEOP_HAND_POSE_SCALE;
+        }
+    }
+    return 1;
+}
 
 /*******************************************************************************
   * @name   resetCommunicationVariables
@@ -49,17 +160,18 @@ void resetCommunicationVariables( void )
     seenLifeFromComputer = 0;
     dataHasBeenRequested = 0; 
     dataTeleOperationHasBeenRequested = 0;
+    pingHasBeenRequested = 0;
 }
 
-
 /*******************************************************************************
   * @name   decodeMessage
   * @brief  Decodes message received from Processing program and performs
             instructions.
   * @param  char * buf: message received.
+  * @param  double received_us: timebase time its first byte arrived (RxMessage).
   * @retval None
   */
-int decodeMessage( uint8_t * buf )
+int decodeMessage( uint8_t * buf, double received_us )
 {
 int returnmessage = -1;    //message unknown 
 seenLifeFromComputer = 1;
@@ -77,6 +189,53 @@ seenLifeFromComputer = 1;
        returnmessage = 3;
        dataHasBeenRequested = 1;
     }
+    else if (buf[0] == 'k') //host lost a telemetry frame, resend everything
+    {
+       returnmessage = 4;
+       requestTelemetryKeyframe();
+    }
+    else if (buf[0] == 'r') //change a telemetry stream: "r<stream> <rate Hz> <priority>l"
+    {
+        uint8_t * cursor = &buf[1];
+        uint32_t stream = parseUnsigned(&cursor);
+        uint32_t rate = parseUnsigned(&cursor);
+        uint32_t priority = parseUnsigned(&cursor);
+        if (rate > 0xFFFF) rate = 0xFFFF;
+        if (priority > 0xFF) priority = 0xFF;
+        returnmessage = 5;
+        setTelemetryStreamRate((int)stream, (uint16_t)rate, (uint8_t)priority);
+    }
+    else if (buf[0] == 'g') //latency probe: "g<host stamp>l", answered with a ping reply frame
+    {
+        uint8_t * cursor = &buf[1];
+        returnmessage = 6;
+        pingHostStamp = parseUnsigned(&cursor);
+        pingReceivedTime_us = received_us;
+        pingHasBeenRequested = 1;
+    }
+    else if ((buf[0] == TELEMETRY_FRAME_SYNC) && (buf[1] == HOST_MODELS_FRAME_TYPE)) //local contact models from the host
+    {
+        if (receiveHostModels(buf))
+        {
+            returnmessage = 8;
+        }
+    }
+    else if ((buf[0] == TELEMETRY_FRAME_SYNC) && (buf[1] == MOTION_FRAME_TYPE)) //object keyframes from the host
+    {
+        if (receiveObjectKeyframes(buf))
+        {
+            returnmessage = 9;
+        }
+    }
+    else if (buf[0] == TELEMETRY_FRAME_SYNC) //full hand teleoperation frame
+    {
+        if (decodeHandFrame(buf))
+        {
+            returnmessage = 7;
+            //same as 'p', the teleoperator wants our hand back
+            dataTeleOperationHasBeenRequested = dataTeleOperationHasBeenRequested + 1;
+        }
+    }
     else if (buf[0] == 'm')
     {
         returnmessage = 22;
@@ -205,6 +364,95 @@ void get_rx_ry_packed( uint8_t * buffer_to_pack )
     buffer_to_pack[5] = 'l';
 }
 
+/*******************************************************************************
+  * @name   get_hand_packed
+  * @brief  Packs the whole hand as a teleoperation frame, see
+            TELEOP_HAND_FRAME_TYPE in haplink_communication.h.
+  * @param  uint8_t * buffer_to_pack: at least TELEOP_HAND_MAX_FRAME_SIZE bytes.
+  * @param  int mode: TELEOP_HAND_JOINTS or TELEOP_HAND_POSES.
+  * @retval number of bytes in the frame.
+  */
+int get_hand_packed( uint8_t * buffer_to_pack, int mode )
+{
+    uint8_t * payload = &buffer_to_pack[3];
+    int n = TELEOP_HAND_HEADER;
+    int i;
+
+    payload[0] = teleHandSequenceOut++;
+    putInt((int32_t)getTime32_us(), &payload[1], 4);
+    payload[5] = (uint8_t)mode;
+
+    if (mode == TELEOP_HAND_JOINTS)
+    {
+        int32_t counts[TELEOP_HAND_VALUES];
+        counts[0] = getCountsSensor1();
+        counts[1] = getCountsSensor2();
+        counts[2] = getCountsSensor3();
+        counts[3] = getCountsSensor4();
+        counts[4] = getCountsSensor5();
+        counts[5] = getCountsSensor6();
+        counts[6] = getCountsSensor7();
+        for (i = 0; i < TELEOP_HAND_VALUES; i++)
+        {
+            putInt(counts[i], &payload[n], 4);
+            n = n + 4;
+        }
+    }
+    else
+    {
+        double poses[TELEOP_HAND_VALUES];
+        double position;
+        HandTelemetry hand;
+        getHandTelemetry(&hand);
+        poses[0] = hand.thumb[0];
+        poses[1] = hand.thumb[1];
+        poses[2] = hand.thumb[2];
+        poses[3] = hand.limbs.x[HAND_FINGER_1];
+        poses[4] = hand.limbs.y[HAND_FINGER_1];
+        poses[5] = hand.limbs.x[HAND_FINGER_2];
+        poses[6] = hand.limbs.y[HAND_FINGER_2];
+        for (i = 0; i < TELEOP_HAND_VALUES; i++)
+        {
+            position = poses[i] * TELEOP_HAND_POSE_SCALE; //two digits of precision
+            if (position > 32767.0) position = 32767.0;
+            if (position < -32768.0) position = -32768.0;
+            putInt((int32_t)lrint(position), &payload[n], 2);
+            n = n + 2;
+        }
+    }
+    return telemetryFinishFrame(buffer_to_pack, TELEOP_HAND_FRAME_TYPE, n);
+}
+
+int get_tele_hand_mode( void )
+{
+    return teleHandMode;
+}
+
+/*******************************************************************************
+  * @name   get_tele_hand_value
+  * @brief  Last value received from the teleoperator.
+  * @param  int index: 0 to TELEOP_HAND_VALUES - 1, order as in the frame.
+  * @retval encoder counts or mm, depending on get_tele_hand_mode().
+  */
+double get_tele_hand_value( int index )
+{
+    if ((index < 0) || (index >= TELEOP_HAND_VALUES))
+    {
+        return 0.0;
+    }
+    return teleHandValues[index];
+}
+
+uint8_t get_tele_hand_sequence( void )
+{
+    return teleHandSequence;
+}
+
+uint32_t get_tele_hand_timestamp( void )
+{
+    return teleHandTimestamp;
+}
+
 
 /*---- Functions to return communication variables ---------- */
 int returnMessageAcknowledged( void )
@@ -226,6 +474,21 @@ int returnTeleOperationHasBeenRequested( void )
 {
     return dataTeleOperationHasBeenRequested;
 }
+
+int returnPingHasBeenRequested( void )
+{
+    return pingHasBeenRequested;
+}
+
+uint32_t getPingHostStamp( void )
+{
+    return pingHostStamp;
+}
+
+double getPingReceivedTime_us( void )
+{
+    return pingReceivedTime_us;
+}
 /*---- Functions to clear communication variables ---------- */
 void clearMessageAcknowledged( void )
 {
@@ -246,4 +509,9 @@ void clearTeleOperationHasBeenRequested( void )
 {
     dataTeleOperationHasBeenRequested = 0;
 }
+
+void clearPingHasBeenRequested( void )
+{
+    pingHasBeenRequested = 0;
+}
 //EOF
\ No newline at end of file
@@ -16,23 +16,48 @@
 
 #include "main.h"
 
+/* Full hand teleoperation frame ---------------------------------------------*/
+// Sent and received as a telemetry frame (haplink_telemetry.h):
+//    [0xA5]['H'][len][payload][crc8]
+// payload: [seq][timestamp us, uint32][mode][7 values]
+//    TELEOP_HAND_JOINTS: encoder counts of motors 1 to 7, int32 each
+//    TELEOP_HAND_POSES:  thumb x y z, finger 1 x y, finger 2 x y in
+//                        1/100 mm, int16 each
+// All multi-byte values little endian.
+#define TELEOP_HAND_FRAME_TYPE      'H'
+#define TELEOP_HAND_JOINTS          0
+#define TELEOP_HAND_POSES           1
+#define TELEOP_HAND_VALUES          7
+#define TELEOP_HAND_POSE_SCALE      100.0   // counts per mm
+#define TELEOP_HAND_HEADER          6       // seq, timestamp, mode
+#define TELEOP_HAND_MAX_FRAME_SIZE  (TELEOP_HAND_HEADER + 4 * TELEOP_HAND_VALUES + 4)
+
 void resetCommunicationVariables( void );
-int decodeMessage( uint8_t * buf );
+int decodeMessage( uint8_t * buf, double received_us );
 double get_tele_position( void);
 double get_rx_tele( void );
 double get_ry_tele( void );
 void get_xH_packed( uint8_t * buffer_to_pack );
 void get_rx_ry_packed( uint8_t * buffer_to_pack );
+int get_hand_packed( uint8_t * buffer_to_pack, int mode );
+int get_tele_hand_mode( void );
+double get_tele_hand_value( int index );
+uint8_t get_tele_hand_sequence( void );
+uint32_t get_tele_hand_timestamp( void );
 
 int returnMessageAcknowledged( void );
 int returnSeenLifeFromComputer( void );
 int returnDataHasBeenRequested( void );
 int returnTeleOperationHasBeenRequested( void );
+int returnPingHasBeenRequested( void );
+uint32_t getPingHostStamp( void );
+double getPingReceivedTime_us( void );
 
 void clearMessageAcknowledged( void );
 void clearSeenLifeFromComputer( void );
 void clearDataHasBeenRequested( void );
 void clearTeleOperationHasBeenRequested( void );
+void clearPingHasBeenRequested( void );
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,258 @@
+/**
+  ******************************************************************************
+  * @file    haplink_filters.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Position and force filters, see haplink_filters.h.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "haplink_filters.h"
+#include <math.h>
+
+#define FILTER_PI 3.14159265f
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   filterInit
+  * @brief  Sets up a filter of the given type with the default parameters
+  *         from haplink_filters.h.
+  * @param  filter: filter.
+  * @param  type: FILTER_NONE ... FILTER_KALMAN_CV.
+  * @retval None.
+  */
+void filterInit( Filter *filter, int type )
+{
+    switch (type)
+    {
+        case FILTER_EMA:
+            filterInitEma(filter, FILTER_EMA_ALPHA);
+            break;
+        case FILTER_BIQUAD:
+            filterInitBiquad(filter, FILTER_BIQUAD_CUTOFF, FILTER_BIQUAD_RATE);
+            break;
+        case FILTER_ONE_EURO:
+            filterInitOneEuro(filter, FILTER_ONE_EURO_MIN_CUTOFF, FILTER_ONE_EURO_BETA, FILTER_ONE_EURO_D_CUTOFF);
+            break;
+        case FILTER_ALPHA_BETA:
+            filterInitAlphaBeta(filter, FILTER_ALPHA_BETA_ALPHA, FILTER_ALPHA_BETA_BETA);
+            break;
+        case FILTER_KALMAN_CV:
+            filterInitKalmanCv(filter, FILTER_KALMAN_ACCELERATION, FILTER_KALMAN_MEASUREMENT);
+            break;
+        default:
+            filter->type = FILTER_NONE;
+            filterReset(filter);
+            break;
+    }
+}
+
+/*******************************************************************************
+  * @name   filterInitEma
+  * @brief  Exponential moving average, alpha per update whatever the time
+  *         step (what deltaThumbHandler did before).
+  * @param  filter: filter.
+  * @param  alpha: share of the new sample, 0 to 1.
+  * @retval None.
+  */
+void filterInitEma( Filter *filter, float alpha )
+{
+    filter->type = FILTER_EMA;
+    filter->p1 = alpha;
+    filterReset(filter);
+}
+
+/*******************************************************************************
+  * @name   filterInitBiquad
+  * @brief  2nd order Butterworth low pass (bilinear transform). The
+  *         coefficients assume updates at the given rate, dt is ignored.
+  * @param  filter: filter.
+  * @param  cutoff: -3 dB frequency, Hz.
+  * @param  rate: update rate, Hz.
+  * @retval None.
+  */
+void filterInitBiquad( Filter *filter, float cutoff, float rate )
+{
+    float k = tanf(FILTER_PI * cutoff / rate);
+    float norm = 1.0f / (1.0f + 1.41421356f * k + k * k);
+
+    filter->type = FILTER_BIQUAD;
+    filter->b0 = k * k * norm;
+    filter->b1 = 2.0f * filter->b0;
+    filter->b2 = filter->b0;
+    filter->a1 = 2.0f * (k * k - 1.0f) * norm;
+    filter->a2 = (1.0f - 1.41421356f * k + k * k) * norm;
+    filterReset(filter);
+}
+
+/*******************************************************************************
+  * @name   filterInitOneEuro
+  * @brief  One euro filter (Casiez et al. 2012): a first order low pass whose
+  *         cutoff is minCutoff + beta * |speed|, so it smooths when still and
+  *         lags little when moving.
+  * @param  filter: filter.
+  * @param  minCutoff: Hz, cutoff when still.
+  * @param  beta: Hz per unit/s.
+  * @param  dCutoff: Hz, low pass on the speed.
+  * @retval None.
+  */
+void filterInitOneEuro( Filter *filter, float minCutoff, float beta, float dCutoff )
+{
+    filter->type = FILTER_ONE_EURO;
+    filter->p1 = minCutoff;
+    filter->p2 = beta;
+    filter->p3 = dCutoff;
+    filterReset(filter);
+}
+
+/*******************************************************************************
+  * @name   filterInitAlphaBeta
+  * @brief  Alpha beta tracker: predicts with its velocity, corrects position
+  *         by alpha and velocity by beta / dt of the residual.
+  * @param  filter: filter.
+  * @param  alpha, beta: gains, 0 < alpha < 1, 0 < beta < 4 - 2 alpha.
+  * @retval None.
+  */
+void filterInitAlphaBeta( Filter *filter, float alpha, float beta )
+{
+    filter->type = FILTER_ALPHA_BETA;
+    filter->p1 = alpha;
+    filter->p2 = beta;
+    filterReset(filter);
+}
+
+/*******************************************************************************
+  * @name   filterInitKalmanCv
+  * @brief  Constant velocity Kalman filter, white noise acceleration.
+  * @param  filter: filter.
+  * @param  acceleration: process noise spectral density, (units/s^2)^2 * s.
+  * @param  measurement: measurement noise variance, units^2.
+  * @retval None.
+  */
+void filterInitKalmanCv( Filter *filter, float acceleration, float measurement )
+{
+    filter->type = FILTER_KALMAN_CV;
+    filter->p1 = acceleration;
+    filter->p2 = measurement;
+    filterReset(filter);
+}
+
+/*******************************************************************************
+  * @name   filterReset
+  * @brief  Forgets the past, the next sample starts the filter (at rest on
+  *         that value, no start up transient). Parameters are kept.
+  * @param  filter: filter.
+  * @retval None.
+  */
+void filterReset( Filter *filter )
+{
+    filter->hasLast = 0;
+    filter->y = 0.0f;
+    filter->v = 0.0f;
+    filter->last = 0.0f;
+    filter->s1 = 0.0f;
+    filter->s2 = 0.0f;
+    filter->P00 = 0.0f;
+    filter->P01 = 0.0f;
+    filter->P11 = 0.0f;
+}
+
+/* first order low pass factor for a cutoff and a time step */
+static float smoothingFactor( float cutoff, float dt )
+{
+    float r = 2.0f * FILTER_PI * cutoff * dt;
+    return r / (r + 1.0f);
+}
+
+/*******************************************************************************
+  * @name   filterUpdate
+  * @brief  Feeds one sample.
+  * @param  filter: filter.
+  * @param  x: new sample.
+  * @param  dt: seconds since the last sample (unused by FILTER_EMA and
+  *         FILTER_BIQUAD). A sample with dt <= 0 is ignored.
+  * @retval filtered value.
+  */
+float filterUpdate( Filter *filter, float x, float dt )
+{
+    if (filter->type == FILTER_NONE)
+    {
+        return x;
+    }
+    if (!filter->hasLast)
+    {
+        filter->hasLast = 1;
+        filter->y = x;
+        filter->last = x;
+        filter->v = 0.0f;
+        // biquad state for a constant input x (unity DC gain)
+        filter->s2 = (filter->b2 - filter->a2) * x;
+        filter->s1 = (filter->b1 - filter->a1) * x + filter->s2;
+        filter->P00 = filter->p2;
+        filter->P01 = 0.0f;
+        filter->P11 = 0.0f;
+        return x;
+    }
+    if (!(dt > 0.0f) && filter->type != FILTER_EMA && filter->type != FILTER_BIQUAD)
+    {
+        return filter->y;
+    }
+
+    switch (filter->type)
+    {
+        case FILTER_EMA:
+            filter->y += filter->p1 * (x - filter->y);
+            break;
+
+        case FILTER_BIQUAD:
+            // transposed direct form II
+            filter->y = filter->b0 * x + filter->s1;
+            filter->s1 = filter->b1 * x - filter->a1 * filter->y + filter->s2;
+            filter->s2 = filter->b2 * x - filter->a2 * filter->y;
+            break;
+
+        case FILTER_ONE_EURO:
+        {
+            float speed = (x - filter->last) / dt;
+            filter->last = x;
+            filter->v += smoothingFactor(filter->p3, dt) * (speed - filter->v);
+            float cutoff = filter->p1 + filter->p2 * fabsf(filter->v);
+            filter->y += smoothingFactor(cutoff, dt) * (x - filter->y);
+            break;
+        }
+
+        case FILTER_ALPHA_BETA:
+        {
+            float predicted = filter->y + filter->v * dt;
+            float residual = x - predicted;
+            filter->y = predicted + filter->p1 * residual;
+            filter->v += filter->p2 * residual / dt;
+            break;
+        }
+
+        case FILTER_KALMAN_CV:
+        {
+            // predict: F = [1 dt; 0 1], Q = q [dt^3/3 dt^2/2; dt^2/2 dt]
+            float q = filter->p1;
+            float P00 = filter->P00 + dt * (2.0f * filter->P01 + dt * filter->P11) + q * dt * dt * dt / 3.0f;
+            float P01 = filter->P01 + dt * filter->P11 + q * dt * dt / 2.0f;
+            float P11 = filter->P11 + q * dt;
+            float predicted = filter->y + filter->v * dt;
+            // update with H = [1 0]
+            float S = P00 + filter->p2;
+            float k0 = P00 / S, k1 = P01 / S;
+            float residual = x - predicted;
+            filter->y = predicted + k0 * residual;
+            filter->v += k1 * residual;
+            filter->P00 = (1.0f - k0) * P00;
+            filter->P01 = (1.0f - k0) * P01;
+            filter->P11 = P11 - k1 * P01;
+            break;
+        }
+    }
+    return filter->y;
+}
+//EOF
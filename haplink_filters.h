@@ -0,0 +1,72 @@
+/**
+  ******************************************************************************
+  * @file    haplink_filters.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Small filters for positions and forces. Every filter is a fixed
+  *          size struct updated in O(1) with floats, one Filter per signal.
+  *          Which filter a signal uses is picked in main.h, the parameters
+  *          below are the defaults filterInit uses (the filterInitXxx
+  *          functions take them explicitly). Times in seconds, cutoffs in Hz.
+  *          Only needs math.h, tools/report_filters.c runs them on
+  *          recorded data.
+  ******************************************************************************
+  */
+#ifndef __HAPLINK_FILTERS_H_
+#define __HAPLINK_FILTERS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+// Filter types
+#define FILTER_NONE         0
+#define FILTER_EMA          1   // y += alpha (x - y) every update, the old thumb smoothing
+#define FILTER_BIQUAD       2   // 2nd order Butterworth low pass, designed for a fixed rate
+#define FILTER_ONE_EURO     3   // low pass whose cutoff rises with speed
+#define FILTER_ALPHA_BETA   4   // position + velocity tracker, fixed gains
+#define FILTER_KALMAN_CV    5   // constant velocity Kalman filter
+
+// Defaults
+#define FILTER_EMA_ALPHA                0.4f
+#define FILTER_BIQUAD_CUTOFF            60.0f   // Hz
+#define FILTER_BIQUAD_RATE              1000.0f // Hz, rate the biquad assumes
+#define FILTER_ONE_EURO_MIN_CUTOFF      10.0f   // Hz, when still
+#define FILTER_ONE_EURO_BETA            2.0f    // Hz of cutoff per unit/s of speed
+#define FILTER_ONE_EURO_D_CUTOFF        1.0f    // Hz, speed estimate
+#define FILTER_ALPHA_BETA_ALPHA         0.1f
+#define FILTER_ALPHA_BETA_BETA          0.03f
+#define FILTER_KALMAN_ACCELERATION      20000.0f    // process noise, (units/s^2)^2 * s
+#define FILTER_KALMAN_MEASUREMENT       0.0025f     // measurement variance, units^2
+
+typedef struct {
+    int type;
+    int hasLast;
+    float y;            // output
+    float v;            // velocity estimate (one euro, alpha beta, Kalman)
+    float last;         // last input (one euro)
+    // parameters, meaning depends on type
+    float p1, p2, p3;
+    // biquad coefficients and state, Kalman covariance
+    float b0, b1, b2, a1, a2;
+    float s1, s2;
+    float P00, P01, P11;
+} Filter;
+
+/******* Function prototypes ****/
+void filterInit( Filter *filter, int type );
+void filterInitEma( Filter *filter, float alpha );
+void filterInitBiquad( Filter *filter, float cutoff, float rate );
+void filterInitOneEuro( Filter *filter, float minCutoff, float beta, float dCutoff );
+void filterInitAlphaBeta( Filter *filter, float alpha, float beta );
+void filterInitKalmanCv( Filter *filter, float acceleration, float measurement );
+void filterReset( Filter *filter );
+float filterUpdate( Filter *filter, float x, float dt );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAPLINK_FILTERS_H_
+//EOF
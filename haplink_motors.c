@@ -797,4 +797,25 @@ void outputTorqueMotor7(double torque)
     duty = torque * 65.13; // replace the 65.13 with value for specific motor
     dutyPrint7 = duty;
     updateDutyCycle7(duty);
-}
\ No newline at end of file
+}
+
+/*******************************************************************************
+ * @name   outputTorqueMotor
+ * @brief  Outputs a torque on a motor picked by number (for the limb table).
+ * @param  int motor: MOTOR_1 ... MOTOR_7.
+ * @param  double torque: the torque output desired in Nm.
+ * @retval None.
+ */
+void outputTorqueMotor(int motor, double torque)
+{
+    switch (motor)
+    {
+        case MOTOR_1: outputTorqueMotor1(torque); break;
+        case MOTOR_2: outputTorqueMotor2(torque); break;
+        case MOTOR_3: outputTorqueMotor3(torque); break;
+        case MOTOR_4: outputTorqueMotor4(torque); break;
+        case MOTOR_5: outputTorqueMotor5(torque); break;
+        case MOTOR_6: outputTorqueMotor6(torque); break;
+        case MOTOR_7: outputTorqueMotor7(torque); break;
+    }
+}
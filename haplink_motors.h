@@ -72,6 +72,7 @@ extern "C"
   void outputTorqueMotor5(double torque);
   void outputTorqueMotor6(double torque);
   void outputTorqueMotor7(double torque);
+  void outputTorqueMotor(int motor, double torque);
 
 #ifdef __cplusplus
 }
@@ -11,10 +11,12 @@
 #include "haplink_position.h"
 #include "haplink_time.h"
 #include "haplink_encoders.h"
+#include "haplink_motors.h"
 #include "stdlib.h"
 #include <math.h>
 #include <debug_mort.h>
 #include "delta_thumb.h"
+#include "hand_limbs.h"
 
 /* Global Variables ----------------------------------------------------------*/
 
@@ -35,18 +37,6 @@ double theta_b;
 double theta_ma;
 double theta_mb;
 
-// angles of finger 1 device
-double theta_a1;
-double theta_b1;
-double theta_ma1;
-double theta_mb1;
-
-//angles of finger 2 device
-double theta_a2;
-double theta_b2;
-double theta_ma2;
-double theta_mb2;
-
 
 double b1, b2;
 
@@ -66,18 +56,8 @@ double ry, dy, ry_prev, dy_prev;
 double t0_pos, t1_pos,time_dif;
 double xH, dxH, xH_prev, dxH_prev; //position of the hapkit handle
 
-// position of finger 1 vars
-double rx1, dx1, rx1_prev, dx1_prev;
-double ry1, dy1, ry1_prev, dy1_prev;
-
-// position of finger 2 vars
-double rx2, dx2, rx2_prev, dx2_prev;
-double ry2, dy2, ry2_prev, dy2_prev;
-
 // Jacobian variables:
 double J00, J01, J10, J11;
-double J00_f1, J01_f1, J10_f1, J11_f1;
-double J00_f2, J01_f2, J10_f2, J11_f2;
 
 //debug variables:
 int debugcounter = 0;
@@ -107,47 +87,16 @@ int initHapticHand( void )
     dxH = 0;
     dxH_prev = 0;
 
-    // finger 1 vars
-    rx1 = 0;
-    ry1 = 0;
-    rx1_prev = 0;
-    ry1_prev = 0;
-    dx1 = 0;
-    dy1 = 0;
-    dx1_prev = 0;
-    dy1_prev = 0;
-
-    // finger 2 vars
-    rx2 = 0;
-    ry2 = 0;
-    rx2_prev = 0;
-    ry2_prev = 0;
-    dx2 = 0;
-    dy2 = 0;
-    dx2_prev = 0;
-    dy2_prev = 0;
-    
     J00 = 0;
     J01 = 0;
     J10 = 0;
     J11 = 0;
 
-    J00_f1 = 0;
-    J01_f1 = 0;
-    J10_f1 = 0;
-    J11_f1 = 0;
-
-    J00_f2 = 0;
-    J01_f2 = 0;
-    J10_f2 = 0;
-    J11_f2 = 0;
-
     //initialize encoders
     initHapticHandEncodersMotors();
     
     //initPositionHandleAndJacobian( ); // default, two motors from class
-    initPositionAndJacobianFinger1( ); 
-    initPositionAndJacobianFinger2( );   
+    initHandLimbs();    // fingers, see hand_limbs.h
 
     initDeltaThumb();
     
@@ -183,16 +132,6 @@ int initHaplinkPosition( void )
     J10 = 0;
     J11 = 0;
 
-    J00_f1 = 0;
-    J01_f1 = 0;
-    J10_f1 = 0;
-    J11_f1 = 0;
-
-    J00_f2 = 0;
-    J01_f2 = 0;
-    J10_f2 = 0;
-    J11_f2 = 0;
-
     //initialize encoders
     // initHaplinkEncoders2Motors();
     //wait_ms(200); //wait to settle timers
@@ -300,6 +239,26 @@ double calculatePositionMotor7( void )
     return theta_m7;
 }
 
+/*******************************************************************************
+  * @name   calculatePositionMotor
+  * @brief  Rotation of a motor picked by number (for the limb table).
+  * @param  motor: MOTOR_1 ... MOTOR_7.
+  * @retval the current rotation of that motor in radians, 0 if there is none.
+  */
+double calculatePositionMotor( int motor )
+{
+    switch (motor) {
+        case MOTOR_1: return calculatePositionMotor1();
+        case MOTOR_2: return calculatePositionMotor2();
+        case MOTOR_3: return calculatePositionMotor3();
+        case MOTOR_4: return calculatePositionMotor4();
+        case MOTOR_5: return calculatePositionMotor5();
+        case MOTOR_6: return calculatePositionMotor6();
+        case MOTOR_7: return calculatePositionMotor7();
+    }
+    return 0.0;
+}
+
 
 
 /*******************************************************************************
@@ -395,96 +354,6 @@ void initPositionHandleAndJacobian( void )
     
 }
 
-/*******************************************************************************
-
-  * @name   initPositionAndJacobianFinger1
-  * @brief  initializes the 2DOF position variables of Haplink - finger 1 (motors 4 and 5)
-  * @param  None.
-  * @retval None.
-  */
-void initPositionAndJacobianFinger1( void )
-{
-    double tildetheta_a = 0;
-    double tildetheta_b = 0;
-    double px = 0;
-    double py = 0;
-    
-    // Compute the angle of the paddles in radians
-    theta_ma1 = calculatePositionMotor4();
-    theta_mb1 = calculatePositionMotor5();
-    
-     /*Add code here:***********************************************************/
-    /* Uncomment and fill the variables theta_a, tehta_b (the rotation of paddle's a and b in radians)
-    and rx and ry */
-    /*Add code here:***********************************************************/
-    
-    // Compute the angle of the paddles in radians
-    theta_a1 = -R_MA/R_A*theta_ma1 + THETA_A_OFFSET_RAD; //some ratio of radiuses and theta_ma + the initial offset.
-    theta_b1 =  -R_MA/R_A*theta_mb1 +(R_MB/R_B)*theta_a1 + THETA_B_OFFSET_RAD;
-  
-    // Compute px and py 
-    tildetheta_a = theta_a1 + DELTATHETA_A_1; 
-    px = -L_A*sin(tildetheta_a) + CX;
-    py = L_A*cos(tildetheta_a) + CY ;
-
-    //Compute rx and ry in frame n
-    tildetheta_b = theta_b1 + DELTATHETA_B_1; 
-    rx1 =  -L_B*sin(tildetheta_a+tildetheta_b) + px;
-    ry1 =  -L_B*cos(tildetheta_a + tildetheta_b) + py;
-    
-    /**************************************************************************/
-    
-    rx1_prev =  rx1;
-    ry1_prev =  ry1;
-    t0_pos = getTime_ms();
-    
-}
-
-
-/*******************************************************************************
-  * @name   initPositionAndJacobianFinger2
-  * @brief  initializes the 2DOF position variables of Haplink
-  * @param  None.
-  * @retval None.
-  */
-void initPositionAndJacobianFinger2( void )
-{
-    double tildetheta_a = 0;
-    double tildetheta_b = 0;
-    double px = 0;
-    double py = 0;
-    
-    // Compute the angle of the paddles in radians
-    theta_ma2 = -calculatePositionMotor6();
-    theta_mb2 = -calculatePositionMotor7();
-    
-     /*Add code here:***********************************************************/
-    /* Uncomment and fill the variables theta_a, tehta_b (the rotation of paddle's a and b in radians)
-    and rx and ry */
-    /*Add code here:***********************************************************/
-    
-    // Compute the angle of the paddles in radians
-    theta_a2 = -R_MA/R_A*theta_ma2 + THETA_A_OFFSET_RAD; //some ratio of radiuses and theta_ma + the initial offset.
-    theta_b2 =  -R_MA/R_A*theta_mb2 +(R_MB/R_B)*theta_a2 + THETA_B_OFFSET_RAD;
-  
-    // Compute px and py 
-    tildetheta_a = theta_a2 + DELTATHETA_A_2; 
-    px = -L_A*sin(tildetheta_a) + CX;
-    py = L_A*cos(tildetheta_a) + CY ;
-
-    //Compute rx and ry in frame n
-    tildetheta_b = theta_b2 + DELTATHETA_B_2; 
-    rx2 =  -L_B*sin(tildetheta_a+tildetheta_b) + px;
-    ry2 =  -L_B*cos(tildetheta_a + tildetheta_b) + py;
-    
-    /**************************************************************************/
-    
-    rx2_prev =  rx2;
-    ry2_prev =  ry2;
-    t0_pos = getTime_ms();
-    
-}
-
 /*******************************************************************************
   * @name   calculatePositionHandleAndJacobian
   * @brief  calculates the 2DOF position variables of Haplink in mm.
@@ -534,104 +403,6 @@ void calculatePositionHandleAndJacobian( void )
     t1_pos = getTime_ms();
 }
 
-/*******************************************************************************
-  * @name   calculatePositionAndJacobianFinger1
-  * @brief  calculates the 2DOF position variables of Haplink in mm.
-  * @param  None.
-  * @retval None.
-  */
-void calculatePositionAndJacobianFinger1( void )
-{
-    static int velocityCounter = 0;
-    double tildetheta_a = 0;
-    double tildetheta_b = 0;
-    double px = 0;
-    double py = 0;
-    
-    
-    // Compute the angle of the paddles in radians
-    //motor angles:
-    theta_ma1 = calculatePositionMotor4();
-    theta_mb1 = calculatePositionMotor5();
-    /* Uncomment and fill the variables theta_a, tehta_b (the rotation of paddle's a and b in radians)
-    and rx and ry, as well as the velocity variables dx and dy */
-    /*Add code here:***********************************************************/
-    
-    // Compute the angle of the paddles in radians
-    theta_a1 = -R_MA/R_A*theta_ma1 + THETA_A_OFFSET_RAD; //some ratio of radiuses and theta_ma + the initial offset.
-    theta_b1 =  -R_MA/R_A*theta_mb1 +(R_MB/R_B)*theta_a1 + THETA_B_OFFSET_RAD;
-    
-  
-    // Compute px and py 
-    tildetheta_a = theta_a1 + DELTATHETA_A_1; 
-    px = -L_A*sin(tildetheta_a) + CX;
-    py = L_A*cos(tildetheta_a) + CY ;
-
-    //Compute rx and ry in n
-    tildetheta_b = theta_b1 + DELTATHETA_B_1; 
-    rx1 =  -L_B*sin(tildetheta_a+tildetheta_b) + px;
-    ry1 =  L_B*cos(tildetheta_a + tildetheta_b) + py;
-    
-    //build the Jacobian
-    J00_f1 = -L_B*cos(tildetheta_a + tildetheta_b)-L_A*cos(tildetheta_a);
-    J01_f1 = -L_B*cos(tildetheta_a + tildetheta_b);
-    J10_f1 = -L_B*sin(tildetheta_a + tildetheta_b) - L_A*sin(tildetheta_a);   
-    J11_f1 = -L_B*sin(tildetheta_a + tildetheta_b);  
-    
-    //for dx and dy decide on your method and implement it, don't forget to reset
-    //the velocity counter if that is what you are using and update t0_pos.
-    t1_pos = getTime_ms();
-}
-
-/*******************************************************************************
-  * @name   calculatePositionAndJacobianFinger2
-  * @brief  calculates the 2DOF position variables of Haplink in mm.
-  * @param  None.
-  * @retval None.
-  */
-void calculatePositionAndJacobianFinger2( void )
-{
-    static int velocityCounter = 0;
-    double tildetheta_a = 0;
-    double tildetheta_b = 0;
-    double px = 0;
-    double py = 0;
-    
-    // Compute the angle of the paddles in radians
-    //motor angles:
-    theta_ma2 = -calculatePositionMotor6();
-    theta_mb2 = -calculatePositionMotor7();
-    /* Uncomment and fill the variables theta_a, theta_b (the rotation of paddle's a and b in radians)
-    and rx and ry, as well as the velocity variables dx and dy */
-    /*Add code here:***********************************************************/
-    
-    // Compute the angle of the paddles in radians
-    theta_a2 = -R_MA/R_A*theta_ma2 + THETA_A_OFFSET_RAD; //some ratio of radiuses and theta_ma + the initial offset.
-    theta_b2 =  -R_MA/R_A*theta_mb2 +(R_MB/R_B)*theta_a2 + THETA_B_OFFSET_RAD;
-    
-  
-    // Compute px and py 
-    tildetheta_a = theta_a2 + DELTATHETA_A_2; 
-    px = -L_A*sin(tildetheta_a) + CX;
-    py = L_A*cos(tildetheta_a) + CY ;
-
-    //Compute rx and ry in n
-    tildetheta_b = theta_b2 + DELTATHETA_B_2; 
-    rx2 =  -L_B*sin(tildetheta_a+tildetheta_b) + px;
-    ry2 =  L_B*cos(tildetheta_a + tildetheta_b) + py;
-    
-    //build the Jacobian
-    J00_f2 = -L_B*cos(tildetheta_a + tildetheta_b)-L_A*cos(tildetheta_a);
-    J01_f2 = -L_B*cos(tildetheta_a + tildetheta_b);
-    J10_f2 = -L_B*sin(tildetheta_a + tildetheta_b) - L_A*sin(tildetheta_a);   
-    J11_f2 = -L_B*sin(tildetheta_a + tildetheta_b);  
-    
-    //for dx and dy decide on your method and implement it, don't forget to reset
-    //the velocity counter if that is what you are using and update t0_pos.
-    t1_pos = getTime_ms();
-}
-
-
 /*--Functions to Access the various position variables------------------------*/
 
 double getRx( void )
@@ -648,21 +419,21 @@ double getRy( void )
 
 double getRx1( void )
 {
-    return rx1;
+    return handLimbState.rx[HAND_FINGER_1];
 }
 
 double getRy1( void )
 { 
-    return ry1;
+    return handLimbState.ry[HAND_FINGER_1];
 }
 double getRx2( void )
 {
-    return rx2;
+    return handLimbState.rx[HAND_FINGER_2];
 }
 
 double getRy2( void )
 { 
-    return ry2;
+    return handLimbState.ry[HAND_FINGER_2];
 }
 //
 
@@ -686,21 +457,21 @@ double getThetaBDeg( void )
 // Finger 1
 double getThetaA1_deg( void )
 {
-    return theta_a1*180/3.1416;
+    return handLimbState.thetaA[HAND_FINGER_1]*180/3.1416;
 }
 double getThetaB1_deg( void )
 {
-    return theta_b1*180/3.1416;
+    return handLimbState.thetaB[HAND_FINGER_1]*180/3.1416;
 }
 
 // Finger 2
 double getThetaA2_deg( void )
 {
-    return theta_a2*180/3.1416;
+    return handLimbState.thetaA[HAND_FINGER_2]*180/3.1416;
 }
 double getThetaB2_deg( void )
 {
-    return theta_b2*180/3.1416;
+    return handLimbState.thetaB[HAND_FINGER_2]*180/3.1416;
 }
 
 double getXH( void )
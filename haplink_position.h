@@ -30,6 +30,7 @@
 #define R_HA                    59.0      // radius of Handle A for Hapkit in mm
 #define R_MA                    5.5       // radius of Motor a in mm
 #define R_MB                    5.5       // radius of Motor b in mm
+// per finger offsets, used through the limb table in hand_limbs.c
 #define DELTATHETA_A_1            1.5708  //theta a offset in rad (-90deg)
 #define DELTATHETA_B_1            -1.10935    //theta b offset in rad (63deg)
 
@@ -51,17 +52,12 @@ double calculatePositionMotor4( void );
 double calculatePositionMotor5( void );
 double calculatePositionMotor6( void );
 double calculatePositionMotor7( void );
+double calculatePositionMotor( int motor );
 
 void calculatePosition1DOF( void );
 void initPositionHandleAndJacobian( void );
 void calculatePositionHandleAndJacobian( void );
 
-// finger funcs
-void initPositionAndJacobianFinger1( void );
-void calculatePositionAndJacobianFinger1( void );
-void initPositionAndJacobianFinger2( void );
-void calculatePositionAndJacobianFinger2( void );
-
 
 double getRx( void );
 double getRy( void) ;
@@ -0,0 +1,204 @@
+/**
+  ******************************************************************************
+  * @file    haplink_receive.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Receive queue of whole messages (see haplink_receive.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "haplink_receive.h"
+#include "haplink_telemetry.h"
+#include <stddef.h>
+
+/* Global Variables ----------------------------------------------------------*/
+static RxMessage rxQueue[RX_QUEUE_SIZE];
+static volatile uint8_t rxQueueHead = 0;    // only written by the RX interrupt
+static volatile uint8_t rxQueueTail = 0;    // only written by the main loop
+static volatile uint32_t rxQueueDropped = 0;
+
+//message being received into rxQueue[rxQueueHead]
+#define RX_IDLE             0
+#define RX_FRAME            1
+#define RX_TEXT             2
+static int rxState = RX_IDLE;
+static int rxIndex = 0;
+static int rxLength = 0;                    // frame or 'p' length, 0 for text up to the 'l'
+static int rxTeleopTextLength = 4;
+static double (*rxClock_us)( void ) = NULL;
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   receiveInit
+  * @brief  Empties the queue.
+  * @param  teleopTextLength: length of a 'p' message with its terminating
+  *         character (it depends on DOF_2).
+  * @param  clock_us: read once per message, at its first byte, NULL for none.
+  * @retval None.
+  */
+void receiveInit( int teleopTextLength, double (*clock_us)( void ) )
+{
+    rxQueueHead = 0;
+    rxQueueTail = 0;
+    rxQueueDropped = 0;
+    rxState = RX_IDLE;
+    rxIndex = 0;
+    rxLength = 0;
+    rxTeleopTextLength = teleopTextLength;
+    rxClock_us = clock_us;
+}
+
+/*******************************************************************************
+  * @name   publishMessage
+  * @brief  The message at the head is complete, hands it to the loop.
+  * @param  size: bytes kept.
+  * @retval None.
+  */
+static void publishMessage( int size )
+{
+    uint8_t next = (rxQueueHead + 1) & (RX_QUEUE_SIZE - 1);
+
+    rxState = RX_IDLE;
+    if (next == rxQueueTail)
+    {
+        rxQueueDropped = rxQueueDropped + 1; //full, the slot is received into again
+        return;
+    }
+    rxQueue[rxQueueHead].size = size;
+    rxQueueHead = next;
+}
+
+/*******************************************************************************
+  * @name   receiveByte
+  * @brief  One received byte, RX interrupt only. Never waits. The first
+  *         byte of a message decides its kind: a sync byte starts a binary
+  *         frame, taken by its length (the payload can hold any byte,
+  *         'l' too), anything else starts a text message.
+  * @param  c: the byte.
+  * @retval None.
+  */
+void receiveByte( uint8_t c )
+{
+    RxMessage * message = &rxQueue[rxQueueHead];
+    const int room = (int)sizeof(message->data);
+
+    if (rxState == RX_IDLE)
+    {
+        message->received_us = (rxClock_us != NULL) ? rxClock_us() : 0.0;
+        rxIndex = 0;
+        if (c == TELEMETRY_FRAME_SYNC)
+        {
+            rxState = RX_FRAME;
+            rxLength = 0;
+        }
+        else
+        {
+            rxState = RX_TEXT;
+            rxLength = (c == 'p') ? rxTeleopTextLength : 0; //position from teleoperation
+        }
+    }
+
+    if (rxState == RX_FRAME)
+    {
+        if (rxIndex < room)
+        {
+            message->data[rxIndex] = c;
+        }
+        rxIndex = rxIndex + 1;
+        if (rxIndex == 3)
+        {
+            rxLength = 3 + c + 1; //header, payload and crc
+        }
+        if ((rxIndex < 4) || (rxIndex < rxLength))
+        {
+            return;
+        }
+        if (rxLength > room)
+        {
+            message->data[1] = 0; //too long for us, decodeMessage will drop it
+        }
+        publishMessage((rxLength < room) ? rxLength : room);
+    }
+    else if (rxLength > 0) //'p': the digits, then a terminating character that is not kept
+    {
+        if (rxIndex < rxLength - 1)
+        {
+            message->data[rxIndex] = c;
+        }
+        rxIndex = rxIndex + 1;
+        if (rxIndex == rxLength)
+        {
+            publishMessage(rxLength - 1);
+        }
+    }
+    else if (c != 'l')
+    {
+        if (rxIndex < room - 1)
+        {
+            message->data[rxIndex] = c;
+            rxIndex = rxIndex + 1;
+        }
+    }
+    else
+    {
+        message->data[rxIndex] = 0; //terminate so text messages can be parsed
+        publishMessage(rxIndex + 1);
+    }
+}
+
+/*******************************************************************************
+  * @name   receiveCount
+  * @brief  Whole messages waiting.
+  * @param  None.
+  * @retval number of messages.
+  */
+int receiveCount( void )
+{
+    return (rxQueueHead - rxQueueTail) & (RX_QUEUE_SIZE - 1);
+}
+
+/*******************************************************************************
+  * @name   receivePeek
+  * @brief  Oldest waiting message, main loop only. It stays valid, and the
+  *         interrupt keeps off it, until receiveRelease.
+  * @param  None.
+  * @retval the message, NULL if there is none.
+  */
+RxMessage * receivePeek( void )
+{
+    if (rxQueueTail == rxQueueHead)
+    {
+        return NULL;
+    }
+    return &rxQueue[rxQueueTail];
+}
+
+/*******************************************************************************
+  * @name   receiveRelease
+  * @brief  Done with the message of receivePeek, its slot goes back to the
+  *         interrupt.
+  * @param  None.
+  * @retval None.
+  */
+void receiveRelease( void )
+{
+    if (rxQueueTail != rxQueueHead)
+    {
+        rxQueueTail = (rxQueueTail + 1) & (RX_QUEUE_SIZE - 1);
+    }
+}
+
+/*******************************************************************************
+  * @name   receiveDropped
+  * @brief  Messages dropped because the queue was full.
+  * @param  None.
+  * @retval count since receiveInit.
+  */
+uint32_t receiveDropped( void )
+{
+    return rxQueueDropped;
+}
+//EOF
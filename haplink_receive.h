@@ -0,0 +1,66 @@
+/**
+  ******************************************************************************
+  * @file    haplink_receive.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Receive queue between the RX interrupt and the main loop. The
+  *          interrupt hands every byte to receiveByte, which splits the
+  *          messages and receives each one straight into the free slot at
+  *          the head of a ring of RX_QUEUE_SIZE whole messages; the head
+  *          only moves on once the message is complete:
+  *           - binary frames ([SYNC][type][len][payload][crc8],
+  *             haplink_telemetry.h), by their length;
+  *           - 'p' teleoperation positions, by the length given to
+  *             receiveInit, the terminating character is not kept;
+  *           - any other text ('r', 'k', 'g', ...) up to the 'l', which is
+  *             replaced by a 0 so it can be parsed.
+  *          The main loop takes them oldest first (receivePeek,
+  *          receiveRelease), so a message that completes while the loop is
+  *          still decoding another one, or several that complete before it
+  *          polls, are all kept. One writer per index: the head is the
+  *          interrupt's, the tail the loop's. A message that finds the ring
+  *          full is dropped and counted. Each message keeps the time its
+  *          first byte arrived, so a ping is answered with its own arrival
+  *          time however long it waited in the queue.
+  *          Only needs the frame sizes, see tools/sim_receive_queue.c.
+  ******************************************************************************
+  */
+#ifndef __HAPLINK_RECEIVE_H_
+#define __HAPLINK_RECEIVE_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+#include "hand_host_models.h"
+#include "hand_motion.h"
+
+// largest frame taken: the host contact models or the object keyframes (the
+// hand teleoperation frame, haplink_communication.h, is smaller), and some room
+#define RX_MESSAGE_SIZE     (((HOST_MODELS_MAX_FRAME_SIZE > MOTION_MAX_FRAME_SIZE) ? \
+                              HOST_MODELS_MAX_FRAME_SIZE : MOTION_MAX_FRAME_SIZE) + 4)
+#define RX_QUEUE_SIZE       8       // frames, must be a power of two
+
+typedef struct {
+    uint8_t data[RX_MESSAGE_SIZE];  // from the sync byte or the text character, a frame
+                                    // too long for us has type 0, long text is cut
+    int size;                       // bytes kept
+    double received_us;             // clock of receiveInit at the first byte
+} RxMessage;
+
+/******* Function prototypes ****/
+void receiveInit( int teleopTextLength, double (*clock_us)( void ) );
+void receiveByte( uint8_t c );
+int receiveCount( void );
+RxMessage * receivePeek( void );
+void receiveRelease( void );
+uint32_t receiveDropped( void );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAPLINK_RECEIVE_H_
+//EOF
@@ -0,0 +1,212 @@
+/**
+  ******************************************************************************
+  * @file    haplink_telemetry.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Encoder for the delta-encoded hand telemetry stream. Only the
+  *          fields that changed since the last frame are sent, the static
+  *          ones (finger plane z, sphere) cost nothing after the keyframe.
+  *          The host side decoder lives in ProcessingHapticsHand/TelemetryDecoder.pde
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "haplink_telemetry.h"
+#include <math.h>
+
+/* Global Variables ----------------------------------------------------------*/
+static int32_t telemetryLastValues[TELEMETRY_NUM_FIELDS]; // last quantized values the host has
+static uint8_t telemetrySequence = 0;
+static uint16_t framesSinceKeyframe = 0;
+static uint8_t keyframeRequested = 1; // the first frame is always a keyframe
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   initHaplinkTelemetry
+  * @brief  Resets the encoder so the next frame sent is a keyframe.
+  * @param  None.
+  * @retval None.
+  */
+void initHaplinkTelemetry( void )
+{
+    int i;
+    for (i = 0; i < TELEMETRY_NUM_FIELDS; i++)
+    {
+        telemetryLastValues[i] = 0;
+    }
+    telemetrySequence = 0;
+    framesSinceKeyframe = 0;
+    keyframeRequested = 1;
+}
+
+/*******************************************************************************
+  * @name   requestTelemetryKeyframe
+  * @brief  Forces the next frame to be a keyframe. Called when the host lost
+  *         a frame (sequence gap or bad crc) and asks to resynchronize.
+  * @param  None.
+  * @retval None.
+  */
+void requestTelemetryKeyframe( void )
+{
+    keyframeRequested = 1;
+}
+
+/*******************************************************************************
+  * @name   packTelemetryFrame
+  * @brief  Quantizes the hand fields and packs either a keyframe or a delta
+  *         frame with only the fields that changed.
+  * @param  fields: TELEMETRY_NUM_FIELDS values in mm.
+  * @param  buffer_to_pack: at least TELEMETRY_MAX_FRAME_SIZE bytes.
+  * @retval number of bytes to send.
+  */
+int packTelemetryFrame( const float * fields, uint8_t * buffer_to_pack )
+{
+    int32_t quantized;
+    uint16_t mask = 0;
+    uint8_t * payload = &buffer_to_pack[3];
+    int n = 0;
+    int i;
+
+    payload[n++] = telemetrySequence;
+
+    if (keyframeRequested || (framesSinceKeyframe >= TELEMETRY_KEYFRAME_INTERVAL))
+    {
+        for (i = 0; i < TELEMETRY_NUM_FIELDS; i++)
+        {
+            quantized = (int32_t)lrintf(fields[i] * TELEMETRY_SCALE);
+            n += telemetryPutVarint(telemetryZigzag(quantized), &payload[n]);
+            telemetryLastValues[i] = quantized;
+        }
+        keyframeRequested = 0;
+        framesSinceKeyframe = 0;
+        telemetrySequence++;
+        return telemetryFinishFrame(buffer_to_pack, TELEMETRY_TYPE_KEYFRAME, n);
+    }
+
+    n += 2; // room for the mask, filled in once we know it
+    for (i = 0; i < TELEMETRY_NUM_FIELDS; i++)
+    {
+        quantized = (int32_t)lrintf(fields[i] * TELEMETRY_SCALE);
+        if (quantized != telemetryLastValues[i])
+        {
+            mask |= (uint16_t)(1u << i);
+            n += telemetryPutVarint(telemetryZigzag(quantized - telemetryLastValues[i]), &payload[n]);
+            telemetryLastValues[i] = quantized;
+        }
+    }
+    payload[1] = mask & 0xFF;   //store lsb first
+    payload[2] = mask >> 8;     //store msb second
+
+    framesSinceKeyframe++;
+    telemetrySequence++;
+    return telemetryFinishFrame(buffer_to_pack, TELEMETRY_TYPE_DELTA, n);
+}
+
+/*******************************************************************************
+  * @name   putUint32
+  * @brief  Writes a uint32 little endian.
+  * @param  value: value to write.
+  * @param  buffer: destination, 4 bytes.
+  * @retval None.
+  */
+static void putUint32( uint32_t value, uint8_t * buffer )
+{
+    buffer[0] = value & 0xFF;
+    buffer[1] = (value >> 8) & 0xFF;
+    buffer[2] = (value >> 16) & 0xFF;
+    buffer[3] = value >> 24;
+}
+
+/*******************************************************************************
+  * @name   packPingReplyFrame
+  * @brief  Packs the answer to a ping ('g' message). The host stamp is echoed
+  *         untouched, the device times come from the timebase (getTime32_us)
+  *         and wrap at 2^32 us (~71 minutes), the host unwraps them.
+  * @param  host_stamp: value the host sent in the ping.
+  * @param  device_rx_us: when the ping arrived.
+  * @param  device_tx_us: when the reply was queued.
+  * @param  buffer_to_pack: at least TELEMETRY_PING_REPLY_SIZE bytes.
+  * @retval number of bytes in the frame.
+  */
+int packPingReplyFrame( uint32_t host_stamp, uint32_t device_rx_us, uint32_t device_tx_us, uint8_t * buffer_to_pack )
+{
+    putUint32(host_stamp, &buffer_to_pack[3]);
+    putUint32(device_rx_us, &buffer_to_pack[7]);
+    putUint32(device_tx_us, &buffer_to_pack[11]);
+    return telemetryFinishFrame(buffer_to_pack, TELEMETRY_TYPE_PING_REPLY, 12);
+}
+
+/*******************************************************************************
+  * @name   telemetryFinishFrame
+  * @brief  Writes the sync, type and length header in front of a payload that
+  *         was already packed at frame[3] and appends the crc.
+  * @param  frame: buffer holding the payload at offset 3.
+  * @param  type: frame type character.
+  * @param  payload_length: number of payload bytes (<= 255).
+  * @retval total number of bytes in the frame.
+  */
+int telemetryFinishFrame( uint8_t * frame, uint8_t type, int payload_length )
+{
+    frame[0] = TELEMETRY_FRAME_SYNC;
+    frame[1] = type;
+    frame[2] = (uint8_t)payload_length;
+    frame[3 + payload_length] = telemetryCrc8(&frame[1], payload_length + 2);
+    return payload_length + TELEMETRY_FRAME_OVERHEAD;
+}
+
+/*******************************************************************************
+  * @name   telemetryCrc8
+  * @brief  CRC-8 with polynomial 0x07, initial value 0.
+  * @param  data: bytes to check.
+  * @param  length: number of bytes.
+  * @retval crc.
+  */
+uint8_t telemetryCrc8( const uint8_t * data, int length )
+{
+    uint8_t crc = 0;
+    int i, bit;
+    for (i = 0; i < length; i++)
+    {
+        crc ^= data[i];
+        for (bit = 0; bit < 8; bit++)
+        {
+            crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+        }
+    }
+    return crc;
+}
+
+/*******************************************************************************
+  * @name   telemetryZigzag
+  * @brief  Maps signed values to unsigned so small magnitudes stay small:
+  *         0, -1, 1, -2, 2 ... -> 0, 1, 2, 3, 4 ...
+  * @param  value: signed value.
+  * @retval zigzag encoded value.
+  */
+uint32_t telemetryZigzag( int32_t value )
+{
+    return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+/*******************************************************************************
+  * @name   telemetryPutVarint
+  * @brief  Writes value as a little endian base 128 varint (7 bits per byte,
+  *         msb set on every byte but the last).
+  * @param  value: value to write.
+  * @param  buffer: destination, up to 5 bytes.
+  * @retval number of bytes written.
+  */
+int telemetryPutVarint( uint32_t value, uint8_t * buffer )
+{
+    int n = 0;
+    while (value >= 0x80)
+    {
+        buffer[n++] = (uint8_t)(value | 0x80);
+        value = value >> 7;
+    }
+    buffer[n++] = (uint8_t)value;
+    return n;
+}
+//EOF
@@ -0,0 +1,76 @@
+/**
+  ******************************************************************************
+  * @file    haplink_telemetry.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Delta-encoded, change-only telemetry frames for the haptic hand.
+  *          A keyframe carries every field, the frames in between carry a
+  *          presence bitmask and zigzag varint deltas of the changed fields.
+  *          Frame layout (all binary):
+  *             [SYNC 0xA5][type][len][payload ... len bytes][crc8]
+  *          Keyframe payload: [seq][13 x zigzag varint absolute value]
+  *          Delta payload:    [seq][mask lsb][mask msb][zigzag varint delta
+  *                            for every bit set in mask, lowest bit first]
+  *          Ping reply payload: [host stamp][device rx us][device tx us],
+  *                            three uint32 little endian (see 'g' message)
+  *          Values are quantized to 1/TELEMETRY_SCALE mm (same resolution as
+  *          the "%.2f" text protocol). The crc8 (poly 0x07) covers type, len
+  *          and payload.
+  ******************************************************************************
+  */
+#ifndef __HAPLINK_TELEMETRY_H_
+#define __HAPLINK_TELEMETRY_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Frame constants */
+#define TELEMETRY_FRAME_SYNC        0xA5
+#define TELEMETRY_TYPE_KEYFRAME     'K'
+#define TELEMETRY_TYPE_DELTA        'D'
+#define TELEMETRY_TYPE_PING_REPLY   'G'
+#define TELEMETRY_FRAME_OVERHEAD    4       // sync, type, len, crc
+
+/* Hand pose fields, same order as the text protocol in SerialHandler.pde */
+#define TELEMETRY_FIELD_THUMB_X     0
+#define TELEMETRY_FIELD_THUMB_Y     1
+#define TELEMETRY_FIELD_THUMB_Z     2
+#define TELEMETRY_FIELD_F1_X        3
+#define TELEMETRY_FIELD_F1_Y        4
+#define TELEMETRY_FIELD_F1_Z        5
+#define TELEMETRY_FIELD_F2_X        6
+#define TELEMETRY_FIELD_F2_Y        7
+#define TELEMETRY_FIELD_F2_Z        8
+#define TELEMETRY_FIELD_SPHERE_X    9
+#define TELEMETRY_FIELD_SPHERE_Y    10
+#define TELEMETRY_FIELD_SPHERE_Z    11
+#define TELEMETRY_FIELD_SPHERE_R    12
+#define TELEMETRY_NUM_FIELDS        13
+
+#define TELEMETRY_SCALE             100.0f  // counts per mm
+#define TELEMETRY_KEYFRAME_INTERVAL 50      // frames between forced keyframes
+
+// seq + mask + 5 bytes per worst case varint
+#define TELEMETRY_MAX_PAYLOAD       (3 + 5 * TELEMETRY_NUM_FIELDS)
+#define TELEMETRY_MAX_FRAME_SIZE    (TELEMETRY_MAX_PAYLOAD + TELEMETRY_FRAME_OVERHEAD)
+#define TELEMETRY_PING_REPLY_SIZE   (12 + TELEMETRY_FRAME_OVERHEAD)
+
+void initHaplinkTelemetry( void );
+void requestTelemetryKeyframe( void );
+int packTelemetryFrame( const float * fields, uint8_t * buffer_to_pack );
+int packPingReplyFrame( uint32_t host_stamp, uint32_t device_rx_us, uint32_t device_tx_us, uint8_t * buffer_to_pack );
+
+int telemetryFinishFrame( uint8_t * frame, uint8_t type, int payload_length );
+uint8_t telemetryCrc8( const uint8_t * data, int length );
+uint32_t telemetryZigzag( int32_t value );
+int telemetryPutVarint( uint32_t value, uint8_t * buffer );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAPLINK_TELEMETRY_H_
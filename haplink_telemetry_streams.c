@@ -0,0 +1,283 @@
+/**
+  ******************************************************************************
+  * @file    haplink_telemetry_streams.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Telemetry stream registry and transmit scheduler. The streams
+  *          themselves (what gets printed) live in debug_mort.cpp.
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "haplink_telemetry_streams.h"
+#include <stddef.h>
+
+/* Global Variables ----------------------------------------------------------*/
+static TelemetryStream telemetryStreams[NUMBER_TELEMETRY_STREAMS];
+
+//loop period statistics for the timing stream
+static double lastServiceUs = -1.0;
+static double loopPeriodMinUs = 0.0;
+static double loopPeriodMaxUs = 0.0;
+static double loopPeriodSumUs = 0.0;
+static uint32_t loopPeriodCount = 0;
+
+//Jacobian evaluations (lazy, only for limbs with a force to output), per force
+//output tick. The ticks (the servo interrupt with HAND_SERVO_RATE_HZ) add to
+//slot jacobianEvalsFront, the loop flips it and reads the other one: a tick
+//cannot be preempted by the loop, so once flipped the old slot is the loop's
+static uint32_t jacobianEvalsTick = 0;
+static volatile uint32_t jacobianEvalsSum[2] = {0, 0};
+static volatile uint32_t jacobianEvalsMax[2] = {0, 0};
+static volatile uint32_t jacobianEvalsTicks[2] = {0, 0};
+static volatile uint8_t jacobianEvalsFront = 0;
+
+/* Function Definitions ------------------------------------------------------*/
+
+/*******************************************************************************
+  * @name   initTelemetryStreams
+  * @brief  Clears the registry, every stream starts off.
+  * @param  None.
+  * @retval None.
+  */
+void initTelemetryStreams( void )
+{
+    int i;
+    for (i = 0; i < NUMBER_TELEMETRY_STREAMS; i++)
+    {
+        telemetryStreams[i].name = NULL;
+        telemetryStreams[i].emit = NULL;
+        telemetryStreams[i].rateHz = 0;
+        telemetryStreams[i].priority = 0;
+        telemetryStreams[i].estimatedBytes = 0;
+        telemetryStreams[i].periodUs = 0.0;
+        telemetryStreams[i].nextDueUs = 0.0;
+    }
+    lastServiceUs = -1.0;
+    clearLoopPeriodStats();
+}
+
+/*******************************************************************************
+  * @name   registerTelemetryStream
+  * @brief  Adds a stream to the registry.
+  * @param  stream: one of the STREAM_ ids.
+  * @param  name: short name for debugging.
+  * @param  emit: function that sends one message of the stream.
+  * @param  rateHz: how often to send, 0 = off.
+  * @param  priority: higher priority streams get the link first.
+  * @param  estimatedBytes: initial guess of the message size.
+  * @retval None.
+  */
+void registerTelemetryStream( int stream, const char * name, TelemetryStreamEmit emit,
+                              uint16_t rateHz, uint8_t priority, uint16_t estimatedBytes )
+{
+    if ((stream < 0) || (stream >= NUMBER_TELEMETRY_STREAMS))
+    {
+        return;
+    }
+    telemetryStreams[stream].name = name;
+    telemetryStreams[stream].emit = emit;
+    telemetryStreams[stream].estimatedBytes = estimatedBytes;
+    setTelemetryStreamRate(stream, rateHz, priority);
+}
+
+/*******************************************************************************
+  * @name   setTelemetryStreamRate
+  * @brief  Changes the rate and priority of a stream at runtime.
+  * @param  stream: one of the STREAM_ ids.
+  * @param  rateHz: how often to send, 0 = off.
+  * @param  priority: higher priority streams get the link first.
+  * @retval 1 if the stream exists, 0 otherwise.
+  */
+int setTelemetryStreamRate( int stream, uint16_t rateHz, uint8_t priority )
+{
+    if ((stream < 0) || (stream >= NUMBER_TELEMETRY_STREAMS))
+    {
+        return 0;
+    }
+    telemetryStreams[stream].rateHz = rateHz;
+    telemetryStreams[stream].priority = priority;
+    telemetryStreams[stream].periodUs = (rateHz > 0) ? (1000000.0 / rateHz) : 0.0;
+    telemetryStreams[stream].nextDueUs = 0.0; // due right away
+    return 1;
+}
+
+/*******************************************************************************
+  * @name   serviceTelemetryStreams
+  * @brief  Called once per loop. Sends the due streams in priority order
+  *         while they fit in the transmit budget. A due stream that does not
+  *         fit blocks the lower priority ones until the next loop so it
+  *         cannot be starved by smaller messages. If the clock went back
+  *         (the timebase restarted or wrapped) every stream is due again
+  *         right away instead of waiting for the old schedule.
+  * @param  now_us: current time in us.
+  * @param  tx_budget_bytes: free space in the transmit buffer.
+  * @retval number of bytes queued.
+  */
+int serviceTelemetryStreams( double now_us, int tx_budget_bytes )
+{
+    uint8_t sent[NUMBER_TELEMETRY_STREAMS] = {0};
+    TelemetryStream * s;
+    int queued = 0;
+    int best;
+    int bytes;
+    int i;
+
+    // the clock went back: start the schedule again from now, no period this loop
+    if ((lastServiceUs >= 0.0) && (now_us < lastServiceUs))
+    {
+        for (i = 0; i < NUMBER_TELEMETRY_STREAMS; i++)
+        {
+            telemetryStreams[i].nextDueUs = now_us;
+        }
+        lastServiceUs = -1.0;
+    }
+
+    // loop period statistics
+    if (lastServiceUs >= 0.0)
+    {
+        double period = now_us - lastServiceUs;
+        if ((loopPeriodCount == 0) || (period < loopPeriodMinUs)) loopPeriodMinUs = period;
+        if ((loopPeriodCount == 0) || (period > loopPeriodMaxUs)) loopPeriodMaxUs = period;
+        loopPeriodSumUs = loopPeriodSumUs + period;
+        loopPeriodCount = loopPeriodCount + 1;
+    }
+    lastServiceUs = now_us;
+
+    while (1)
+    {
+        // highest priority stream that is due and has not gone this loop
+        best = -1;
+        for (i = 0; i < NUMBER_TELEMETRY_STREAMS; i++)
+        {
+            s = &telemetryStreams[i];
+            if ((s->emit == NULL) || (s->rateHz == 0) || sent[i] || (now_us < s->nextDueUs))
+            {
+                continue;
+            }
+            if ((best < 0) || (s->priority > telemetryStreams[best].priority))
+            {
+                best = i;
+            }
+        }
+        if (best < 0)
+        {
+            break;
+        }
+
+        s = &telemetryStreams[best];
+        if (s->estimatedBytes > tx_budget_bytes)
+        {
+            break; // wait for the link to drain
+        }
+
+        bytes = s->emit();
+        sent[best] = 1;
+        if (bytes > s->estimatedBytes)
+        {
+            s->estimatedBytes = (uint16_t)bytes;
+        }
+        tx_budget_bytes = tx_budget_bytes - bytes;
+        queued = queued + bytes;
+
+        // keep the schedule, but don't try to catch up on missed messages
+        s->nextDueUs = s->nextDueUs + s->periodUs;
+        if (s->nextDueUs < now_us)
+        {
+            s->nextDueUs = now_us + s->periodUs;
+        }
+    }
+    return queued;
+}
+
+uint16_t getTelemetryStreamRate( int stream )
+{
+    if ((stream < 0) || (stream >= NUMBER_TELEMETRY_STREAMS))
+    {
+        return 0;
+    }
+    return telemetryStreams[stream].rateHz;
+}
+
+double getLoopPeriodMinUs( void )
+{
+    return loopPeriodMinUs;
+}
+
+double getLoopPeriodMaxUs( void )
+{
+    return loopPeriodMaxUs;
+}
+
+double getLoopPeriodAvgUs( void )
+{
+    if (loopPeriodCount == 0)
+    {
+        return 0.0;
+    }
+    return loopPeriodSumUs / loopPeriodCount;
+}
+
+void clearLoopPeriodStats( void )
+{
+    loopPeriodMinUs = 0.0;
+    loopPeriodMaxUs = 0.0;
+    loopPeriodSumUs = 0.0;
+    loopPeriodCount = 0;
+}
+
+/*******************************************************************************
+  * @name   countJacobianEvaluation
+  * @brief  Called by every Jacobian computed on demand, counted per force
+  *         output tick (see endJacobianEvaluationTick) for the timing stream.
+  *         Same context as the ticks.
+  * @param  None.
+  * @retval None.
+  */
+void countJacobianEvaluation( void )
+{
+    jacobianEvalsTick = jacobianEvalsTick + 1;
+}
+
+/*******************************************************************************
+  * @name   endJacobianEvaluationTick
+  * @brief  Closes a force output tick (outputHandForces, in the servo
+  *         interrupt with HAND_SERVO_RATE_HZ, in the loop otherwise): its
+  *         Jacobians go into the statistics takeJacobianEvals hands over.
+  * @param  None.
+  * @retval None.
+  */
+void endJacobianEvaluationTick( void )
+{
+    uint8_t front = jacobianEvalsFront;
+
+    jacobianEvalsSum[front] = jacobianEvalsSum[front] + jacobianEvalsTick;
+    if (jacobianEvalsTick > jacobianEvalsMax[front]) jacobianEvalsMax[front] = jacobianEvalsTick;
+    jacobianEvalsTicks[front] = jacobianEvalsTicks[front] + 1;
+    jacobianEvalsTick = 0;
+}
+
+/*******************************************************************************
+  * @name   takeJacobianEvals
+  * @brief  Jacobian statistics of the ticks since the last call, and starts
+  *         new ones. Main loop only; no tick is lost or counted twice.
+  * @param  avg: out, Jacobians per tick.
+  * @param  max: out, most Jacobians in one tick.
+  * @retval number of ticks.
+  */
+uint32_t takeJacobianEvals( double * avg, uint32_t * max )
+{
+    uint8_t back = jacobianEvalsFront;
+    uint32_t ticks;
+
+    jacobianEvalsFront = 1 - back;
+    ticks = jacobianEvalsTicks[back];
+    *avg = (ticks > 0) ? (double)jacobianEvalsSum[back] / ticks : 0.0;
+    *max = jacobianEvalsMax[back];
+    jacobianEvalsSum[back] = 0;
+    jacobianEvalsMax[back] = 0;
+    jacobianEvalsTicks[back] = 0;
+    return ticks;
+}
+//EOF
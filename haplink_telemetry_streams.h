@@ -0,0 +1,68 @@
+/**
+  ******************************************************************************
+  * @file    haplink_telemetry_streams.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Registry of telemetry streams and the scheduler that shares the
+  *          serial link between them. Every stream has a rate and a priority
+  *          that can be changed at runtime with the 'r' message:
+  *             "r<stream> <rate Hz> <priority>l"   e.g. "r1 10 2l"
+  *          A rate of 0 turns the stream off. Each loop the scheduler sends
+  *          the due streams, highest priority first, as long as they fit in
+  *          the free space of the transmit buffer, so the link is never
+  *          asked for more than it can carry.
+  ******************************************************************************
+  */
+#ifndef __HAPLINK_TELEMETRY_STREAMS_H_
+#define __HAPLINK_TELEMETRY_STREAMS_H_
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+#include <stdint.h>
+
+/* Stream ids */
+#define STREAM_HAND_POSE        0   // thumb, fingers and object for Processing
+#define STREAM_FINGER_DEBUG     1   // finger positions, angles and torques as text
+#define STREAM_TORQUES          2   // all seven motor torques
+#define STREAM_FSR              3   // force sensitive resistor readings
+#define STREAM_TIMING           4   // loop period and Jacobian evaluation statistics
+#define STREAM_TELEOPERATION    5   // position for the remote teleoperator
+#define STREAM_PASSIVITY        6   // passivity observer energy and damping per contact point
+#define NUMBER_TELEMETRY_STREAMS 7
+
+//sends one message of the stream, returns the number of bytes queued (0 if nothing was sent)
+typedef int (*TelemetryStreamEmit)( void );
+
+typedef struct {
+    const char * name;
+    TelemetryStreamEmit emit;
+    uint16_t rateHz;            // 0 = off
+    uint8_t priority;           // higher goes first
+    uint16_t estimatedBytes;    // largest message seen so far
+    double periodUs;
+    double nextDueUs;
+} TelemetryStream;
+
+void initTelemetryStreams( void );
+void registerTelemetryStream( int stream, const char * name, TelemetryStreamEmit emit,
+                              uint16_t rateHz, uint8_t priority, uint16_t estimatedBytes );
+int setTelemetryStreamRate( int stream, uint16_t rateHz, uint8_t priority );
+int serviceTelemetryStreams( double now_us, int tx_budget_bytes );
+
+uint16_t getTelemetryStreamRate( int stream );
+double getLoopPeriodMinUs( void );
+double getLoopPeriodMaxUs( void );
+double getLoopPeriodAvgUs( void );
+void clearLoopPeriodStats( void );
+void countJacobianEvaluation( void );
+void endJacobianEvaluationTick( void );
+uint32_t takeJacobianEvals( double * avg, uint32_t * max );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  //__HAPLINK_TELEMETRY_STREAMS_H_
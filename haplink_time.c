@@ -20,7 +20,7 @@ __IO uint16_t CCR1_Val2 = 65535;//65535;//40961;
 uint16_t PrescalerValue2 = 0;
 uint16_t capture = 0;
 uint32_t timeLow = 0;
-uint16_t timeHigh = 0;
+uint32_t timeHigh = 0;   //overflows of TIM2, 16 bits would wrap getTime_us after 2018.6 s
 double timeResolution = 0.47; //in us
 
 
@@ -89,6 +89,20 @@ double getTime_us( void )
   timeUs = timeUs + timeHigh*30801.92;
   return timeUs;
 }
+
+/*******************************************************************************
+  * @name   getTime32_us
+  * @brief  Time since start as a 32 bit us counter, wraps at 2^32 us (71.6
+  *         min) like any uint32, so the other side can unwrap it with 32 bit
+  *         differences. For the timestamps that go out on the link.
+  * @param  None.
+  * @retval us.
+  */
+uint32_t getTime32_us( void )
+{
+  return (uint32_t)(uint64_t)getTime_us();
+}
+
 double getTime_ms(void)
 {
     double timeMs = 0;
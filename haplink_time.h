@@ -22,6 +22,7 @@
 
 void initHaplinkTime( void );
 double getTime_us( void );
+uint32_t getTime32_us( void );
 double getTime_ms(void);
 
 
@@ -13,6 +13,7 @@
 #include "haplink_vibration_motors.h"
 #include "haplink_fsr.h"
 #include "haplink_position.h"
+#include "hand_limbs.h"
 #include "haplink_motors.h"
 #include "debug_mort.h"
 #include "haplink_communication.h"
@@ -24,8 +25,6 @@
 /* Global Variables ----------------------------------------------------------*/
 //variables needed declared in other files:
 extern double J00, J01, J10, J11; //jacobian variables
-extern double J00_f1, J01_f1, J10_f1, J11_f1; //jacobian variables
-extern double J00_f2, J01_f2, J10_f2, J11_f2; //jacobian variables
 extern double rx, ry, dx, dy; // 2-DOF position variables
 extern double xH, dxH; //1-DOF position variables
 double rx_proxy = 0.0;
@@ -178,17 +177,9 @@ void renderOutsideCircle2DOF_M4M5( void )
         ForceY = 0.0;
     }
 
-    TorqueX = J00_f1*ForceX + J10_f1*ForceY;
-    TorqueX = TorqueX*0.001;
-    TorqueY = J01_f1*ForceX + J11_f1*ForceY;
-    TorqueY = TorqueY*0.001;
-            
-    TorqueMotor4 = ((TorqueX*R_MA)/R_A);
-    TorqueMotor5 = ((TorqueY*R_MB)/R_B); 
-
-            
-    outputTorqueMotor4(TorqueMotor4);
-    outputTorqueMotor5(TorqueMotor5);    // flipped the sign to get the circle 
+    handLimbOutputForce(HAND_FINGER_1, ForceX, ForceY);
+    TorqueMotor4 = handLimbState.torqueA[HAND_FINGER_1];
+    TorqueMotor5 = handLimbState.torqueB[HAND_FINGER_1];
 }
 
 /*******************************************************************************
@@ -239,16 +230,9 @@ void renderOutsideCircle2DOF_M6M7( void )
         ForceY = 0.0;
     }
 
-    TorqueX = J00_f2*ForceX + J10_f2*ForceY;
-    TorqueX = TorqueX*0.001;
-    TorqueY = J01_f2*ForceX + J11_f2*ForceY;
-    TorqueY = TorqueY*0.001;
-            
-    TorqueMotor6 = -((TorqueX*R_MA)/R_A);
-    TorqueMotor7 = -((TorqueY*R_MB)/R_B); 
-            
-    outputTorqueMotor6(TorqueMotor6);
-    outputTorqueMotor7(TorqueMotor7);    // flipped the sign to get the circle 
+    handLimbOutputForce(HAND_FINGER_2, ForceX, ForceY);   // flips the sign, see handLimbs[]
+    TorqueMotor6 = handLimbState.torqueA[HAND_FINGER_2];
+    TorqueMotor7 = handLimbState.torqueB[HAND_FINGER_2];
 }
 
 /*******************************************************************************
@@ -0,0 +1,387 @@
+/**
+  ******************************************************************************
+  * @file    hand_host_link.cpp
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host side of the host physics link (see hand_host_link.h).
+  ******************************************************************************
+  */
+
+/* Includes ------------------------------------------------------------------*/
+#include "hand_host_link.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/select.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+/* Static Functions ----------------------------------------------------------*/
+
+static speed_t baudConstant( int baud )
+{
+    switch (baud)
+    {
+    case 9600:   return B9600;
+    case 57600:  return B57600;
+    case 230400: return B230400;
+#ifdef B460800
+    case 460800: return B460800;
+#endif
+#ifdef B921600
+    case 921600: return B921600;
+#endif
+    default:     return B115200;
+    }
+}
+
+// reads a zigzag varint, 0 if it runs past the payload
+static int getVarint( const uint8_t *buffer, int length, int *n, int32_t *value )
+{
+    uint32_t v = 0;
+    int shift = 0;
+
+    while (*n < length)
+    {
+        uint8_t b = buffer[(*n)++];
+        v |= (uint32_t)(b & 0x7F) << shift;
+        if (!(b & 0x80))
+        {
+            *value = (int32_t)(v >> 1) ^ -(int32_t)(v & 1);
+            return 1;
+        }
+        shift += 7;
+        if (shift > 28) return 0;
+    }
+    return 0;
+}
+
+/* Function Definitions ------------------------------------------------------*/
+
+HandHostLink::HandHostLink()
+    : fd(-1), state(0), type(0), length(0), index(0),
+      havePoseFrame(false), haveKeyframe(false), lastSeq(0),
+      poseArrival_us(0.0), modelSeq(0)
+{
+    memset(values, 0, sizeof(values));
+    memset(fields, 0, sizeof(fields));
+    memset(&linkStats, 0, sizeof(linkStats));
+}
+
+HandHostLink::~HandHostLink()
+{
+    close();
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::open
+  * @brief  Opens the serial port (or a pseudo-terminal) raw and non
+  *         blocking, and asks for a keyframe so the pose is complete at once.
+  * @param  path: /dev/ttyACM0, or the path tools/hand_core_pty.c prints.
+  * @param  baud: COMM_BAUD_RATE of the firmware.
+  * @retval true if open.
+  */
+bool HandHostLink::open( const char *path, int baud )
+{
+    struct termios tty;
+
+    close();
+    fd = ::open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0) return false;
+    if (tcgetattr(fd, &tty) == 0)
+    {
+        cfmakeraw(&tty);
+        cfsetispeed(&tty, baudConstant(baud));
+        cfsetospeed(&tty, baudConstant(baud));
+        tty.c_cflag |= CLOCAL | CREAD;
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+    tcflush(fd, TCIOFLUSH);
+    state = 0;
+    haveKeyframe = false;
+    havePoseFrame = false;
+    return sendText("k");
+}
+
+void HandHostLink::close()
+{
+    if (fd >= 0) ::close(fd);
+    fd = -1;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::now_us
+  * @brief  Host monotonic clock, the one the model frames are stamped with.
+  *         The stamps are its low 32 bits, wrapping at 2^32 us like the
+  *         device's getTime32_us; the device unwraps them with 32 bit
+  *         differences.
+  * @param  None.
+  * @retval us.
+  */
+double HandHostLink::now_us()
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::poll
+  * @brief  Reads everything that arrived, waiting up to timeout_us for the
+  *         first byte. Text and the other telemetry frames are skipped.
+  * @param  timeout_us: 0 to only take what is there.
+  * @retval pose frames decoded, -1 if the port failed.
+  */
+int HandHostLink::poll( int timeout_us )
+{
+    uint8_t buffer[512];
+    fd_set readable;
+    struct timeval tv;
+    int poses = 0;
+
+    if (fd < 0) return -1;
+    FD_ZERO(&readable);
+    FD_SET(fd, &readable);
+    tv.tv_sec = timeout_us / 1000000;
+    tv.tv_usec = timeout_us % 1000000;
+    if (select(fd + 1, &readable, NULL, NULL, &tv) <= 0) return 0;
+
+    for (;;)
+    {
+        ssize_t n = read(fd, buffer, sizeof(buffer));
+        if (n < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) break;
+            return -1;
+        }
+        if (n == 0) break;
+        linkStats.bytesRead += n;
+        for (ssize_t i = 0; i < n; i++) poses += feed(buffer[i]);
+    }
+    return poses;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::feed
+  * @brief  Byte state machine for [sync][type][len][payload][crc].
+  * @param  b: next byte.
+  * @retval 1 when a pose frame was decoded.
+  */
+int HandHostLink::feed( uint8_t b )
+{
+    switch (state)
+    {
+    case 0:
+        if (b == TELEMETRY_FRAME_SYNC) state = 1;
+        return 0;
+    case 1:
+        type = b;
+        state = 2;
+        return 0;
+    case 2:
+        length = b;
+        index = 0;
+        state = (b > 0) ? 3 : 4;
+        return 0;
+    case 3:
+        payload[index++] = b;
+        if (index >= length) state = 4;
+        return 0;
+    default:
+    {
+        uint8_t frame[2 + sizeof(payload)];     // type, len and payload, what the crc covers
+        state = 0;
+        if ((type != TELEMETRY_TYPE_KEYFRAME) && (type != TELEMETRY_TYPE_DELTA)) return 0;
+        frame[0] = (uint8_t)type;
+        frame[1] = (uint8_t)length;
+        memcpy(&frame[2], payload, length);
+        if (telemetryCrc8(frame, length + 2) != b)
+        {
+            lostFrame();
+            return 0;
+        }
+        return decodePose();
+    }
+    }
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::lostFrame
+  * @brief  The deltas cannot be applied until the next keyframe, ask for it
+  *         once (the device also sends one every TELEMETRY_KEYFRAME_INTERVAL
+  *         frames, in case the request is lost too).
+  * @param  None.
+  * @retval None.
+  */
+void HandHostLink::lostFrame()
+{
+    if (!haveKeyframe) return;
+    haveKeyframe = false;
+    linkStats.lost++;
+    linkStats.keyframeRequests++;
+    sendText("k");
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::decodePose
+  * @brief  Applies a keyframe or a delta to the pose. A delta that does not
+  *         follow the last frame cannot be applied, a keyframe is requested.
+  * @param  None.
+  * @retval 1 if the pose was updated.
+  */
+int HandHostLink::decodePose()
+{
+    int32_t next[TELEMETRY_NUM_FIELDS];
+    uint8_t seq = payload[0];
+    int n = 1, i;
+
+    if (length < 1) return 0;
+    memcpy(next, values, sizeof(next));
+    if (type == TELEMETRY_TYPE_KEYFRAME)
+    {
+        for (i = 0; i < TELEMETRY_NUM_FIELDS; i++)
+        {
+            if (!getVarint(payload, length, &n, &next[i])) return 0;
+        }
+    }
+    else
+    {
+        uint16_t mask;
+        if (!haveKeyframe || (seq != (uint8_t)(lastSeq + 1)))
+        {
+            lostFrame();
+            return 0;
+        }
+        if (length < 3) return 0;
+        mask = payload[1] | (payload[2] << 8);
+        n = 3;
+        for (i = 0; i < TELEMETRY_NUM_FIELDS; i++)
+        {
+            int32_t delta;
+            if (!(mask & (1u << i))) continue;
+            if (!getVarint(payload, length, &n, &delta)) return 0;
+            next[i] += delta;
+        }
+    }
+
+    memcpy(values, next, sizeof(values));
+    for (i = 0; i < TELEMETRY_NUM_FIELDS; i++) fields[i] = values[i] / TELEMETRY_SCALE;
+    haveKeyframe = true;
+    havePoseFrame = true;
+    lastSeq = seq;
+    poseArrival_us = now_us();
+    linkStats.poses++;
+    return 1;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::contactPoints
+  * @brief  Contact points of the last pose, the frame the device renders in.
+  * @param  points: thumb, finger 1, finger 2, mm.
+  * @retval None.
+  */
+void HandHostLink::contactPoints( float points[HOST_LINK_POINTS][3] ) const
+{
+    for (int j = 0; j < HOST_LINK_POINTS; j++)
+    {
+        for (int k = 0; k < 3; k++) points[j][k] = fields[TELEMETRY_FIELD_THUMB_X + 3 * j + k];
+    }
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::sendModels
+  * @brief  Sends one local model per contact point, stamped with now_us().
+  *         Stamp them when the physics step that made them ran; the device
+  *         blends over the spacing of the stamps.
+  * @param  models: thumb first, LOCAL_NONE for free space.
+  * @param  points: number of models.
+  * @retval true if written.
+  */
+bool HandHostLink::sendModels( const HandLocalModel models[], int points )
+{
+    uint8_t frame[HOST_MODELS_MAX_FRAME_SIZE];
+    int n = hostModelsPack(frame, modelSeq++, (uint32_t)(uint64_t)now_us(), models, points);
+
+    if (!writeAll(frame, n)) return false;
+    linkStats.modelsSent++;
+    return true;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::sendObjectKeyframes
+  * @brief  Sends where scene objects of the device are now, stamped with
+  *         now_us(); the device plays them MOTION_KEY_DELAY_US late, 50 to
+  *         100 Hz is plenty.
+  * @param  objects: scene indices on the device.
+  * @param  positions: p of each (hand_motion.h), mm.
+  * @param  count: at most MOTION_FRAME_MAX_ENTRIES.
+  * @retval true if written.
+  */
+bool HandHostLink::sendObjectKeyframes( const uint8_t objects[], const float positions[][3], int count )
+{
+    uint8_t frame[MOTION_MAX_FRAME_SIZE];
+    int n = motionPack(frame, (uint32_t)(uint64_t)now_us(), objects, positions, count);
+
+    if (!writeAll(frame, n)) return false;
+    linkStats.keyframesSent++;
+    return true;
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::setStreamRate
+  * @brief  "r<stream> <rate Hz> <priority>l", e.g. the pose stream at the
+  *         host rate.
+  * @param  stream: see haplink_telemetry_streams.h.
+  * @param  rate_hz: 0 turns it off.
+  * @param  priority: higher goes first.
+  * @retval true if written.
+  */
+bool HandHostLink::setStreamRate( int stream, int rate_hz, int priority )
+{
+    char message[32];
+    snprintf(message, sizeof(message), "r%d %d %d", stream, rate_hz, priority);
+    return sendText(message);
+}
+
+/*******************************************************************************
+  * @name   HandHostLink::sendText
+  * @brief  Sends a text command, the terminating 'l' is added.
+  * @param  message: without the 'l'.
+  * @retval true if written.
+  */
+bool HandHostLink::sendText( const char *message )
+{
+    char buffer[64];
+    int n = snprintf(buffer, sizeof(buffer), "%sl", message);
+    return writeAll((const uint8_t *)buffer, n);
+}
+
+bool HandHostLink::writeAll( const uint8_t *data, int count )
+{
+    int done = 0;
+
+    if (fd < 0) return false;
+    while (done < count)
+    {
+        ssize_t n = write(fd, data + done, count - done);
+        if (n < 0)
+        {
+            if ((errno == EAGAIN) || (errno == EINTR))
+            {
+                fd_set writable;
+                FD_ZERO(&writable);
+                FD_SET(fd, &writable);
+                select(fd + 1, NULL, &writable, NULL, NULL);
+                continue;
+            }
+            return false;
+        }
+        done += n;
+    }
+    linkStats.bytesWritten += count;
+    return true;
+}
+//EOF
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    hand_host_link.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host side of the host physics link (HAND_HOST_PHYSICS in main.h,
+  *          hand_host_models.h), C++, Linux and macOS. The host program owns
+  *          the simulation; this class only moves data:
+  *           - poll() reads the hand pose stream ('K'/'D' telemetry frames,
+  *             haplink_telemetry.h) and keeps the contact points up to date,
+  *             asking for a keyframe ("kl") when a frame is lost;
+  *           - sendModels() packs one local model per contact point
+  *             (hand_local_model.h) with the host clock and writes it;
+  *           - sendObjectKeyframes() moves scene objects of the device
+  *             (hand_motion.h) when the device runs the contacts itself.
+  *          A host loop is then: poll, step the physics at contactPoints(),
+  *          reduce each point to a plane or a sphere, sendModels, at
+  *          500 to 1000 Hz.
+  *          Build with the device sources it shares, from the repository
+  *          root:
+  *             gcc -O2 -I. -c hand_host_models.c hand_local_model.c hand_motion.c hand_scene.c hand_sdf.c haplink_telemetry.c
+  *             g++ -O2 -I. -c host/hand_host_link.cpp
+  *          and link the objects with the host program (-lm). Test it
+  *          without the hand against tools/hand_core_pty.c, see
+  *          tools/host_link_check.cpp.
+  ******************************************************************************
+  */
+#ifndef __HAND_HOST_LINK_H_
+#define __HAND_HOST_LINK_H_
+
+#include <stdint.h>
+#include "hand_host_models.h"
+#include "hand_motion.h"
+
+#define HOST_LINK_POINTS        3       // thumb, finger 1, finger 2, as in the pose stream
+#define HOST_LINK_STREAM_POSE   0       // STREAM_HAND_POSE of haplink_telemetry_streams.h
+
+typedef struct {
+    uint32_t poses;             // pose frames decoded
+    uint32_t lost;              // sequence gaps and bad crcs
+    uint32_t keyframeRequests;
+    uint32_t modelsSent;
+    uint32_t keyframesSent;
+    uint32_t bytesRead;
+    uint32_t bytesWritten;
+} HandHostLinkStats;
+
+class HandHostLink
+{
+public:
+    HandHostLink();
+    ~HandHostLink();
+
+    bool open( const char *path, int baud = 115200 );
+    void close();
+    bool isOpen() const { return fd >= 0; }
+
+    int poll( int timeout_us );
+    bool havePose() const { return havePoseFrame; }
+    double poseTime_us() const { return poseArrival_us; }
+    void contactPoints( float points[HOST_LINK_POINTS][3] ) const;
+    float field( int index ) const { return fields[index]; }
+
+    bool sendModels( const HandLocalModel models[], int points );
+    bool sendObjectKeyframes( const uint8_t objects[], const float positions[][3], int count );
+    bool setStreamRate( int stream, int rate_hz, int priority );
+    bool sendText( const char *message );
+
+    const HandHostLinkStats &stats() const { return linkStats; }
+    static double now_us();
+
+private:
+    bool writeAll( const uint8_t *data, int length );
+    int feed( uint8_t b );
+    void lostFrame();
+    int decodePose();
+
+    int fd;
+    // frame parser: [sync][type][len][payload][crc]
+    int state, type, length, index;
+    uint8_t payload[256];
+    // pose stream
+    bool havePoseFrame, haveKeyframe;
+    uint8_t lastSeq;
+    int32_t values[TELEMETRY_NUM_FIELDS];
+    float fields[TELEMETRY_NUM_FIELDS];
+    double poseArrival_us;
+    uint8_t modelSeq;
+    HandHostLinkStats linkStats;
+};
+
+#endif  //__HAND_HOST_LINK_H_
+//EOF
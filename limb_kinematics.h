@@ -0,0 +1,110 @@
+/**
+  ******************************************************************************
+  * @file    limb_kinematics.h
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Forward kinematics of the hand limbs written once, as templates
+  *          over the scalar type (C++). With double they give the position;
+  *          with Dual<double, N> (dual_number.h) seeded on the joint angles
+  *          they also give the exact Jacobian, d position / d angle, in the
+  *          same pass. Only needs math.h and delta_kinematics.h so the host
+  *          tools can use them (tools/bench_dual_kinematics.cpp).
+  ******************************************************************************
+  */
+#ifndef __LIMB_KINEMATICS_H_
+#define __LIMB_KINEMATICS_H_
+
+#ifdef __cplusplus
+
+#include "dual_number.h"
+#include "delta_kinematics.h"
+#include <math.h>
+
+// Haplink paddle pair, lengths in mm (L_A, L_B, CX, CY of haplink_position.h)
+typedef struct {
+    double lengthA, lengthB;
+    double cx, cy;
+} PaddleGeometry;
+
+/*******************************************************************************
+  * @name   paddleForward
+  * @brief  End of the two link paddle chain in the limb frame.
+  * @param  tildethetaA: paddle a angle with its offset, rad.
+  * @param  tildethetaB: paddle b angle (relative to a) with its offset, rad.
+  * @param  geometry: link lengths and center.
+  * @param  rx, ry: mm.
+  * @retval None.
+  */
+template <typename S>
+inline void paddleForward( const S &tildethetaA, const S &tildethetaB, const PaddleGeometry &geometry,
+                           S &rx, S &ry )
+{
+    S tildethetaAB = tildethetaA + tildethetaB;
+    S px = -geometry.lengthA * sin(tildethetaA) + geometry.cx;
+    S py = geometry.lengthA * cos(tildethetaA) + geometry.cy;
+
+    rx = -geometry.lengthB * sin(tildethetaAB) + px;
+    ry = geometry.lengthB * cos(tildethetaAB) + py;
+}
+
+/*******************************************************************************
+  * @name   deltaForward
+  * @brief  DeltaZ closed form forward kinematics (the same as
+  *         deltaKinematicsForward), delta_calcForward frame.
+  * @param  theta1, theta2, theta3: motor angles, rad.
+  * @param  x0, y0, z0: end effector, mm.
+  * @retval 0 if ok, -1 if the point does not exist.
+  */
+template <typename S>
+inline int deltaForward( const S &theta1, const S &theta2, const S &theta3, S &x0, S &y0, S &z0 )
+{
+    const double t = (DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS) * DELTA_TAN30 / 2;
+    const double rf = DELTA_LOWER_LINK_LEN;
+    const double re = DELTA_UPPER_LINK_LEN;
+
+    S y1 = -(t + rf * cos(theta1));
+    S z1 = -rf * sin(theta1);
+
+    S y2 = (t + rf * cos(theta2)) * 0.5;
+    S x2 = y2 * DELTA_SQRT3;
+    S z2 = -rf * sin(theta2);
+
+    S y3 = (t + rf * cos(theta3)) * 0.5;
+    S x3 = -y3 * DELTA_SQRT3;
+    S z3 = -rf * sin(theta3);
+
+    S dnm = (y2 - y1) * x3 - (y3 - y1) * x2;
+
+    S w1 = y1 * y1 + z1 * z1;
+    S w2 = x2 * x2 + y2 * y2 + z2 * z2;
+    S w3 = x3 * x3 + y3 * y3 + z3 * z3;
+
+    // x = (a1*z + b1)/dnm
+    S a1 = (z2 - z1) * (y3 - y1) - (z3 - z1) * (y2 - y1);
+    S b1 = -((w2 - w1) * (y3 - y1) - (w3 - w1) * (y2 - y1)) / 2.0;
+
+    // y = (a2*z + b2)/dnm;
+    S a2 = -(z2 - z1) * x3 + (z3 - z1) * x2;
+    S b2 = ((w2 - w1) * x3 - (w3 - w1) * x2) / 2.0;
+
+    // a*z^2 + b*z + c = 0
+    S yd = b2 - y1 * dnm;
+    S a = a1 * a1 + a2 * a2 + dnm * dnm;
+    S b = 2.0 * (a1 * b1 + a2 * yd - z1 * dnm * dnm);
+    S c = yd * yd + b1 * b1 + dnm * dnm * (z1 * z1 - re * re);
+
+    // discriminant
+    S d = b * b - 4.0 * a * c;
+    if (d < 0.0) return -1; // non-existing point
+
+    z0 = -0.5 * (b + sqrt(d)) / a;
+    x0 = (a1 * z0 + b1) / dnm;
+    y0 = (a2 * z0 + b2) / dnm;
+    return 0;
+}
+
+#endif  // __cplusplus
+
+#endif  //__LIMB_KINEMATICS_H_
+//EOF
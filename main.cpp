@@ -22,10 +22,11 @@
 #include "haplink_adc_sensors.h"
 #include "delta_thumb.h"
 #include "hand_virtual_environment.h"
+#include "hand_limbs.h"
+#include "hand_servo.h"
 
 int main() 
 {
-    uint32_t print_counter = 0;
     double mass_position;
     double wall_position;
     int contact;
@@ -36,18 +37,25 @@ int main()
     initHaplinkMotors();        // init for all seven motors
     initHaplinkAnalogSensors(); // unchanged
     initHaplinkTime();          // unchanged
+    initHandScene();            // objects felt by the hand, hand_scene.h
+#ifdef HAND_SERVO_RATE_HZ
+    initHandServo();            // fast render interrupt, hand_servo.h
+#endif
     SystemCoreClockUpdate();    // unchanged
   
     //printf("Starting haptic hand...\n");
   while(1) 
   {
+#ifdef HAND_SERVO_RATE_HZ
+    updateHandLocalModels(); // Scene to local models, the servo interrupt renders them
+#else
     deltaThumbHandler(); // Motors 1, 2, 3
-    calculatePositionAndJacobianFinger1();  // Motors 4 and 5
-    calculatePositionAndJacobianFinger2();  // Motors 6 and 7
+    calculateHandLimbs();   // Fingers: motors 4 and 5, 6 and 7 (hand_limbs.h)
 
 
 
-    renderOutsideSphere(); // Single shape felt by thumb and fingers
+    renderHandScene(); // Every object of the scene, felt by thumb and fingers
+#endif
 
     /* Finger-specific renders for debugging */
     //renderOutsideCircle2DOF_M1M2(); // Delta disconnected, finger on original motor channels
@@ -65,60 +73,11 @@ int main()
         manageIncommingMessage();
     }
 
-//we are using the USB communication to debug:
-//This is just an example of a function that would print what I think is all of the parameters you need.
-//But you may want to print different things so feel free to write your own in debug_mort.cpp and call it from here.
-//Debug prints shouldn't happen very often.
-    #ifdef COMM_DEBUGGING
-        // printProcessingHapticHand();
-        if (print_counter > 10000)
-        {
-            //printDebug1DOFAllParameters();
-
-            // debugprintHelloWorld();
-            printProcessingHapticHand();
-          
-            //debugprintStarterCode();
-            //debugprinttruesusb();
-
-            //debugprintFingerMotorCounts();
-            
-            printDebugFinger1Parameters();
-            printDebugFinger2Parameters();
-
-            print_counter = 0;
-        }
-        else
-        {
-            print_counter = print_counter + 1;
-        }
-    #endif
-
-//we are using the USB communication to talk to processing: 
-//change the parameter you are sending depending on the virtual environment you are rendering.
-//or maybe you need to write your own function in debug_mort.cpp and call it from here.
-    #ifdef COMM_PROCESSING
-        // printProcessingHapticHand();
-        if (print_counter > 100)
-        {
-            printProcessingHapticHand();
-            print_counter = 0;
-        }
-        else
-        {
-            print_counter = print_counter + 1;
-        }
-        //printProcessingComm1DOF(mass_position*1000.0);
-        //printProcessingComm2DOF((double)contact);
-        // printProcessingCommFinger1(); // prints out x and y position for finger 1 (z is determined by physical spacing)
-        // printProcessingCommFinger2(); // prints out x and y position for finger 2 (z is determined by physical spacing )
-    #endif
-
-//we are using the USB communication for teleoperation: 
-    #ifdef COMM_TELEOPERATION
-        printTeleoperationComm();
-    #endif
-
+    /* Telemetry: every stream (hand pose for processing, debug prints, teleoperation)
+    is compiled in. The scheduler sends the ones that are due and fit in the link.
+    COMM_ defines in main.h pick the startup rates, change them at runtime with
+    the 'r' message (see haplink_telemetry_streams.h). */
+    manageTelemetryStreams();
 
   }
 }
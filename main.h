@@ -25,11 +25,74 @@
 
 /* MACROS for everyone--------------------------------------------------------*/
 
-//choose which communication you are using, comment out the other two!
+//choose which telemetry streams are on at startup, they can be combined and
+//changed at runtime with the 'r' message (see haplink_telemetry_streams.h)
     // #define COMM_DEBUGGING          1
     #define COMM_PROCESSING         2
     //#define COMM_TELEOPERATION      3
 
+//send the hand pose stream as delta-encoded binary frames instead of
+//tab-separated text. Comment out for the legacy text protocol. Must match
+//BINARY_TELEMETRY in ProcessingHapticsHand/Configuration.pde
+    #define TELEMETRY_DELTA_ENCODING 1
+
+//teleoperate the whole hand with the binary hand frame (haplink_communication.h)
+//instead of the 1-DOF/2-DOF 'p' message. TELEOP_HAND_POSES sends the thumb and
+//finger positions, TELEOP_HAND_JOINTS the seven encoder counts.
+    #define TELEOPERATION_HAND_FRAME TELEOP_HAND_POSES
+
+//solve the delta thumb position with Newton steps started from the last tick
+//(deltaKinematicsForwardNewton) instead of the closed form every tick
+    //#define DELTA_THUMB_NEWTON_FK 1
+
+//filter on the thumb position and on the thumb force (haplink_filters.h):
+//FILTER_NONE, FILTER_EMA (the old alpha = 0.4 smoothing), FILTER_BIQUAD,
+//FILTER_ONE_EURO, FILTER_ALPHA_BETA or FILTER_KALMAN_CV.
+//tools/report_filters.c compares them on recorded data
+    #define THUMB_POSITION_FILTER   FILTER_ALPHA_BETA
+    #define THUMB_FORCE_FILTER      FILTER_NONE
+
+//render the scene with a god-object proxy per contact point (hand_proxy.h)
+//instead of the penetration depth force, which pulls the point through thin
+//objects. tools/sim_hand_proxy.c compares them. Only the proxy renders the
+//friction of the objects (sceneSetFriction, tools/sim_hand_friction.c), and
+//not through the local models of HAND_SERVO_RATE_HZ
+    #define HAND_PROXY_RENDERING    1
+
+//passivity controller on the thumb and finger forces (hand_passivity.h): damping
+//of at most this many N s/m, only while the observer sees the environment give
+//back more energy than it took. Comment out to only observe (the 'passivity'
+//telemetry stream). tools/sim_passivity.c shows it on a stiff wall
+    #define HAND_PASSIVITY_MAX_DAMPING 2.0
+
+//render in a Timer 5 interrupt at this rate (hand_servo.h) from local contact
+//models that the main loop rebuilds from the scene as fast as it can, so the
+//scene never delays the motors. Comment out to do everything in the main loop.
+//Check "servo max" in the timing stream is well under the period
+    //#define HAND_SERVO_RATE_HZ      5000
+
+//the host runs the physics of the scene and streams a local contact model per
+//contact point (hand_host_models.h, host/hand_host_link.h); the device only
+//blends and renders them, and lets go softly if they stop. Turn the hand pose
+//stream up to the host rate ("r0 500 4l"). At COMM_BAUD_RATE 115200 one
+//contact point fits about 400 frames/s, 1 kHz with every limb needs 921600
+    //#define HAND_HOST_PHYSICS       1
+
+//swing the default sphere this many mm back and forth along x, a looped spline
+//over four waypoints (hand_motion.h), one swing every HAND_SPHERE_SWING_S.
+//The host can move any object instead with 'M' keyframe frames
+    //#define HAND_SPHERE_SWING_MM    10.0
+    #define HAND_SPHERE_SWING_S     2.0
+
+//a free sphere of this mass in kg in place of the default one (hand_grasp.h):
+//it has gravity and friction, starts on a table under SPHERE1 and the thumb
+//and fingers can pick it up; held too loosely it slips and falls back.
+//Gravity and the table in hand_virtual_environment.h, tools/sim_hand_grasp.c
+    //#define HAND_GRASP_OBJECT       0.1
+
+//serial link rate, must match BAUD_RATE in ProcessingHapticsHand/Configuration.pde
+    #define COMM_BAUD_RATE          115200
+
 // Haplink 2-DOF initial Offset in degrees:
 // These have to match the offset on your actual physical Haplink
 // Change these if you want to start from another position. 
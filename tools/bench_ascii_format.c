@@ -0,0 +1,154 @@
+/**
+  ******************************************************************************
+  * @file    bench_ascii_format.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host benchmark of haplink_ascii_format.c against snprintf. Checks
+  *          that every formatted value is byte-identical to "%.Nf", that a
+  *          line of huge values stays inside its buffer, and reports the
+  *          time per field.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/bench_ascii_format.c haplink_ascii_format.c -lm -o bench_ascii_format
+  *             ./bench_ascii_format
+  ******************************************************************************
+  */
+
+#include "haplink_ascii_format.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#define NUMBER_VALUES 200000
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// values like the ones the hand sends: mm with a few decimals, plus ties and edge cases
+static double randomValue( int i )
+{
+    static const double special[] = { 0.0, -0.0, 0.005, 0.125, -0.125, 2.675, 1.005,
+                                      0.5, 1.5, 2.5, -2.5, 45.41, 86.59, 122.73, -12.01,
+                                      1e-9, -1e-9, 99999.995, 4294967295.0, 1e12 };
+    int count = sizeof(special) / sizeof(special[0]);
+    if (i < count)
+    {
+        return special[i];
+    }
+    switch (i % 4)
+    {
+        case 0: return (rand() / (double)RAND_MAX - 0.5) * 400.0;        // positions
+        case 1: return (rand() % 40000 - 20000) / 100.0 + 0.005;         // near ties
+        case 2: return (rand() / (double)RAND_MAX - 0.5) * 2e-3;         // torques
+        default: return ldexp(rand() / (double)RAND_MAX, rand() % 60 - 30);
+    }
+}
+
+static int checkAndTime( const char * label, int isFloat, int decimals, const double * values )
+{
+    char expected[96];
+    char actual[96];
+    char * end;
+    int mismatches = 0;
+    double t0, tFast, tPrintf;
+    volatile int sink = 0;
+    int i;
+
+    for (i = 0; i < NUMBER_VALUES; i++)
+    {
+        double v = isFloat ? (double)(float)values[i] : values[i];
+        snprintf(expected, sizeof(expected), "%.*f", decimals, v);
+        end = isFloat ? appendFloat(actual, actual + sizeof(actual) - 1, (float)values[i], decimals) :
+                        appendDouble(actual, actual + sizeof(actual) - 1, values[i], decimals);
+        appendTerminator(end);
+        if (strcmp(expected, actual) != 0)
+        {
+            if (mismatches < 10)
+            {
+                printf("  mismatch %.17g: printf \"%s\" fast \"%s\"\n", v, expected, actual);
+            }
+            mismatches++;
+        }
+    }
+
+    t0 = nowSeconds();
+    for (i = 0; i < NUMBER_VALUES; i++)
+    {
+        sink += snprintf(expected, sizeof(expected), "%.*f", decimals, isFloat ? (double)(float)values[i] : values[i]);
+    }
+    tPrintf = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (i = 0; i < NUMBER_VALUES; i++)
+    {
+        end = isFloat ? appendFloat(actual, actual + sizeof(actual) - 1, (float)values[i], decimals) :
+                        appendDouble(actual, actual + sizeof(actual) - 1, values[i], decimals);
+        sink += (int)(end - actual);
+    }
+    tFast = nowSeconds() - t0;
+
+    printf("%-22s snprintf %7.1f ns  fast %7.1f ns  speedup %5.1fx  mismatches %d\n", label,
+           tPrintf * 1e9 / NUMBER_VALUES, tFast * 1e9 / NUMBER_VALUES, tPrintf / tFast, mismatches);
+    return mismatches;
+}
+
+int main( void )
+{
+    static double values[NUMBER_VALUES];
+    char line[32];
+    int failures = 0;
+    int i;
+
+    srand(1);
+    for (i = 0; i < NUMBER_VALUES; i++)
+    {
+        values[i] = randomValue(i);
+    }
+
+    failures += checkAndTime("float  %.2f (hand)", 1, 2, values);
+    failures += checkAndTime("float  %f", 1, 6, values);
+    failures += checkAndTime("double %lf (debug)", 0, 6, values);
+    failures += checkAndTime("double %.1lf (timing)", 0, 1, values);
+
+    for (i = -100000; i <= 100000; i += 7)
+    {
+        char expected[16];
+        snprintf(expected, sizeof(expected), "%i", i);
+        appendTerminator(appendInt(line, line + sizeof(line) - 1, i));
+        if (strcmp(expected, line) != 0)
+        {
+            failures++;
+        }
+    }
+    // 13 fields as in printProcessingHapticHand, each as long as it gets, in a 160 byte line
+    {
+        static const double huge[4] = { -3.4028235e38, 1e300, -1e308, 1e12 };
+        char guarded[160 + 16];
+        const char * const end = guarded + 160;
+        char * cursor = guarded;
+        int overrun = 0;
+
+        memset(guarded, 0x5A, sizeof(guarded));
+        for (i = 0; i < 13; i++)
+        {
+            cursor = (i & 1) ? appendDouble(cursor, end, huge[i % 4], 6) : appendFloat(cursor, end, (float)huge[i % 4], 2);
+            cursor = appendChar(cursor, end, '\t');
+        }
+        cursor = appendString(cursor, end, " \n");
+        for (i = 160; i < (int)sizeof(guarded); i++)
+        {
+            overrun |= (guarded[i] != 0x5A);
+        }
+        printf("13 huge fields in 160 bytes: %d written%s\n", (int)(cursor - guarded), overrun ? ", OVERRUN" : "");
+        printf("  starts \"%.*s\"\n", 60, guarded);
+        failures += overrun || (cursor != end);
+    }
+    printf("%s\n", failures ? "FAILED" : "all outputs byte-identical to snprintf");
+    return failures ? 1 : 0;
+}
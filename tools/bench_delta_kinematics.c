@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file    bench_delta_kinematics.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check and benchmark of delta_kinematics.c. The reference
+  *          functions below are copies of delta_calcForward and
+  *          DeltaThumbGetJacobian_OhioVersion as they were in delta_thumb.c
+  *          (DeltaThumb struct values filled in), the new kernels must
+  *          agree with them over the whole angle range and the analytic
+  *          Jacobian with finite differences of delta_calcForward. In the
+  *          thumb frame (x/y swapped, +50 mm z), as renderOutsideSphere
+  *          gets it from DeltaThumbGetJacobian_Fused, the torques for a
+  *          force must move the thumb along that force: the position
+  *          servo in delta_thumb.c drives a positive torque to a larger
+  *          angle, so torque_i = sum_j dp_j/dtheta_i F_j.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/bench_delta_kinematics.c delta_kinematics.c -lm -o bench_delta_kinematics
+  *             ./bench_delta_kinematics
+  *          The haptic mouse Jacobian only evaluates the sin/cos of the arm
+  *          angles now, the other joint angles come from algebra; add
+  *          -fno-builtin to also see what the trig of constants cost the
+  *          old code with a compiler that does not fold it.
+  ******************************************************************************
+  */
+
+#include "delta_kinematics.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define ANGLE_MIN_DEG   -40.0
+#define ANGLE_MAX_DEG   80.0
+#define ANGLE_STEPS     40
+#define BENCH_REPEATS   20
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Reference implementations ------------------------------------------------*/
+
+static int referenceCalcForward( double theta1, double theta2, double theta3, double *x0, double *y0, double *z0 )
+{
+    const double e = DELTA_END_EFFECTOR_RADIUS, f = DELTA_BASE_RADIUS;
+    const double re = DELTA_UPPER_LINK_LEN, rf = DELTA_LOWER_LINK_LEN;
+    const double sqrt3 = sqrt(3.0), pi = PI; // was 3.141592653, see checkFusedKernel
+    const double tan60 = sqrt3, sin30 = 0.5, tan30 = 1.0 / sqrt3;
+    double t = (f - e) * tan30 / 2;
+    double dtr = pi / (double)180.0;
+
+    theta1 *= dtr;
+    theta2 *= dtr;
+    theta3 *= dtr;
+
+    double y1 = -(t + rf * cos(theta1));
+    double z1 = -rf * sin(theta1);
+    double y2 = (t + rf * cos(theta2)) * sin30;
+    double x2 = y2 * tan60;
+    double z2 = -rf * sin(theta2);
+    double y3 = (t + rf * cos(theta3)) * sin30;
+    double x3 = -y3 * tan60;
+    double z3 = -rf * sin(theta3);
+    double dnm = (y2 - y1) * x3 - (y3 - y1) * x2;
+    double w1 = y1 * y1 + z1 * z1;
+    double w2 = x2 * x2 + y2 * y2 + z2 * z2;
+    double w3 = x3 * x3 + y3 * y3 + z3 * z3;
+    double a1 = (z2 - z1) * (y3 - y1) - (z3 - z1) * (y2 - y1);
+    double b1 = -((w2 - w1) * (y3 - y1) - (w3 - w1) * (y2 - y1)) / 2.0;
+    double a2 = -(z2 - z1) * x3 + (z3 - z1) * x2;
+    double b2 = ((w2 - w1) * x3 - (w3 - w1) * x2) / 2.0;
+    double a = a1 * a1 + a2 * a2 + dnm * dnm;
+    double b = 2 * (a1 * b1 + a2 * (b2 - y1 * dnm) - z1 * dnm * dnm);
+    double c = (b2 - y1 * dnm) * (b2 - y1 * dnm) + b1 * b1 + dnm * dnm * (z1 * z1 - re * re);
+    double d = b * b - (double)4.0 * a * c;
+    if (d < 0) return -1;
+    *z0 = -(double)0.5 * (b + sqrt(d)) / a;
+    *x0 = (a1 * *z0 + b1) / dnm;
+    *y0 = (a2 * *z0 + b2) / dnm;
+    return 0;
+}
+
+static void referenceJacobianOhio( double x, double y, double z, double theta1, double theta2, double theta3, double J[3][3] )
+{
+    static double a = DELTA_WB - DELTA_UP;
+    double b = DELTA_SP / 2 - (sqrt(3)/2) * DELTA_WB;
+    static double c = DELTA_WP - DELTA_WB/2;
+    static double L = DELTA_UPPER_LINK_LEN;
+
+    double J1x = x;
+    double J1y = y + a + L * cos(theta1);
+    double J1z = z + L * sin(theta1);
+    double J2x = 2 * (x + b) - sqrt(3) * L * cos(theta2);
+    double J2y = 2 * (y + c) - L * cos(theta2);
+    double J2z = 2 * (z + L * sin(theta2));
+    double J3x = 2 * (x - b) + sqrt(3) * L *cos(theta3);
+    double J3y = 2 * (y + c) - L * cos(theta3);
+    double J3z = 2 * (z + L * sin(theta3));
+    double Jqa = L * ((y + a) * sin(theta1) - z * cos(theta1));
+    double Jqb = -L * ((sqrt(3) * (x + b) + y + c) * sin(theta2) + 2 * z * cos(theta2));
+    double Jqc = L * ((sqrt(3) * (x - b) - y - c) * sin(theta3) - 2 * z *cos(theta3));
+    double det = (J1x*J2y*J3z - J1x*J3y*J2z - J2x*J1y*J3z + J2x*J3y*J1z + J3x*J1y*J2z - J3x*J2y*J1z);
+
+    J[0][0] = (Jqa*(J2y*J3z - J3y*J2z))/det;
+    J[0][1] = -(Jqa*(J2x*J3z - J3x*J2z))/det;
+    J[0][2] = (Jqa*(J2x*J3y - J3x*J2y))/det;
+    J[1][0] = -(Jqb*(J1y*J3z - J3y*J1z))/det;
+    J[1][1] = (Jqb*(J1x*J3z - J3x*J1z))/det;
+    J[1][2] = -(Jqb*(J1x*J3y - J3x*J1y))/det;
+    J[2][0] = (Jqc*(J1y*J2z - J2y*J1z))/det;
+    J[2][1] = -(Jqc*(J1x*J2z - J2x*J1z))/det;
+    J[2][2] = (Jqc*(J1x*J2y - J2x*J1y))/det;
+}
+
+/* what deltaThumbHandler + DeltaThumbGetJacobian_OhioVersion did per tick */
+static int referenceTick( double t1, double t2, double t3, double p[3], double J[3][3] )
+{
+    if (referenceCalcForward(RAD_TO_DEG(t1), RAD_TO_DEG(t2), RAD_TO_DEG(t3), &p[0], &p[1], &p[2]) != 0)
+    {
+        return -1;
+    }
+    referenceJacobianOhio(p[1], p[0], p[2] + DELTA_THUMB_Z_OFFSET, t1, t2, t3, J);
+    return 0;
+}
+
+/* haptic mouse chain as it was, with the trig of constants evaluated every call */
+static void referenceElbowPosition( double t1, double t2, double t3,
+                                    double *x1, double *y1, double *z1,
+                                    double *x2, double *y2, double *z2,
+                                    double *x3, double *y3, double *z3,
+                                    double *x, double *y, double *z,
+                                    double *theta_a1, double *theta_a2, double *theta_a3 )
+{
+    *theta_a1 = -(t1 - DELTA_THETA_OFFSET);
+    *theta_a2 = -(t2 - DELTA_THETA_OFFSET);
+    *theta_a3 = -(t3 - DELTA_THETA_OFFSET);
+
+    double dAprime = DELTA_BASE_RADIUS - DELTA_END_EFFECTOR_RADIUS;
+
+    *x1 = sin(DELTA_THETA_N1) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a1));
+    *y1 = cos(DELTA_THETA_N1) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a1));
+    *z1 = DELTA_LOWER_LINK_LEN * sin(*theta_a1);
+    *x2 = sin(DELTA_THETA_N2) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a2));
+    *y2 = cos(DELTA_THETA_N2) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a2));
+    *z2 = DELTA_LOWER_LINK_LEN * sin(*theta_a2);
+    *x3 = sin(DELTA_THETA_N3) * (dAprime + DELTA_LOWER_LINK_LEN * cos(*theta_a3));
+    *y3 = cos(DELTA_THETA_N3) * (-dAprime - DELTA_LOWER_LINK_LEN * cos(*theta_a3));
+    *z3 = DELTA_LOWER_LINK_LEN * sin(*theta_a3);
+
+    double w1 = pow(*y1, 2) + pow(*z1, 2);
+    double w2 = pow(*x2, 2) + pow(*y2, 2) + pow(*z2, 2);
+    double w3 = pow(*x3, 2) + pow(*y3, 2) + pow(*z3, 2);
+    double d = (*y2 - *y1) * (*x3) - (*y3 - *y1) * (*x2);
+    double a1 = ((*y3 - *y1) * (*z2 - *z1) - (*y2 - *y1) * (*z3 - *z1)) / d;
+    double b1 = ((*y2 - *y1) * (w3 - w1) - (*y3 - *y1) * (w2 - w1)) / (2 * d);
+    double a2 = ((*z3 - *z1) * (*x2) - (*z2 - *z1) * (*x3)) / d;
+    double b2 = ((w2 - w1) * (*x3) - (w3 - w1) * (*x2)) / (2 * d);
+    double r = DELTA_UPPER_LINK_LEN;
+    double A = pow(a1, 2) + pow(a2, 2) + 1;
+    double B = 2 * (a1 * b1 + a2 * (b2 - *y1) - *z1);
+    double C = pow(b1, 2) + pow((b2 - *y1), 2) + pow(*z1, 2) - pow(r, 2);
+
+    *z = (- B + sqrt(pow(B, 2) - 4.0 * A * C)) / (2.0 * A);
+    if (*z < 0)
+    {
+        *z = (- B - sqrt(pow(B, 2) - 4.0 * A * C)) / (2.0 * A);
+    }
+    *x = a1 * (*z) + b1;
+    *y = a2 * (*z) + b2;
+}
+
+static void referenceThetaii( double t1, double t2, double t3,
+                              double *theta1_1, double *theta1_2, double *theta1_3,
+                              double *theta2_1, double *theta2_2, double *theta2_3,
+                              double *theta3_1, double *theta3_2, double *theta3_3 )
+{
+    double x1, y1, z1, x2, y2, z2, x3, y3, z3, x, y, z;
+    double theta_a1, theta_a2, theta_a3;
+    referenceElbowPosition(t1, t2, t3, &x1, &y1, &z1, &x2, &y2, &z2, &x3, &y3, &z3, &x, &y, &z, &theta_a1, &theta_a2, &theta_a3);
+
+    double Ax1 = DELTA_BASE_RADIUS * cos(270.0 * PI / 180.0);
+    double Ay1 = DELTA_BASE_RADIUS * sin(270.0 * PI / 180.0);
+    double Az1 = 0;
+    double Ax2 = DELTA_BASE_RADIUS * cos(30.0 * PI / 180.0) * cos(DELTA_THETA_N2) + DELTA_BASE_RADIUS * sin(30.0 * PI / 180.0) * sin(DELTA_THETA_N2);
+    double Ay2 = - DELTA_BASE_RADIUS * cos(30.0 * PI / 180.0) * sin(DELTA_THETA_N2) + DELTA_BASE_RADIUS * sin(30.0 * PI / 180.0) * cos(DELTA_THETA_N2);
+    double Az2 = 0;
+    double Ax3 = DELTA_BASE_RADIUS * cos(150.0 * PI / 180.0) * cos(DELTA_THETA_N3) + DELTA_BASE_RADIUS * sin(150.0 * PI / 180.0) * sin(DELTA_THETA_N3);
+    double Ay3 = - DELTA_BASE_RADIUS * cos(150.0 * PI / 180.0) * sin(DELTA_THETA_N3) + DELTA_BASE_RADIUS * sin(150.0 * PI / 180.0) * cos(DELTA_THETA_N3);
+    double Az3 = 0;
+    double Bx1 = x1;
+    double Bz1 = z1;
+    double Bx2 = x2 * cos(DELTA_THETA_N2) + y2 * sin(DELTA_THETA_N2);
+    double Bz2 = z2;
+    double Bx3 = x3 * cos(DELTA_THETA_N3) + y3 * sin(DELTA_THETA_N3);
+    double Bz3 = z3;
+    double Cx1 = x;
+    double Cy1 = y;
+    double Cz1 = z;
+    double Cx2 = x * cos(DELTA_THETA_N2) + y * sin(DELTA_THETA_N2);
+    double Cy2 = - x * sin(DELTA_THETA_N2) + y * cos(DELTA_THETA_N2);
+    double Cz2 = z;
+    double Cx3 = x * cos(DELTA_THETA_N3) + y * sin(DELTA_THETA_N3);
+    double Cy3 = - x * sin(DELTA_THETA_N3) + y * cos(DELTA_THETA_N3);
+    double Cz3 = z;
+    double Distance1 = sqrt(pow(Ax1 - Cx1, 2) + pow(Ay1 - Cy1, 2) + pow(Az1 - Cz1, 2));
+    double Distance2 = sqrt(pow(Ax2 - Cx2, 2) + pow(Ay2 - Cy2, 2) + pow(Az2 - Cz2, 2));
+    double Distance3 = sqrt(pow(Ax3 - Cx3, 2) + pow(Ay3 - Cy3, 2) + pow(Az3 - Cz3, 2));
+
+    *theta1_1 = theta_a1;
+    *theta1_2 = theta_a2;
+    *theta1_3 = theta_a3;
+    *theta3_1 = fmod(PI + atan((Cz1 - Bz1) / (Cx1 - Bx1)), PI);
+    *theta3_2 = fmod(PI + atan((Cz2 - Bz2) / (Cx2 - Bx2)), PI);
+    *theta3_3 = fmod(PI + atan((Cz3 - Bz3) / (Cx3 - Bx3)), PI);
+    *theta2_1 = PI - acos(-(pow(Distance1,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_1)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_1)));
+    *theta2_2 = PI - acos(-(pow(Distance2,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_2)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_2)));
+    *theta2_3 = PI - acos(-(pow(Distance3,2) - pow(DELTA_LOWER_LINK_LEN, 2) - pow((DELTA_UPPER_LINK_LEN * sin(*theta3_3)),2)) / (2 * DELTA_LOWER_LINK_LEN * DELTA_UPPER_LINK_LEN * sin(*theta3_3)));
+}
+
+static void referenceJacobianMouse( double t1, double t2, double t3, double J[3][3] )
+{
+    double theta1_1, theta1_2, theta1_3, theta2_1, theta2_2, theta2_3, theta3_1, theta3_2, theta3_3;
+    referenceThetaii(t1, t2, t3, &theta1_1, &theta1_2, &theta1_3, &theta2_1, &theta2_2, &theta2_3, &theta3_1, &theta3_2, &theta3_3);
+
+    double J1x = - sin(theta3_1) * cos(theta2_1 + theta1_1) * sin(DELTA_THETA_N1) + cos(theta3_1) * cos(DELTA_THETA_N1);
+    double J1y = - sin(theta3_1) * cos(theta2_1 + theta1_1) * cos(DELTA_THETA_N1) - cos(theta3_1) * sin(DELTA_THETA_N1);
+    double J1z = sin(theta3_1) * sin(theta2_1 + theta1_1);
+    double J2x = - sin(theta3_2) * cos(theta2_2 + theta1_2) * sin(DELTA_THETA_N3) + cos(theta3_2) * cos(DELTA_THETA_N3);
+    double J2y = - sin(theta3_2) * cos(theta2_2 + theta1_2) * cos(DELTA_THETA_N3) - cos(theta3_2) * sin(DELTA_THETA_N3);
+    double J2z = sin(theta3_2) * sin(theta2_2 + theta1_2);
+    double J3x = - sin(theta3_3) * cos(theta2_3 + theta1_3) * sin(DELTA_THETA_N2) + cos(theta3_3) * cos(DELTA_THETA_N2);
+    double J3y = - sin(theta3_3) * cos(theta2_3 + theta1_3) * cos(DELTA_THETA_N2) - cos(theta3_3) * sin(DELTA_THETA_N2);
+    double J3z = sin(theta3_3) * sin(theta2_3 + theta1_3);
+    double Jqa = (DELTA_LOWER_LINK_LEN * sin(theta2_1) * sin(theta3_1));
+    double Jqb = (DELTA_LOWER_LINK_LEN * sin(theta2_2) * sin(theta3_2));
+    double Jqc = (DELTA_LOWER_LINK_LEN * sin(theta2_3) * sin(theta3_3));
+    double det = (J1x*J2y*J3z - J1x*J3y*J2z - J2x*J1y*J3z + J2x*J3y*J1z + J3x*J1y*J2z - J3x*J2y*J1z);
+
+    J[0][0] = (Jqa*(J2y*J3z - J3y*J2z))/det;
+    J[0][1] = -(Jqa*(J2x*J3z - J3x*J2z))/det;
+    J[0][2] = (Jqa*(J2x*J3y - J3x*J2y))/det;
+    J[1][0] = -(Jqb*(J1y*J3z - J3y*J1z))/det;
+    J[1][1] = (Jqb*(J1x*J3z - J3x*J1z))/det;
+    J[1][2] = -(Jqb*(J1x*J3y - J3x*J1y))/det;
+    J[2][0] = (Jqc*(J1y*J2z - J2y*J1z))/det;
+    J[2][1] = -(Jqc*(J1x*J2z - J2x*J1z))/det;
+    J[2][2] = (Jqc*(J1x*J2y - J2x*J1y))/det;
+}
+
+/* Checks --------------------------------------------------------------------*/
+
+static double relativeError( double a, double b )
+{
+    double scale = fabs(b) > 1.0 ? fabs(b) : 1.0;
+    return fabs(a - b) / scale;
+}
+
+static double matrixScale( double J[3][3] )
+{
+    double m = 1e-12;
+    int r, c;
+    for (r = 0; r < 3; r++)
+        for (c = 0; c < 3; c++)
+            if (fabs(J[r][c]) > m) m = fabs(J[r][c]);
+    return m;
+}
+
+/* the reference uses the exact PI: the old pi = 3.141592653 alone moves the
+   position by up to ~1e-8 relative, which would hide any real algebra mistake */
+static int checkFusedKernel( void )
+{
+    double worstPosition = 0.0, worstJacobian = 0.0, worstOhio = 0.0;
+    int points = 0, failures = 0;
+    int i, j, k, r, c;
+
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        double t1 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * i / (ANGLE_STEPS - 1));
+        double t2 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * j / (ANGLE_STEPS - 1));
+        double t3 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * k / (ANGLE_STEPS - 1));
+        double pRef[3], JOhioRef[3][3], JOhio[3][3], p[3], J[3][3], JSeparate[3][3];
+        int statusRef = referenceTick(t1, t2, t3, pRef, JOhioRef);
+        int status = deltaKinematicsForwardJacobian(t1, t2, t3, &p[0], &p[1], &p[2], J);
+
+        if (status != statusRef)
+        {
+            failures++;
+            continue;
+        }
+        if (status != 0) continue;
+        points++;
+        deltaKinematicsJacobian(t1, t2, t3, p[0], p[1], p[2], JSeparate);
+        deltaKinematicsJacobianOhio(pRef[1], pRef[0], pRef[2] + DELTA_THUMB_Z_OFFSET, t1, t2, t3, JOhio);
+        for (r = 0; r < 3; r++)
+        {
+            double e = relativeError(p[r], pRef[r]);
+            if (e > worstPosition) worstPosition = e;
+            for (c = 0; c < 3; c++)
+            {
+                e = fabs(J[r][c] - JSeparate[r][c]) / matrixScale(JSeparate);
+                if (e > worstJacobian) worstJacobian = e;
+                e = fabs(JOhio[r][c] - JOhioRef[r][c]) / matrixScale(JOhioRef);
+                if (e > worstOhio) worstOhio = e;
+            }
+        }
+    }
+    printf("fused kernel vs delta_calcForward + deltaKinematicsJacobian: %d poses, %d status mismatches\n", points, failures);
+    printf("  worst relative error: position %.2e, Jacobian %.2e, Ohio Jacobian %.2e\n",
+           worstPosition, worstJacobian, worstOhio);
+    return (failures == 0) && (worstPosition < 1e-12) && (worstJacobian < 1e-12) && (worstOhio < 1e-9);
+}
+
+/* the analytic Jacobian must be the derivative of delta_calcForward as it
+   was: J[i][j] = dp_j/dtheta_i, by central differences */
+static int checkAnalyticJacobian( void )
+{
+    const double h = 1e-5; // rad
+    double worst = 0.0;
+    int points = 0, i, j, k, m, c;
+
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        double t[3] =
+        {
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * i / (ANGLE_STEPS - 1)),
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * j / (ANGLE_STEPS - 1)),
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * k / (ANGLE_STEPS - 1))
+        };
+        double p[3], J[3][3], JDiff[3][3], plus[3], minus[3];
+        int reachable = 1;
+
+        if (referenceCalcForward(RAD_TO_DEG(t[0]), RAD_TO_DEG(t[1]), RAD_TO_DEG(t[2]), &p[0], &p[1], &p[2]) != 0) continue;
+        for (m = 0; m < 3; m++)
+        {
+            double tp[3] = { t[0], t[1], t[2] }, tm[3] = { t[0], t[1], t[2] };
+            tp[m] += h;
+            tm[m] -= h;
+            if ((referenceCalcForward(RAD_TO_DEG(tp[0]), RAD_TO_DEG(tp[1]), RAD_TO_DEG(tp[2]), &plus[0], &plus[1], &plus[2]) != 0) ||
+                (referenceCalcForward(RAD_TO_DEG(tm[0]), RAD_TO_DEG(tm[1]), RAD_TO_DEG(tm[2]), &minus[0], &minus[1], &minus[2]) != 0))
+            {
+                reachable = 0;
+                break;
+            }
+            for (c = 0; c < 3; c++)
+                JDiff[m][c] = (plus[c] - minus[c]) / (2 * h);
+        }
+        if (!reachable) continue; // on the edge of the workspace
+        if (matrixScale(JDiff) > 1e4) continue; // next to a singular pose
+
+        deltaKinematicsJacobian(t[0], t[1], t[2], p[0], p[1], p[2], J);
+        points++;
+        for (m = 0; m < 3; m++)
+            for (c = 0; c < 3; c++)
+                if (fabs(J[m][c] - JDiff[m][c]) / matrixScale(JDiff) > worst) worst = fabs(J[m][c] - JDiff[m][c]) / matrixScale(JDiff);
+    }
+    printf("analytic Jacobian vs finite differences of delta_calcForward: %d poses, worst relative error %.2e\n", points, worst);
+    return (points > 0) && (worst < 1e-6);
+}
+
+/* what renderOutsideSphere renders: the Jacobian in the thumb frame against
+   central differences of delta_calcForward moved to the thumb frame, and the
+   work of each force over the motion its torques make, which must be
+   positive. The Ohio Jacobian, rendered before, is measured the same way. */
+static int checkThumbFrameForce( void )
+{
+    static const double forces[6][3] = { { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 }, { -1, 0, 0 }, { 0, -1, 0 }, { 0, 0, -1 } };
+    const double h = 1e-5, step = 1e-6; // rad, rad per N mm
+    double worst = 0.0;
+    int points = 0, wrongWay = 0, wrongWayOhio = 0, i, j, k, m, c, f;
+
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        double t[3] =
+        {
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * i / (ANGLE_STEPS - 1)),
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * j / (ANGLE_STEPS - 1)),
+            DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * k / (ANGLE_STEPS - 1))
+        };
+        double raw[3], J[3][3], thumb[3], JThumb[3][3], JOhio[3][3], JDiff[3][3], plus[3], minus[3];
+        int reachable = 1;
+
+        if (deltaKinematicsForwardJacobian(t[0], t[1], t[2], &raw[0], &raw[1], &raw[2], J) != 0) continue;
+        deltaKinematicsToThumbFrame(raw, J, thumb, JThumb);
+        deltaKinematicsJacobianOhio(thumb[0], thumb[1], thumb[2], t[0], t[1], t[2], JOhio);
+        for (m = 0; m < 3; m++)
+        {
+            double tp[3] = { t[0], t[1], t[2] }, tm[3] = { t[0], t[1], t[2] }, p[3];
+            tp[m] += h;
+            tm[m] -= h;
+            if ((referenceCalcForward(RAD_TO_DEG(tp[0]), RAD_TO_DEG(tp[1]), RAD_TO_DEG(tp[2]), &p[0], &p[1], &p[2]) != 0))
+            {
+                reachable = 0;
+                break;
+            }
+            deltaKinematicsToThumbFrame(p, 0, plus, 0);
+            if ((referenceCalcForward(RAD_TO_DEG(tm[0]), RAD_TO_DEG(tm[1]), RAD_TO_DEG(tm[2]), &p[0], &p[1], &p[2]) != 0))
+            {
+                reachable = 0;
+                break;
+            }
+            deltaKinematicsToThumbFrame(p, 0, minus, 0);
+            for (c = 0; c < 3; c++)
+                JDiff[m][c] = (plus[c] - minus[c]) / (2 * h);
+        }
+        if (!reachable) continue; // on the edge of the workspace
+        if (matrixScale(JDiff) > 1e4) continue; // next to a singular pose
+        points++;
+        for (m = 0; m < 3; m++)
+            for (c = 0; c < 3; c++)
+                if (fabs(JThumb[m][c] - JDiff[m][c]) / matrixScale(JDiff) > worst) worst = fabs(JThumb[m][c] - JDiff[m][c]) / matrixScale(JDiff);
+
+        // torques as renderOutsideSphere computes them, the angles they move the motors by, the work of F
+        for (f = 0; f < 6; f++)
+        {
+            double work = 0.0, workOhio = 0.0;
+            for (m = 0; m < 3; m++)
+            {
+                double torque = 0.0, torqueOhio = 0.0;
+                for (c = 0; c < 3; c++)
+                {
+                    torque += JThumb[m][c] * forces[f][c];
+                    torqueOhio += JOhio[m][c] * forces[f][c];
+                }
+                for (c = 0; c < 3; c++)
+                {
+                    work += JDiff[m][c] * step * torque * forces[f][c];
+                    workOhio += JDiff[m][c] * step * torqueOhio * forces[f][c];
+                }
+            }
+            if (work <= 0.0) wrongWay++;
+            if (workOhio <= 0.0) wrongWayOhio++;
+        }
+    }
+    printf("thumb frame Jacobian vs finite differences: %d poses, worst relative error %.2e\n", points, worst);
+    printf("  forces along +-x, +-y, +-z that move the thumb against themselves: %d (Ohio Jacobian: %d of %d)\n",
+           wrongWay, wrongWayOhio, 6 * points);
+    return (points > 0) && (worst < 1e-6) && (wrongWay == 0);
+}
+
+/* folded constants and the trig-free joint angles must give the same
+   haptic mouse Jacobian and joint angles */
+static int checkFoldedMouseJacobian( void )
+{
+    double worst = 0.0, worstAngle = 0.0;
+    int points = 0, i, j, k, r, c;
+
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        double t1 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * i / (ANGLE_STEPS - 1));
+        double t2 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * j / (ANGLE_STEPS - 1));
+        double t3 = DEG_TO_RAD(ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * k / (ANGLE_STEPS - 1));
+        double JRef[3][3], J[3][3], scale, angleRef[3][3], angle[3][3];
+        int finite = 1;
+
+        referenceJacobianMouse(t1, t2, t3, JRef);
+        deltaKinematicsJacobianMouse(t1, t2, t3, J);
+        referenceThetaii(t1, t2, t3, &angleRef[0][0], &angleRef[0][1], &angleRef[0][2], &angleRef[1][0],
+                         &angleRef[1][1], &angleRef[1][2], &angleRef[2][0], &angleRef[2][1], &angleRef[2][2]);
+        deltaKinematicsThetaii(t1, t2, t3, angle[0], angle[1], angle[2]);
+        for (r = 0; r < 3; r++)
+            for (c = 0; c < 3; c++)
+                if (!isfinite(JRef[r][c]) || !isfinite(angleRef[r][c])) finite = 0;
+        if (!finite) continue; // acos out of range, both give nan
+        for (r = 0; r < 3; r++)
+            for (c = 0; c < 3; c++)
+                if (fabs(angle[r][c] - angleRef[r][c]) > worstAngle) worstAngle = fabs(angle[r][c] - angleRef[r][c]);
+        scale = matrixScale(JRef);
+        if (scale > 1e6) continue; // singular pose, not comparable
+        points++;
+        for (r = 0; r < 3; r++)
+            for (c = 0; c < 3; c++)
+                if (fabs(J[r][c] - JRef[r][c]) / scale > worst) worst = fabs(J[r][c] - JRef[r][c]) / scale;
+    }
+    printf("folded haptic mouse Jacobian vs original: %d poses, worst relative error %.2e, joint angles %.2e rad\n",
+           points, worst, worstAngle);
+    return (points > 0) && (worst < 1e-9) && (worstAngle < 1e-9);
+}
+
+/* Benchmark -----------------------------------------------------------------*/
+
+static void benchmark( void )
+{
+    double p[3], J[3][3], sink = 0.0, start, tRef, tFused;
+    int calls = 0, repeat, i, j, k;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        if (referenceTick(DEG_TO_RAD(i), DEG_TO_RAD(j), DEG_TO_RAD(k), p, J) == 0) sink += p[2] + J[1][1];
+        calls++;
+    }
+    tRef = (nowSeconds() - start) / calls;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        if (deltaKinematicsForwardJacobian(DEG_TO_RAD(i), DEG_TO_RAD(j), DEG_TO_RAD(k), &p[0], &p[1], &p[2], J) == 0) sink += p[2] + J[1][1];
+    }
+    tFused = (nowSeconds() - start) / calls;
+
+    printf("per tick: forward + Ohio Jacobian (before) %.1f ns, fused analytic %.1f ns (%.2fx)  [%g]\n",
+           tRef * 1e9, tFused * 1e9, tRef / tFused, sink);
+}
+
+static void benchmarkMouseJacobian( void )
+{
+    double J[3][3], sink = 0.0, start, tRef, tFolded;
+    int calls = 0, repeat, i, j, k;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        referenceJacobianMouse(DEG_TO_RAD(i), DEG_TO_RAD(j), DEG_TO_RAD(k), J);
+        sink += J[1][1];
+        calls++;
+    }
+    tRef = (nowSeconds() - start) / calls;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    for (i = 0; i < ANGLE_STEPS; i++)
+    for (j = 0; j < ANGLE_STEPS; j++)
+    for (k = 0; k < ANGLE_STEPS; k++)
+    {
+        deltaKinematicsJacobianMouse(DEG_TO_RAD(i), DEG_TO_RAD(j), DEG_TO_RAD(k), J);
+        sink += J[1][1];
+    }
+    tFolded = (nowSeconds() - start) / calls;
+
+    printf("per call: haptic mouse Jacobian %.1f ns, folded %.1f ns (%.2fx)  [%g]\n",
+           tRef * 1e9, tFolded * 1e9, tRef / tFolded, sink);
+}
+
+int main( void )
+{
+    int ok = checkFusedKernel();
+    ok = checkAnalyticJacobian() && ok;
+    ok = checkThumbFrameForce() && ok;
+    ok = checkFoldedMouseJacobian() && ok;
+    benchmark();
+    benchmarkMouseJacobian();
+    printf(ok ? "PASS\n" : "FAIL\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,247 @@
+/**
+  ******************************************************************************
+  * @file    bench_delta_newton.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host comparison of the warm-started Newton forward kinematics
+  *          (deltaKinematicsForwardNewton) with the closed form that
+  *          deltaThumbHandler runs every tick, over thumb trajectories.
+  *          Recorded trajectories are logs of the Processing stream (one
+  *          line per tick, tab separated, thumb x y z first, e.g. captured
+  *          with the serial monitor); they are turned back into motor
+  *          angles with the inverse kinematics. Without a file three
+  *          synthetic 1 kHz trajectories are used (slow sweep, fast flick,
+  *          tremor on a still hand).
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/bench_delta_newton.c delta_kinematics.c -lm -o bench_delta_newton
+  *             ./bench_delta_newton [processing_log.txt ...]
+  ******************************************************************************
+  */
+
+#include "delta_kinematics.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define MAX_TICKS       200000
+#define TICK_RATE_HZ    1000.0
+#define BENCH_REPEATS   20
+#define WORKSPACE_MIDDLE_Z  -10.0   // thumb frame, motors at about 15 deg
+
+typedef struct {
+    const char *name;
+    int count;
+    double theta[MAX_TICKS][3];
+} Trajectory;
+
+static Trajectory trajectory;
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+/* Trajectories --------------------------------------------------------------*/
+
+// thumb frame (as streamed) to motor angles, see deltaThumbHandler
+static int addThumbPose( double x, double y, double z )
+{
+    double *theta;
+
+    if (trajectory.count >= MAX_TICKS)
+    {
+        return -1;
+    }
+    theta = trajectory.theta[trajectory.count];
+    if (deltaKinematicsInverse(y, x, z - DELTA_THUMB_Z_OFFSET, &theta[0], &theta[1], &theta[2]) != 0)
+    {
+        return -1;
+    }
+    trajectory.count++;
+    return 0;
+}
+
+static int loadProcessingLog( const char *path )
+{
+    char line[512];
+    double x, y, z;
+    int skipped = 0;
+    FILE *file = fopen(path, "r");
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    trajectory.name = path;
+    trajectory.count = 0;
+    while (fgets(line, sizeof(line), file) != NULL)
+    {
+        if ((sscanf(line, "%lf %lf %lf", &x, &y, &z) != 3) || (addThumbPose(x, y, z) != 0))
+        {
+            skipped++;
+        }
+    }
+    fclose(file);
+    if (skipped > 0)
+    {
+        printf("%s: skipped %d lines (not a pose or out of reach)\n", path, skipped);
+    }
+    return (trajectory.count > 1) ? 0 : -1;
+}
+
+// thumb frame poses around the middle of the workspace
+static void makeSynthetic( int which )
+{
+    static const char *names[3] = { "synthetic slow sweep", "synthetic fast flick", "synthetic tremor" };
+    int i, n = 10 * (int)TICK_RATE_HZ;
+
+    trajectory.name = names[which];
+    trajectory.count = 0;
+    for (i = 0; i < n; i++)
+    {
+        double s = i / TICK_RATE_HZ;
+        double x = 0.0, y = 0.0, z = 0.0;
+        if (which == 0)
+        {
+            // 10 mm circles, one every 4 s, slow up and down
+            x = 10.0 * cos(2 * PI * s / 4.0);
+            y = 10.0 * sin(2 * PI * s / 4.0);
+            z = 5.0 * sin(2 * PI * s / 10.0);
+        }
+        else if (which == 1)
+        {
+            // 15 mm flicks at 3 Hz, up to 280 mm/s
+            x = 15.0 * sin(2 * PI * 3.0 * s);
+            y = 6.0 * sin(2 * PI * 1.3 * s);
+            z = 8.0 * sin(2 * PI * 2.1 * s + 1.0);
+        }
+        else
+        {
+            // still hand, 0.2 mm 9 Hz tremor plus a bit of encoder noise
+            x = 3.0 + 0.2 * sin(2 * PI * 9.0 * s) + 0.01 * (rand() / (double)RAND_MAX - 0.5);
+            y = -2.0 + 0.2 * cos(2 * PI * 9.0 * s) + 0.01 * (rand() / (double)RAND_MAX - 0.5);
+            z = 0.1 * sin(2 * PI * 7.0 * s);
+        }
+        addThumbPose(x, y, WORKSPACE_MIDDLE_Z + z);
+    }
+}
+
+/* Comparison ----------------------------------------------------------------*/
+
+static int compare( void )
+{
+    double closed[3], newton[3], J[3][3], JClosed[3][3];
+    double worstPosition = 0.0, worstJacobian = 0.0;
+    int histogram[DELTA_NEWTON_MAX_ITERATIONS + 2] = { 0 };
+    int hasGuess = 0, i, a, b, steps;
+
+    for (i = 0; i < trajectory.count; i++)
+    {
+        const double *t = trajectory.theta[i];
+        if (deltaKinematicsForward(t[0], t[1], t[2], &closed[0], &closed[1], &closed[2]) != 0)
+        {
+            hasGuess = 0;
+            continue;
+        }
+        steps = deltaKinematicsForwardNewton(t[0], t[1], t[2], newton, hasGuess, J);
+        hasGuess = (steps >= 0);
+        histogram[steps + 1]++;
+
+        // Jacobian of the exact pose, from a cold start
+        double exact[3];
+        deltaKinematicsForwardNewton(t[0], t[1], t[2], exact, 0, JClosed);
+        for (a = 0; a < 3; a++)
+        {
+            if (fabs(newton[a] - closed[a]) > worstPosition) worstPosition = fabs(newton[a] - closed[a]);
+            for (b = 0; b < 3; b++)
+            {
+                double error = fabs(J[a][b] - JClosed[a][b]) / (1.0 + fabs(JClosed[a][b]));
+                if (error > worstJacobian) worstJacobian = error;
+            }
+        }
+    }
+
+    printf("%s, %d ticks\n", trajectory.name, trajectory.count);
+    printf("  closed form %d, newton 1 step %d, 2 steps %d, 3 steps %d, no point %d\n",
+           histogram[1], histogram[2], histogram[3], histogram[4], histogram[0]);
+    printf("  worst position error %.2e mm, worst Jacobian error %.2e\n", worstPosition, worstJacobian);
+    return (worstPosition < 1e-4) && (worstJacobian < 1e-2);
+}
+
+static void benchmark( void )
+{
+    double p[3], J[3][3], sink = 0.0, start, tClosed, tClosedOnly, tNewton;
+    int repeat, i, hasGuess;
+    long calls = (long)BENCH_REPEATS * trajectory.count;
+
+    // what deltaThumbHandler does by default: closed form + analytic Jacobian
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+        for (i = 0; i < trajectory.count; i++)
+        {
+            const double *t = trajectory.theta[i];
+            if (deltaKinematicsForwardJacobian(t[0], t[1], t[2], &p[0], &p[1], &p[2], J) == 0) sink += p[2] + J[1][1];
+        }
+    tClosed = (nowSeconds() - start) / calls;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+        for (i = 0; i < trajectory.count; i++)
+        {
+            const double *t = trajectory.theta[i];
+            if (deltaKinematicsForward(t[0], t[1], t[2], &p[0], &p[1], &p[2]) == 0) sink += p[2];
+        }
+    tClosedOnly = (nowSeconds() - start) / calls;
+
+    start = nowSeconds();
+    for (repeat = 0; repeat < BENCH_REPEATS; repeat++)
+    {
+        hasGuess = 0;
+        for (i = 0; i < trajectory.count; i++)
+        {
+            const double *t = trajectory.theta[i];
+            hasGuess = (deltaKinematicsForwardNewton(t[0], t[1], t[2], p, hasGuess, J) >= 0);
+            sink += p[2] + J[1][1];
+        }
+    }
+    tNewton = (nowSeconds() - start) / calls;
+
+    printf("  per tick: closed form + Jacobian %.1f ns, closed form only %.1f ns, newton + Jacobian %.1f ns  [%g]\n",
+           tClosed * 1e9, tClosedOnly * 1e9, tNewton * 1e9, sink);
+}
+
+int main( int argc, char **argv )
+{
+    int ok = 1, i;
+
+    if (argc > 1)
+    {
+        for (i = 1; i < argc; i++)
+        {
+            if (loadProcessingLog(argv[i]) != 0)
+            {
+                printf("%s: no usable poses\n", argv[i]);
+                ok = 0;
+                continue;
+            }
+            ok = compare() && ok;
+            benchmark();
+        }
+    }
+    else
+    {
+        for (i = 0; i < 3; i++)
+        {
+            makeSynthetic(i);
+            ok = compare() && ok;
+            benchmark();
+        }
+    }
+    printf("%s\n", ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
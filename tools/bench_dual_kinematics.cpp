@@ -0,0 +1,211 @@
+/**
+  ******************************************************************************
+  * @file    bench_dual_kinematics.cpp
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check and benchmark of the dual number kinematics
+  *          (dual_number.h, limb_kinematics.h). The paddle reference below is
+  *          the hand written position and Jacobian the finger table used
+  *          before (L_A, L_B, CX, CY of haplink_position.h), the delta one is
+  *          deltaKinematicsForwardJacobian. Both must agree with the
+  *          templates run on Dual<double, N>, and the dual versions should
+  *          cost about as much.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. -c delta_kinematics.c -o delta_kinematics.o
+  *             g++ -O2 -I. tools/bench_dual_kinematics.cpp delta_kinematics.o -lm -o bench_dual_kinematics
+  *             ./bench_dual_kinematics
+  ******************************************************************************
+  */
+
+#include "limb_kinematics.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define PADDLE_L_A      65.0
+#define PADDLE_L_B      55.0
+#define PADDLE_CX       0.0
+#define PADDLE_CY       0.0
+
+#define ANGLE_MIN_DEG   -40.0
+#define ANGLE_MAX_DEG   80.0
+#define ANGLE_STEPS     40
+#define BENCH_REPEATS   20
+#define TOLERANCE       1e-9    // relative
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double relativeError( double a, double b )
+{
+    return fabs(a - b) / (fabs(b) > 1.0 ? fabs(b) : 1.0);
+}
+
+/* Reference implementation -------------------------------------------------*/
+
+static void referencePaddle( double tildethetaA, double tildethetaB, double *rx, double *ry, double J[2][2] )
+{
+    double sinA = sin(tildethetaA), cosA = cos(tildethetaA);
+    double px = -PADDLE_L_A*sinA + PADDLE_CX;
+    double py = PADDLE_L_A*cosA + PADDLE_CY;
+
+    double tildethetaAB = tildethetaA + tildethetaB;
+    double sinAB = sin(tildethetaAB), cosAB = cos(tildethetaAB);
+    *rx = -PADDLE_L_B*sinAB + px;
+    *ry = PADDLE_L_B*cosAB + py;
+
+    J[0][0] = -PADDLE_L_B*cosAB - PADDLE_L_A*cosA;
+    J[0][1] = -PADDLE_L_B*cosAB;
+    J[1][0] = -PADDLE_L_B*sinAB - PADDLE_L_A*sinA;
+    J[1][1] = -PADDLE_L_B*sinAB;
+}
+
+static const PaddleGeometry geometry = { PADDLE_L_A, PADDLE_L_B, PADDLE_CX, PADDLE_CY };
+
+static void dualPaddle( double tildethetaA, double tildethetaB, double *rx, double *ry, double J[2][2] )
+{
+    typedef Dual<double, 2> D;
+    D x, y;
+    paddleForward(D::variable(tildethetaA, 0), D::variable(tildethetaB, 1), geometry, x, y);
+    *rx = x.v;
+    *ry = y.v;
+    J[0][0] = x.d[0]; J[0][1] = x.d[1];
+    J[1][0] = y.d[0]; J[1][1] = y.d[1];
+}
+
+// J[i][j] = d p_j / d theta_i, as deltaKinematicsForwardJacobian
+static int dualDelta( double theta1, double theta2, double theta3, double p[3], double J[3][3] )
+{
+    typedef Dual<double, 3> D;
+    D x, y, z;
+    if (deltaForward(D::variable(theta1, 0), D::variable(theta2, 1), D::variable(theta3, 2), x, y, z) != 0)
+        return -1;
+    p[0] = x.v; p[1] = y.v; p[2] = z.v;
+    for (int i = 0; i < 3; i++)
+    {
+        J[i][0] = x.d[i];
+        J[i][1] = y.d[i];
+        J[i][2] = z.d[i];
+    }
+    return 0;
+}
+
+static double angleAt( int k )
+{
+    return (ANGLE_MIN_DEG + (ANGLE_MAX_DEG - ANGLE_MIN_DEG) * k / (ANGLE_STEPS - 1)) * M_PI / 180.0;
+}
+
+int main( void )
+{
+    double maxPaddle = 0.0, maxDelta = 0.0;
+    int deltaChecked = 0;
+
+    /* Agreement */
+    for (int a = 0; a < ANGLE_STEPS; a++)
+        for (int b = 0; b < ANGLE_STEPS; b++)
+        {
+            double r0x, r0y, J0[2][2], r1x, r1y, J1[2][2];
+            referencePaddle(angleAt(a), angleAt(b), &r0x, &r0y, J0);
+            dualPaddle(angleAt(a), angleAt(b), &r1x, &r1y, J1);
+            double e = fmax(relativeError(r1x, r0x), relativeError(r1y, r0y));
+            for (int i = 0; i < 2; i++)
+                for (int j = 0; j < 2; j++)
+                    e = fmax(e, relativeError(J1[i][j], J0[i][j]));
+            maxPaddle = fmax(maxPaddle, e);
+        }
+
+    for (int a = 0; a < ANGLE_STEPS; a++)
+        for (int b = 0; b < ANGLE_STEPS; b++)
+            for (int c = 0; c < ANGLE_STEPS; c++)
+            {
+                double p0[3], J0[3][3], p1[3], J1[3][3];
+                int ok0 = deltaKinematicsForwardJacobian(angleAt(a), angleAt(b), angleAt(c),
+                                                         &p0[0], &p0[1], &p0[2], J0);
+                int ok1 = dualDelta(angleAt(a), angleAt(b), angleAt(c), p1, J1);
+                if (ok0 != ok1)
+                {
+                    maxDelta = INFINITY;
+                    continue;
+                }
+                if (ok0 != 0) continue;
+                deltaChecked++;
+                double e = 0.0;
+                for (int i = 0; i < 3; i++)
+                {
+                    e = fmax(e, relativeError(p1[i], p0[i]));
+                    for (int j = 0; j < 3; j++)
+                        e = fmax(e, relativeError(J1[i][j], J0[i][j]));
+                }
+                maxDelta = fmax(maxDelta, e);
+            }
+
+    printf("paddle: max relative error %.3g over %d poses\n", maxPaddle, ANGLE_STEPS * ANGLE_STEPS);
+    printf("delta:  max relative error %.3g over %d poses\n", maxDelta, deltaChecked);
+
+    /* Timing */
+    volatile double sink = 0.0;
+    double t0, tRefPaddle, tDualPaddle, tRefDelta, tDualDelta;
+    int paddleCalls = BENCH_REPEATS * 50 * ANGLE_STEPS * ANGLE_STEPS;
+    int deltaCalls = BENCH_REPEATS * ANGLE_STEPS * ANGLE_STEPS * ANGLE_STEPS;
+
+    t0 = nowSeconds();
+    for (int r = 0; r < BENCH_REPEATS * 50; r++)
+        for (int a = 0; a < ANGLE_STEPS; a++)
+            for (int b = 0; b < ANGLE_STEPS; b++)
+            {
+                double rx, ry, J[2][2];
+                referencePaddle(angleAt(a), angleAt(b), &rx, &ry, J);
+                sink += rx + J[1][1];
+            }
+    tRefPaddle = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int r = 0; r < BENCH_REPEATS * 50; r++)
+        for (int a = 0; a < ANGLE_STEPS; a++)
+            for (int b = 0; b < ANGLE_STEPS; b++)
+            {
+                double rx, ry, J[2][2];
+                dualPaddle(angleAt(a), angleAt(b), &rx, &ry, J);
+                sink += rx + J[1][1];
+            }
+    tDualPaddle = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int r = 0; r < BENCH_REPEATS; r++)
+        for (int a = 0; a < ANGLE_STEPS; a++)
+            for (int b = 0; b < ANGLE_STEPS; b++)
+                for (int c = 0; c < ANGLE_STEPS; c++)
+                {
+                    double x, y, z, J[3][3];
+                    deltaKinematicsForwardJacobian(angleAt(a), angleAt(b), angleAt(c), &x, &y, &z, J);
+                    sink += z + J[2][2];
+                }
+    tRefDelta = nowSeconds() - t0;
+
+    t0 = nowSeconds();
+    for (int r = 0; r < BENCH_REPEATS; r++)
+        for (int a = 0; a < ANGLE_STEPS; a++)
+            for (int b = 0; b < ANGLE_STEPS; b++)
+                for (int c = 0; c < ANGLE_STEPS; c++)
+                {
+                    double p[3], J[3][3];
+                    dualDelta(angleAt(a), angleAt(b), angleAt(c), p, J);
+                    sink += p[2] + J[2][2];
+                }
+    tDualDelta = nowSeconds() - t0;
+
+    printf("paddle: hand written %6.1f ns/call, dual %6.1f ns/call\n",
+           tRefPaddle * 1e9 / paddleCalls, tDualPaddle * 1e9 / paddleCalls);
+    printf("delta:  analytic     %6.1f ns/call, dual %6.1f ns/call\n",
+           tRefDelta * 1e9 / deltaCalls, tDualDelta * 1e9 / deltaCalls);
+
+    int pass = maxPaddle < TOLERANCE && maxDelta < TOLERANCE && deltaChecked > 0;
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
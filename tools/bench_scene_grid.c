@@ -0,0 +1,148 @@
+/**
+  ******************************************************************************
+  * @file    bench_scene_grid.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check and benchmark of the scene broad phase (hand_scene.c).
+  *          Random scenes of 10 to 1000 small primitives in a 300 mm cube
+  *          plus a table (half space), three contact points moving along
+  *          smooth paths at 1 kHz. Every tick is queried twice: testing
+  *          every object (no grid) and through sceneBuildGrid; the forces
+  *          and contact counts must agree. Prints the time per tick of both,
+  *          the objects actually tested per point and how often a point
+  *          stayed in its cached cell.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. -DSCENE_MAX_OBJECTS=1024 tools/bench_scene_grid.c hand_scene.c hand_sdf.c -lm -o bench_scene_grid
+  *             ./bench_scene_grid
+  ******************************************************************************
+  */
+
+#include "hand_scene.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SCENE_HALF_SIZE     150.0f  // mm
+#define OBJECT_MIN_SIZE     3.0f    // mm
+#define OBJECT_MAX_SIZE     12.0f
+#define POINTS              3
+#define TICKS               20000   // 20 s at 1 kHz
+#define TOLERANCE           1e-3f   // N scale of the forces is ~1, float sums in another order
+
+static Scene bruteScene, gridScene;
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float randomIn( float lo, float hi )
+{
+    return lo + (hi - lo) * (float)rand() / (float)RAND_MAX;
+}
+
+static void buildScene( Scene *scene, int objects )
+{
+    sceneClear(scene);
+    sceneAddHalfSpace(scene, 0.0f, 0.0f, -SCENE_HALF_SIZE, 0.0f, 0.0f, 1.0f, 1.0f);
+    while (scene->count < objects)
+    {
+        float x = randomIn(-SCENE_HALF_SIZE, SCENE_HALF_SIZE);
+        float y = randomIn(-SCENE_HALF_SIZE, SCENE_HALF_SIZE);
+        float z = randomIn(-SCENE_HALF_SIZE, SCENE_HALF_SIZE);
+        float r = randomIn(OBJECT_MIN_SIZE, OBJECT_MAX_SIZE);
+        float k = randomIn(0.5f, 2.0f);
+        switch (rand() % 4)
+        {
+            case 0: sceneAddSphere(scene, x, y, z, r, k); break;
+            case 1: sceneAddBox(scene, x, y, z, r, randomIn(OBJECT_MIN_SIZE, OBJECT_MAX_SIZE), r * 0.5f, k); break;
+            case 2: sceneAddCapsule(scene, x, y, z, x + r, y - r, z + 2 * r, r * 0.5f, k); break;
+            case 3: sceneAddCylinder(scene, x, y, z, x, y, z + 2 * r, r, k); break;
+        }
+    }
+}
+
+// smooth path through the scene, different for every point, up to ~0.4 m/s
+static void pathPoint( int j, int tick, float point[3] )
+{
+    float t = tick * 0.001f;
+    point[0] = 0.9f * SCENE_HALF_SIZE * sinf(0.7f * t + j);
+    point[1] = 0.9f * SCENE_HALF_SIZE * sinf(0.9f * t + 2.0f * j);
+    point[2] = 0.9f * SCENE_HALF_SIZE * sinf(1.3f * t + 3.0f * j) - 0.1f * SCENE_HALF_SIZE;
+}
+
+static int runScene( int objects )
+{
+    float points[POINTS][3], bruteForces[POINTS][3], gridForces[POINTS][3];
+    int bruteContacts[POINTS], gridContacts[POINTS];
+    double bruteTime = 0.0, gridTime = 0.0, t0;
+    long tested = 0, hits = 0, touching = 0;
+    float worst = 0.0f;
+    int lastCell[POINTS] = { -1, -1, -1 };
+    int mismatches = 0, tick, j, k;
+
+    srand(objects);
+    buildScene(&bruteScene, objects);
+    gridScene = bruteScene;
+    if (sceneBuildGrid(&gridScene) != 0)
+    {
+        printf("%5d objects: grid full (SCENE_GRID_MAX_REFS)\n", objects);
+        return 0;
+    }
+
+    for (tick = 0; tick < TICKS; tick++)
+    {
+        for (j = 0; j < POINTS; j++) pathPoint(j, tick, points[j]);
+
+        t0 = nowSeconds();
+        sceneQueryPoints(&bruteScene, POINTS, points, bruteForces, bruteContacts);
+        bruteTime += nowSeconds() - t0;
+
+        t0 = nowSeconds();
+        sceneQueryPoints(&gridScene, POINTS, points, gridForces, gridContacts);
+        gridTime += nowSeconds() - t0;
+
+        for (j = 0; j < POINTS; j++)
+        {
+            int cell = gridScene.lastCell[j];
+            tested += gridScene.gridStart[cell + 1] - gridScene.gridStart[cell] + gridScene.unboundedCount;
+            hits += (cell == lastCell[j]);
+            lastCell[j] = cell;
+            touching += (bruteContacts[j] > 0);
+            if (bruteContacts[j] != gridContacts[j]) mismatches++;
+            for (k = 0; k < 3; k++)
+            {
+                float e = fabsf(bruteForces[j][k] - gridForces[j][k]);
+                if (e > worst) worst = e;
+            }
+        }
+    }
+
+    printf("%5d objects: all %8.1f ns/tick, grid %7.1f ns/tick (x%5.1f), %5.1f tested/point, "
+           "cell cache %4.1f%%, in contact %4.1f%%, max force diff %.2g\n",
+           objects, bruteTime * 1e9 / TICKS, gridTime * 1e9 / TICKS, bruteTime / gridTime,
+           (double)tested / (TICKS * POINTS), 100.0 * hits / (TICKS * POINTS),
+           100.0 * touching / (TICKS * POINTS), worst);
+    return (mismatches == 0) && (worst < TOLERANCE);
+}
+
+int main( void )
+{
+    static const int sizes[] = { 10, 30, 100, 300, 1000 };
+    int pass = 1;
+    unsigned i;
+
+    printf("grid %d^3 cells, %d contact points, %d ticks\n", SCENE_GRID_N, POINTS, TICKS);
+    for (i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        if (sizes[i] > SCENE_MAX_OBJECTS) break;
+        pass &= runScene(sizes[i]);
+    }
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
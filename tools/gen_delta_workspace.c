@@ -0,0 +1,250 @@
+/**
+  ******************************************************************************
+  * @file    gen_delta_workspace.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Writes delta_workspace_table.c, the flash workspace map of the
+  *          delta thumb (see delta_workspace.h). Each voxel is checked at its
+  *          center and its 8 corners: it is reachable if inverse kinematics
+  *          succeeds inside the joint range at any of them, and the level is
+  *          the worst inverse condition number of the analytic Jacobian over
+  *          the points that can be reached. The table is then checked the
+  *          other way, by sampling the joint range and looking up the
+  *          forward kinematics of each sample (none may land in a voxel
+  *          marked unreachable), and compared with the map that was compiled
+  *          in (delta_workspace_table.c as it was before the run).
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/gen_delta_workspace.c delta_workspace.c delta_workspace_table.c delta_kinematics.c -lm -o gen_delta_workspace
+  *             ./gen_delta_workspace [delta_workspace_table.c]
+  ******************************************************************************
+  */
+
+#include "delta_kinematics.h"
+#include "delta_workspace.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define JOINT_SAMPLES   200000
+
+static uint8_t table[DELTA_WORKSPACE_BYTES];
+
+/* Conditioning --------------------------------------------------------------*/
+
+/* eigenvalues of a symmetric 3x3 matrix, Jacobi rotations */
+static void symmetricEigenvalues( double A[3][3], double lambda[3] )
+{
+    int sweep, p, q, k;
+
+    for (sweep = 0; sweep < 50; sweep++)
+    {
+        double off = A[0][1] * A[0][1] + A[0][2] * A[0][2] + A[1][2] * A[1][2];
+        if (off < 1e-24 * (A[0][0] * A[0][0] + A[1][1] * A[1][1] + A[2][2] * A[2][2]))
+        {
+            break;
+        }
+        for (p = 0; p < 2; p++)
+            for (q = p + 1; q < 3; q++)
+            {
+                if (A[p][q] == 0.0) continue;
+                double theta = (A[q][q] - A[p][p]) / (2.0 * A[p][q]);
+                double t = (theta >= 0 ? 1.0 : -1.0) / (fabs(theta) + sqrt(theta * theta + 1.0));
+                double c = 1.0 / sqrt(t * t + 1.0), s = t * c;
+                for (k = 0; k < 3; k++)
+                {
+                    double akp = A[k][p], akq = A[k][q];
+                    A[k][p] = c * akp - s * akq;
+                    A[k][q] = s * akp + c * akq;
+                }
+                for (k = 0; k < 3; k++)
+                {
+                    double apk = A[p][k], aqk = A[q][k];
+                    A[p][k] = c * apk - s * aqk;
+                    A[q][k] = s * apk + c * aqk;
+                }
+            }
+    }
+    for (k = 0; k < 3; k++) lambda[k] = A[k][k];
+}
+
+/* 1 / condition number of J, 0 when singular */
+static double inverseCondition( const double J[3][3] )
+{
+    double A[3][3], lambda[3], smallest, largest;
+    int i, j, k;
+
+    for (i = 0; i < 3; i++)
+        for (j = 0; j < 3; j++)
+        {
+            A[i][j] = 0.0;
+            for (k = 0; k < 3; k++) A[i][j] += J[k][i] * J[k][j];
+        }
+    symmetricEigenvalues(A, lambda);
+    smallest = largest = lambda[0];
+    for (k = 1; k < 3; k++)
+    {
+        if (lambda[k] < smallest) smallest = lambda[k];
+        if (lambda[k] > largest) largest = lambda[k];
+    }
+    if (!(largest > 0.0) || !(smallest > 0.0) || !isfinite(largest))
+    {
+        return 0.0;
+    }
+    return sqrt(smallest / largest);
+}
+
+static int inJointRange( double theta )
+{
+    return (theta >= DEG_TO_RAD(DELTA_WORKSPACE_MIN_ANGLE_DEG)) && (theta <= DEG_TO_RAD(DELTA_WORKSPACE_MAX_ANGLE_DEG));
+}
+
+/* inverse condition at p, -1 if p cannot be reached */
+static double conditionAt( double x, double y, double z )
+{
+    double t1, t2, t3, J[3][3];
+
+    if (deltaKinematicsInverse(x, y, z, &t1, &t2, &t3) != 0 ||
+        !inJointRange(t1) || !inJointRange(t2) || !inJointRange(t3))
+    {
+        return -1.0;
+    }
+    deltaKinematicsJacobian(t1, t2, t3, x, y, z, J);
+    return inverseCondition(J);
+}
+
+/* Table ---------------------------------------------------------------------*/
+
+static void setLevel( int index, int level )
+{
+    if (index & 1) table[index >> 1] = (uint8_t)((table[index >> 1] & 0x0F) | (level << 4));
+    else table[index >> 1] = (uint8_t)((table[index >> 1] & 0xF0) | level);
+}
+
+static void build( int histogram[DELTA_WORKSPACE_LEVELS + 1] )
+{
+    int ix, iy, iz, corner;
+
+    for (iz = 0; iz < DELTA_WORKSPACE_NZ; iz++)
+        for (iy = 0; iy < DELTA_WORKSPACE_NY; iy++)
+            for (ix = 0; ix < DELTA_WORKSPACE_NX; ix++)
+            {
+                double x = DELTA_WORKSPACE_X_MIN + ix * DELTA_WORKSPACE_VOXEL;
+                double y = DELTA_WORKSPACE_Y_MIN + iy * DELTA_WORKSPACE_VOXEL;
+                double z = DELTA_WORKSPACE_Z_MIN + iz * DELTA_WORKSPACE_VOXEL;
+                double h = 0.5 * DELTA_WORKSPACE_VOXEL;
+                double worst = conditionAt(x + h, y + h, z + h);
+                int level = 0;
+
+                for (corner = 0; corner < 8; corner++)
+                {
+                    double c = conditionAt(x + ((corner & 1) ? DELTA_WORKSPACE_VOXEL : 0.0),
+                                           y + ((corner & 2) ? DELTA_WORKSPACE_VOXEL : 0.0),
+                                           z + ((corner & 4) ? DELTA_WORKSPACE_VOXEL : 0.0));
+                    if (c >= 0.0 && (worst < 0.0 || c < worst)) worst = c;
+                }
+                if (worst >= 0.0)
+                {
+                    level = (int)ceil(worst * DELTA_WORKSPACE_LEVELS);
+                    if (level < 1) level = 1;
+                    if (level > DELTA_WORKSPACE_LEVELS) level = DELTA_WORKSPACE_LEVELS;
+                }
+                setLevel((iz * DELTA_WORKSPACE_NY + iy) * DELTA_WORKSPACE_NX + ix, level);
+                histogram[level]++;
+            }
+}
+
+static int writeTable( const char *path )
+{
+    FILE *file = fopen(path, "w");
+    int i;
+
+    if (file == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    fprintf(file, "/**\n");
+    fprintf(file, "  ******************************************************************************\n");
+    fprintf(file, "  * @file    delta_workspace_table.c\n");
+    fprintf(file, "  * @brief   Delta thumb workspace map, %d x %d x %d voxels of %.1f mm.\n",
+            DELTA_WORKSPACE_NX, DELTA_WORKSPACE_NY, DELTA_WORKSPACE_NZ, DELTA_WORKSPACE_VOXEL);
+    fprintf(file, "  *          Generated by tools/gen_delta_workspace.c, do not edit.\n");
+    fprintf(file, "  ******************************************************************************\n");
+    fprintf(file, "  */\n\n");
+    fprintf(file, "#include \"delta_workspace.h\"\n\n");
+    fprintf(file, "// two voxels per byte, even index in the low nibble\n");
+    fprintf(file, "const uint8_t deltaWorkspaceTable[DELTA_WORKSPACE_BYTES] =\n{");
+    for (i = 0; i < DELTA_WORKSPACE_BYTES; i++)
+    {
+        fprintf(file, "%s0x%02X,", (i % 16) ? " " : "\n    ", table[i]);
+    }
+    fprintf(file, "\n};\n//EOF\n");
+    fclose(file);
+    return 0;
+}
+
+/* Check ---------------------------------------------------------------------*/
+
+/* forward kinematics of random joint samples must land in reachable voxels */
+static int checkJointSamples( void )
+{
+    double range = DEG_TO_RAD(DELTA_WORKSPACE_MAX_ANGLE_DEG - DELTA_WORKSPACE_MIN_ANGLE_DEG);
+    int i, k, inBox = 0, missed = 0;
+
+    srand(1);
+    for (i = 0; i < JOINT_SAMPLES; i++)
+    {
+        double t[3], x, y, z;
+        for (k = 0; k < 3; k++) t[k] = DEG_TO_RAD(DELTA_WORKSPACE_MIN_ANGLE_DEG) + range * (rand() / (double)RAND_MAX);
+        if (deltaKinematicsForward(t[0], t[1], t[2], &x, &y, &z) != 0)
+        {
+            continue;
+        }
+        if (x < DELTA_WORKSPACE_X_MIN || y < DELTA_WORKSPACE_Y_MIN || z < DELTA_WORKSPACE_Z_MIN ||
+            x >= DELTA_WORKSPACE_X_MIN + DELTA_WORKSPACE_NX * DELTA_WORKSPACE_VOXEL ||
+            y >= DELTA_WORKSPACE_Y_MIN + DELTA_WORKSPACE_NY * DELTA_WORKSPACE_VOXEL ||
+            z >= DELTA_WORKSPACE_Z_MIN + DELTA_WORKSPACE_NZ * DELTA_WORKSPACE_VOXEL)
+        {
+            continue; // outside the map, by choice of the box
+        }
+        inBox++;
+        if (deltaWorkspaceLookup(table, x, y, z) == 0) missed++;
+    }
+    printf("joint samples: %d in the map, %d (%.2f%%) in voxels marked unreachable\n",
+           inBox, missed, 100.0 * missed / (inBox ? inBox : 1));
+    return missed == 0;
+}
+
+/* voxels whose level changed since delta_workspace_table.c was last written */
+static int countChanged( void )
+{
+    int i, changed = 0;
+
+    for (i = 0; i < DELTA_WORKSPACE_BYTES; i++)
+    {
+        uint8_t difference = table[i] ^ deltaWorkspaceTable[i];
+        changed += ((difference & 0x0F) != 0) + ((difference & 0xF0) != 0);
+    }
+    return changed;
+}
+
+int main( int argc, char **argv )
+{
+    const char *path = (argc > 1) ? argv[1] : "delta_workspace_table.c";
+    int histogram[DELTA_WORKSPACE_LEVELS + 1] = { 0 };
+    int level, ok;
+
+    build(histogram);
+    printf("%d voxels, %d bytes\nlevel:", DELTA_WORKSPACE_NX * DELTA_WORKSPACE_NY * DELTA_WORKSPACE_NZ, DELTA_WORKSPACE_BYTES);
+    for (level = 0; level <= DELTA_WORKSPACE_LEVELS; level++) printf(" %d:%d", level, histogram[level]);
+    printf("\n");
+    ok = checkJointSamples();
+    printf("%d voxels differ from the compiled in map\n", countChanged());
+    if (writeTable(path) != 0)
+    {
+        return 1;
+    }
+    printf("wrote %s\n%s\n", path, ok ? "PASS" : "FAIL");
+    return ok ? 0 : 1;
+}
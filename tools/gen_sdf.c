@@ -0,0 +1,404 @@
+/**
+  ******************************************************************************
+  * @file    gen_sdf.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Voxelizes a closed triangle mesh (Wavefront .obj, v and f lines)
+  *          into an SdfGrid for the firmware (hand_sdf.h). Every sample is
+  *          the distance to the closest triangle, negative where the
+  *          winding number of the mesh is above 1/2 (robust to small holes
+  *          and flipped faces). The grid covers the mesh plus
+  *          SDF_MARGIN_VOXELS on every side, so the field is positive on its
+  *          border. int8 samples keep +-SDF_INT8_BAND_VOXELS around the
+  *          surface (deeper is clamped, the force saturates there), int16
+  *          keep the whole range. Writes a C file with the samples and a
+  *          const SdfGrid <name>; put it in the scene with sceneAddSdf.
+  *          -test voxelizes a sphere mesh and checks sdfGridSample against
+  *          the exact sphere.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/gen_sdf.c hand_sdf.c -lm -o gen_sdf
+  *             ./gen_sdf mesh.obj name voxel_mm [8|16] [name.c]
+  *             ./gen_sdf -test
+  ******************************************************************************
+  */
+
+#include "hand_sdf.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define SDF_MARGIN_VOXELS       3
+#define SDF_INT8_BAND_VOXELS    8.0
+#define SDF_MAX_SAMPLES         (256 * 256 * 256)
+
+typedef struct {
+    int vertexCount, triangleCount;
+    double (*vertex)[3];
+    int (*triangle)[3];
+} Mesh;
+
+/* Mesh ----------------------------------------------------------------------*/
+
+static void addVertex( Mesh *mesh, double x, double y, double z )
+{
+    mesh->vertex = realloc(mesh->vertex, (mesh->vertexCount + 1) * sizeof(*mesh->vertex));
+    mesh->vertex[mesh->vertexCount][0] = x;
+    mesh->vertex[mesh->vertexCount][1] = y;
+    mesh->vertex[mesh->vertexCount][2] = z;
+    mesh->vertexCount++;
+}
+
+static void addTriangle( Mesh *mesh, int a, int b, int c )
+{
+    mesh->triangle = realloc(mesh->triangle, (mesh->triangleCount + 1) * sizeof(*mesh->triangle));
+    mesh->triangle[mesh->triangleCount][0] = a;
+    mesh->triangle[mesh->triangleCount][1] = b;
+    mesh->triangle[mesh->triangleCount][2] = c;
+    mesh->triangleCount++;
+}
+
+// "v x y z" and "f a b c ..." (a, a/t, a/t/n, negative = from the end), polygons as fans
+static int loadObj( const char *path, Mesh *mesh )
+{
+    char line[512];
+    FILE *file = fopen(path, "r");
+
+    if (!file) return -1;
+    while (fgets(line, sizeof(line), file))
+    {
+        if ((line[0] == 'v') && (line[1] == ' '))
+        {
+            double x, y, z;
+            if (sscanf(line + 2, "%lf %lf %lf", &x, &y, &z) == 3) addVertex(mesh, x, y, z);
+        }
+        else if ((line[0] == 'f') && (line[1] == ' '))
+        {
+            int index[64], n = 0;
+            char *token = strtok(line + 2, " \t\r\n");
+            while (token && (n < 64))
+            {
+                int i = atoi(token);
+                index[n++] = (i < 0) ? mesh->vertexCount + i : i - 1;
+                token = strtok(NULL, " \t\r\n");
+            }
+            for (int k = 2; k < n; k++) addTriangle(mesh, index[0], index[k - 1], index[k]);
+        }
+    }
+    fclose(file);
+    for (int t = 0; t < mesh->triangleCount; t++)
+        for (int k = 0; k < 3; k++)
+            if ((mesh->triangle[t][k] < 0) || (mesh->triangle[t][k] >= mesh->vertexCount)) return -1;
+    return (mesh->triangleCount > 0) ? 0 : -1;
+}
+
+// UV sphere, outward facing triangles
+static void sphereMesh( Mesh *mesh, double radius, int rings, int segments )
+{
+    addVertex(mesh, 0.0, 0.0, radius);
+    for (int r = 1; r < rings; r++)
+    {
+        double polar = M_PI * r / rings;
+        for (int s = 0; s < segments; s++)
+        {
+            double azimuth = 2.0 * M_PI * s / segments;
+            addVertex(mesh, radius * sin(polar) * cos(azimuth), radius * sin(polar) * sin(azimuth),
+                      radius * cos(polar));
+        }
+    }
+    addVertex(mesh, 0.0, 0.0, -radius);
+    int south = mesh->vertexCount - 1;
+    for (int s = 0; s < segments; s++)
+    {
+        int next = (s + 1) % segments;
+        addTriangle(mesh, 0, 1 + s, 1 + next);
+        for (int r = 1; r < rings - 1; r++)
+        {
+            int a = 1 + (r - 1) * segments, b = 1 + r * segments;
+            addTriangle(mesh, a + s, b + s, b + next);
+            addTriangle(mesh, a + s, b + next, a + next);
+        }
+        int last = 1 + (rings - 2) * segments;
+        addTriangle(mesh, last + s, south, last + next);
+    }
+}
+
+/* Geometry ------------------------------------------------------------------*/
+
+static double dot( const double a[3], const double b[3] ) { return a[0]*b[0] + a[1]*b[1] + a[2]*b[2]; }
+static void sub( const double a[3], const double b[3], double r[3] ) { for (int k = 0; k < 3; k++) r[k] = a[k] - b[k]; }
+
+// squared distance from p to triangle abc (closest point by Voronoi regions)
+static double triangleDistance2( const double p[3], const double a[3], const double b[3], const double c[3] )
+{
+    double ab[3], ac[3], ap[3], bp[3], cp[3], q[3];
+    sub(b, a, ab); sub(c, a, ac); sub(p, a, ap);
+    double d1 = dot(ab, ap), d2 = dot(ac, ap);
+    if ((d1 <= 0.0) && (d2 <= 0.0)) return dot(ap, ap);
+    sub(p, b, bp);
+    double d3 = dot(ab, bp), d4 = dot(ac, bp);
+    if ((d3 >= 0.0) && (d4 <= d3)) return dot(bp, bp);
+    double vc = d1*d4 - d3*d2;
+    if ((vc <= 0.0) && (d1 >= 0.0) && (d3 <= 0.0))
+    {
+        double v = d1 / (d1 - d3);
+        for (int k = 0; k < 3; k++) q[k] = ap[k] - v*ab[k];
+        return dot(q, q);
+    }
+    sub(p, c, cp);
+    double d5 = dot(ab, cp), d6 = dot(ac, cp);
+    if ((d6 >= 0.0) && (d5 <= d6)) return dot(cp, cp);
+    double vb = d5*d2 - d1*d6;
+    if ((vb <= 0.0) && (d2 >= 0.0) && (d6 <= 0.0))
+    {
+        double w = d2 / (d2 - d6);
+        for (int k = 0; k < 3; k++) q[k] = ap[k] - w*ac[k];
+        return dot(q, q);
+    }
+    double va = d3*d6 - d5*d4;
+    if ((va <= 0.0) && ((d4 - d3) >= 0.0) && ((d5 - d6) >= 0.0))
+    {
+        double w = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+        for (int k = 0; k < 3; k++) q[k] = bp[k] - w*(c[k] - b[k]);
+        return dot(q, q);
+    }
+    double denom = 1.0 / (va + vb + vc);
+    double v = vb * denom, w = vc * denom;
+    for (int k = 0; k < 3; k++) q[k] = ap[k] - v*ab[k] - w*ac[k];
+    return dot(q, q);
+}
+
+// solid angle of triangle abc seen from p (Van Oosterom and Strackee), signed by orientation
+static double solidAngle( const double p[3], const double a[3], const double b[3], const double c[3] )
+{
+    double x[3], y[3], z[3], yz[3];
+    sub(a, p, x); sub(b, p, y); sub(c, p, z);
+    double lx = sqrt(dot(x, x)), ly = sqrt(dot(y, y)), lz = sqrt(dot(z, z));
+    yz[0] = y[1]*z[2] - y[2]*z[1];
+    yz[1] = y[2]*z[0] - y[0]*z[2];
+    yz[2] = y[0]*z[1] - y[1]*z[0];
+    double numerator = dot(x, yz);
+    double denominator = lx*ly*lz + dot(x, y)*lz + dot(y, z)*lx + dot(z, x)*ly;
+    return 2.0 * atan2(numerator, denominator);
+}
+
+static double meshDistance( const Mesh *mesh, const double p[3] )
+{
+    double best = INFINITY, winding = 0.0;
+
+    for (int t = 0; t < mesh->triangleCount; t++)
+    {
+        const double *a = mesh->vertex[mesh->triangle[t][0]];
+        const double *b = mesh->vertex[mesh->triangle[t][1]];
+        const double *c = mesh->vertex[mesh->triangle[t][2]];
+        double d2 = triangleDistance2(p, a, b, c);
+        if (d2 < best) best = d2;
+        winding += solidAngle(p, a, b, c);
+    }
+    winding /= 4.0 * M_PI;
+    return (fabs(winding) > 0.5) ? -sqrt(best) : sqrt(best);
+}
+
+/* Voxelizer -----------------------------------------------------------------*/
+
+// fills grid (data malloc'd), origin gets the position of the first sample
+static int voxelize( const Mesh *mesh, double voxel, int bits, SdfGrid *grid, double origin[3] )
+{
+    double lo[3] = { INFINITY, INFINITY, INFINITY }, hi[3] = { -INFINITY, -INFINITY, -INFINITY };
+    int n[3];
+
+    for (int v = 0; v < mesh->vertexCount; v++)
+        for (int k = 0; k < 3; k++)
+        {
+            if (mesh->vertex[v][k] < lo[k]) lo[k] = mesh->vertex[v][k];
+            if (mesh->vertex[v][k] > hi[k]) hi[k] = mesh->vertex[v][k];
+        }
+    for (int k = 0; k < 3; k++)
+    {
+        origin[k] = lo[k] - SDF_MARGIN_VOXELS * voxel;
+        n[k] = (int)ceil((hi[k] - lo[k]) / voxel) + 2 * SDF_MARGIN_VOXELS + 1;
+    }
+    long count = (long)n[0] * n[1] * n[2];
+    if (count > SDF_MAX_SAMPLES) return -1;
+
+    double *distance = malloc(count * sizeof(double));
+    double largest = 0.0;
+    for (int z = 0; z < n[2]; z++)
+        for (int y = 0; y < n[1]; y++)
+            for (int x = 0; x < n[0]; x++)
+            {
+                double p[3] = { origin[0] + x * voxel, origin[1] + y * voxel, origin[2] + z * voxel };
+                double d = meshDistance(mesh, p);
+                distance[((long)z * n[1] + y) * n[0] + x] = d;
+                if (fabs(d) > largest) largest = fabs(d);
+            }
+
+    grid->nx = n[0];
+    grid->ny = n[1];
+    grid->nz = n[2];
+    grid->voxel = (float)voxel;
+    grid->bits = bits;
+    if (bits == 8)
+    {
+        double band = fmin(largest, SDF_INT8_BAND_VOXELS * voxel);
+        int8_t *data = malloc(count);
+        grid->scale = (float)(band / 127.0);
+        for (long i = 0; i < count; i++) data[i] = (int8_t)lround(fmax(-127.0, fmin(127.0, distance[i] / grid->scale)));
+        grid->data = data;
+    }
+    else
+    {
+        int16_t *data = malloc(count * sizeof(int16_t));
+        grid->scale = (float)(largest / 32767.0);
+        for (long i = 0; i < count; i++) data[i] = (int16_t)lround(distance[i] / grid->scale);
+        grid->data = data;
+    }
+    free(distance);
+    return 0;
+}
+
+static int writeGrid( const char *path, const char *name, const char *source, const SdfGrid *grid )
+{
+    FILE *file = fopen(path, "w");
+    long count = (long)grid->nx * grid->ny * grid->nz;
+
+    if (!file) return -1;
+    fprintf(file, "/**\n");
+    fprintf(file, "  ******************************************************************************\n");
+    fprintf(file, "  * @file    %s\n", path);
+    fprintf(file, "  * @brief   Distance field of %s, %d x %d x %d samples every %.2f mm,\n",
+            source, grid->nx, grid->ny, grid->nz, grid->voxel);
+    fprintf(file, "  *          int%d, %ld bytes. Generated by tools/gen_sdf.c, do not edit.\n",
+            grid->bits, count * grid->bits / 8);
+    fprintf(file, "  ******************************************************************************\n");
+    fprintf(file, "  */\n\n#include \"hand_sdf.h\"\n\n");
+    fprintf(file, "static const int%d_t %sData[%ld] =\n{", grid->bits, name, count);
+    for (long i = 0; i < count; i++)
+    {
+        int value = (grid->bits == 8) ? ((const int8_t *)grid->data)[i] : ((const int16_t *)grid->data)[i];
+        fprintf(file, "%s%d,", (i % 16) ? " " : "\n    ", value);
+    }
+    fprintf(file, "\n};\n\n");
+    fprintf(file, "const SdfGrid %s = { %d, %d, %d, %.6ff, %.9gf, %d, %sData };\n",
+            name, grid->nx, grid->ny, grid->nz, grid->voxel, grid->scale, grid->bits, name);
+    fprintf(file, "//EOF\n");
+    fclose(file);
+    return 0;
+}
+
+/* Self test -----------------------------------------------------------------*/
+
+#define TEST_RADIUS     30.0    // mm
+#define TEST_VOXEL      2.0
+#define TEST_SAMPLES    200000
+#define TEST_BAND       4.0     // mm around the surface where the force is felt
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int selfTest( void )
+{
+    Mesh mesh = { 0 };
+    int pass = 1;
+
+    sphereMesh(&mesh, TEST_RADIUS, 24, 48);
+    // faceting: the mesh is inside the sphere by up to r (1 - cos(pi / rings))
+    double facet = TEST_RADIUS * (1.0 - cos(M_PI / 24));
+    printf("sphere r = %.0f mm, %d triangles, voxel %.1f mm, faceting %.2f mm\n",
+           TEST_RADIUS, mesh.triangleCount, TEST_VOXEL, facet);
+
+    for (int bits = 8; bits <= 16; bits += 8)
+    {
+        SdfGrid grid;
+        double origin[3], worstDistance = 0.0, worstAngle = 0.0;
+        static float points[TEST_SAMPLES][3];
+        volatile float sink = 0.0f;
+
+        if (voxelize(&mesh, TEST_VOXEL, bits, &grid, origin) != 0) return 0;
+        srand(1);
+        for (int i = 0; i < TEST_SAMPLES; i++)
+        {
+            // random direction, distance within the band around the surface
+            double u[3], length;
+            do
+            {
+                for (int k = 0; k < 3; k++) u[k] = 2.0 * rand() / RAND_MAX - 1.0;
+                length = sqrt(dot(u, u));
+            } while ((length > 1.0) || (length < 1e-3));
+            double r = TEST_RADIUS + TEST_BAND * (2.0 * rand() / RAND_MAX - 1.0);
+            for (int k = 0; k < 3; k++) points[i][k] = (float)(u[k] / length * r - origin[k]);
+            float gradient[3];
+            float d = sdfGridSample(&grid, points[i][0], points[i][1], points[i][2], gradient);
+            double g = sqrt(gradient[0]*gradient[0] + gradient[1]*gradient[1] + gradient[2]*gradient[2]);
+            double cosine = (gradient[0]*u[0] + gradient[1]*u[1] + gradient[2]*u[2]) / (g * length);
+            worstDistance = fmax(worstDistance, fabs(d - (r - TEST_RADIUS)));
+            worstAngle = fmax(worstAngle, acos(fmin(1.0, cosine)) * 180.0 / M_PI);
+        }
+        double t0 = nowSeconds();
+        for (int i = 0; i < TEST_SAMPLES; i++)
+        {
+            float gradient[3];
+            sink += sdfGridSample(&grid, points[i][0], points[i][1], points[i][2], gradient) + gradient[0];
+        }
+        double t = nowSeconds() - t0;
+        printf("int%-2d: %d x %d x %d samples, %ld bytes, max distance error %.2f mm, "
+               "max normal error %.1f deg, %.1f ns/lookup\n",
+               bits, grid.nx, grid.ny, grid.nz, (long)grid.nx * grid.ny * grid.nz * bits / 8,
+               worstDistance, worstAngle, t * 1e9 / TEST_SAMPLES);
+        // faceting plus half a voxel of interpolation error over the curvature
+        pass &= (worstDistance < facet + 0.5 * TEST_VOXEL) && (worstAngle < 10.0);
+        free((void *)grid.data);
+    }
+    free(mesh.vertex);
+    free(mesh.triangle);
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass;
+}
+
+int main( int argc, char **argv )
+{
+    Mesh mesh = { 0 };
+    SdfGrid grid;
+    double origin[3];
+    char path[256];
+
+    if ((argc > 1) && (strcmp(argv[1], "-test") == 0)) return selfTest() ? 0 : 1;
+    if (argc < 4)
+    {
+        printf("usage: %s mesh.obj name voxel_mm [8|16] [name.c]\n       %s -test\n", argv[0], argv[0]);
+        return 1;
+    }
+    double voxel = atof(argv[3]);
+    int bits = (argc > 4) ? atoi(argv[4]) : 8;
+    snprintf(path, sizeof(path), "%s.c", argv[2]);
+    if (argc > 5) snprintf(path, sizeof(path), "%s", argv[5]);
+
+    if ((voxel <= 0.0) || ((bits != 8) && (bits != 16)) || (loadObj(argv[1], &mesh) != 0))
+    {
+        printf("bad arguments or mesh\n");
+        return 1;
+    }
+    if (voxelize(&mesh, voxel, bits, &grid, origin) != 0)
+    {
+        printf("more than %d samples, use a larger voxel\n", SDF_MAX_SAMPLES);
+        return 1;
+    }
+    if (writeGrid(path, argv[2], argv[1], &grid) != 0)
+    {
+        printf("cannot write %s\n", path);
+        return 1;
+    }
+    printf("%d triangles, %d x %d x %d samples, %ld bytes\n", mesh.triangleCount, grid.nx, grid.ny, grid.nz,
+           (long)grid.nx * grid.ny * grid.nz * bits / 8);
+    printf("first sample at (%.2f, %.2f, %.2f) mm in mesh coordinates: sceneAddSdf(&scene, &%s, x, y, z, k)\n",
+           origin[0], origin[1], origin[2], argv[2]);
+    printf("wrote %s\n", path);
+    return 0;
+}
+//EOF
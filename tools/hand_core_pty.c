@@ -0,0 +1,314 @@
+/**
+  ******************************************************************************
+  * @file    hand_core_pty.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   The control core of HAND_HOST_PHYSICS built for Linux, behind a
+  *          pseudo-terminal instead of the USB serial port, to test a host
+  *          (host/hand_host_link.h) without the hand. It runs the device
+  *          code that matters unchanged: the pose stream
+  *          (packTelemetryFrame, 'k' and "r0 <rate> <priority>" requests),
+  *          the receive queue of frames and text (haplink_receive.h,
+  *          drained as the main loop does), the host contact frames
+  *          (hostModelsReceive) and their rendering
+  *          at servo rate (hostModelsForces, as the servo tick does). The
+  *          hand is simulated: three points, each a mass pulled by a
+  *          spring (the user) up and down through z and pushed back by the
+  *          rendered force.
+  *          On exit it prints what a host should get right:
+  *           - the largest change of force from one servo tick to the next
+  *             with the blending (stream resumes included), and with the
+  *             frames rendered as they come (what the blending removes);
+  *           - when the frames first stop, the force then, at the end of
+  *             the hold and how long it takes to let go;
+  *           - the frames accepted, bad and out of order, and dropped by a
+  *             full receive queue;
+  *           - before it starts, that a wall it holds is dropped if the
+  *             device clock goes back (getTime_us did every 2018.6 s with
+  *             a 16 bit overflow count), and that the next frame fades in
+  *             from no force instead of stepping it.
+  *          Build and run from the repository root:
+  *             gcc -O2 -Wall -I. tools/hand_core_pty.c hand_host_models.c hand_local_model.c hand_scene.c hand_sdf.c haplink_receive.c haplink_telemetry.c -lm -o hand_core_pty
+  *             ./hand_core_pty -l /tmp/hand_core -t 6
+  *          and point the host at /tmp/hand_core (or the /dev/pts path it
+  *          prints), e.g. tools/host_link_check.cpp.
+  ******************************************************************************
+  */
+
+#define _GNU_SOURCE
+#include "hand_host_models.h"
+#include "haplink_receive.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define SERVO_HZ            5000
+#define POINTS              3       // thumb, finger 1, finger 2
+#define FORCE_N_PER_UNIT    0.2f    // N per stiffness * mm (K_FINGERS / 1000)
+#define HAND_MASS           0.02f   // kg per point
+#define HAND_SPRING         0.5f    // N/mm, the user holding the point on its path
+#define HAND_DAMPING        2.0f    // N s/m
+#define PRESS_DEPTH         20.0f   // mm of travel in z
+#define PRESS_HZ            0.5f
+
+static volatile sig_atomic_t running = 1;
+static int poseRateHz = 500;
+
+static void stop( int signal )
+{
+    (void)signal;
+    running = 0;
+}
+
+static double nowUs( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e6 + ts.tv_nsec * 1e-3;
+}
+
+static void textCommand( const char * text )
+{
+    int stream, rate, priority;
+    if (text[0] == 'k')
+    {
+        requestTelemetryKeyframe();
+    }
+    else if ((text[0] == 'r') && (sscanf(&text[1], "%d %d %d", &stream, &rate, &priority) == 3) && (stream == 0))
+    {
+        poseRateHz = rate;
+    }
+}
+
+static int openCorePty( const char * link )
+{
+    struct termios tty;
+    int master = posix_openpt(O_RDWR | O_NOCTTY);
+
+    if ((master < 0) || grantpt(master) || unlockpt(master)) return -1;
+    if (tcgetattr(master, &tty) == 0)
+    {
+        cfmakeraw(&tty);
+        tcsetattr(master, TCSANOW, &tty);
+    }
+    fcntl(master, F_SETFL, O_NONBLOCK);
+    // keep the slave open ourselves, so the master does not hang up between hosts
+    open(ptsname(master), O_RDWR | O_NOCTTY);
+    printf("control core on %s", ptsname(master));
+    if (link)
+    {
+        unlink(link);
+        if (symlink(ptsname(master), link) == 0) printf(" (%s)", link);
+    }
+    printf("\n");
+    fflush(stdout);
+    return master;
+}
+
+static float length3( const float v[3] )
+{
+    return sqrtf(v[0]*v[0] + v[1]*v[1] + v[2]*v[2]);
+}
+
+// a wall held, the device clock goes back 2018.6 s, then the stream carries on
+static int checkClockBack( void )
+{
+    static HostModels host;
+    const double wrap_us = 65536.0 * 30801.92, t0 = 2000e6;
+    const float point[3] = { 0.0f, 0.0f, -2.0f };
+    HandLocalModel wall[1];
+    uint8_t frame[HOST_MODELS_MAX_FRAME_SIZE];
+    float before[3], after[3], next[3], later[3];
+    int ok;
+
+    wall[0].type = LOCAL_PLANE;
+    wall[0].p[0] = wall[0].p[1] = wall[0].p[2] = 0.0f;
+    wall[0].n[0] = wall[0].n[1] = 0.0f;
+    wall[0].n[2] = 1.0f;
+    wall[0].radius = 0.0f;
+    wall[0].stiffness = 1.0f;
+    hostModelsInit(&host, 1);
+    hostModelsPack(frame, 0, 1000, wall, 1);
+    hostModelsReceive(&host, frame, t0);
+    hostModelsPack(frame, 1, 6000, wall, 1);
+    hostModelsReceive(&host, frame, t0 + 5000.0);
+    hostModelsForces(&host, &point, t0 + 10000.0, &before);
+    hostModelsForces(&host, &point, t0 + 10000.0 - wrap_us, &after);
+    hostModelsPack(frame, 2, 11000, wall, 1);
+    ok = hostModelsReceive(&host, frame, t0 + 11000.0 - wrap_us);
+    hostModelsForces(&host, &point, t0 + 11000.0 - wrap_us, &next);
+    hostModelsForces(&host, &point, t0 + 11000.0 + HOST_MODELS_MAX_BLEND_US - wrap_us, &later);
+    printf("device clock back 2018.6 s while holding a wall: force %.3f before, %.3f after, "
+           "%.3f on the next frame (%s), %.3f once blended\n",
+           length3(before), length3(after), length3(next), ok ? "accepted" : "refused", length3(later));
+    return ok && (length3(before) > 1.0f) && (length3(after) == 0.0f) && (length3(next) < 0.1f * length3(before)) &&
+           (fabsf(length3(later) - length3(before)) < 1e-3f);
+}
+
+int main( int argc, char ** argv )
+{
+    const char * link = NULL;
+    double seconds = 0.0;
+    float x[POINTS][3], v[POINTS][3], last[POINTS][3], lastRaw[POINTS][3];
+    float stepBlended = 0.0f, stepRaw = 0.0f;
+    float forceAtStop = 0.0f, forceAtHoldEnd = -1.0f, forceNow;
+    double stopAt_us = 0.0, releasedAfter_us = -1.0;
+    double start_us, nextTick_us, nextPose_us;
+    uint32_t lastAccepted = 0, ticks = 0, posesSent = 0, posesDropped = 0;
+    int gaps = 0, master, i, j, k;
+
+    for (i = 1; i < argc; i++)
+    {
+        if ((i + 1 < argc) && !strcmp(argv[i], "-l")) link = argv[++i];
+        else if ((i + 1 < argc) && !strcmp(argv[i], "-t")) seconds = atof(argv[++i]);
+        else
+        {
+            printf("usage: %s [-l link path] [-t seconds]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    if (!checkClockBack())
+    {
+        printf("FAIL: host models kept across the clock going back\n");
+        return 1;
+    }
+    master = openCorePty(link);
+    if (master < 0)
+    {
+        perror("posix_openpt");
+        return 1;
+    }
+    signal(SIGINT, stop);
+    signal(SIGTERM, stop);
+    receiveInit(4, NULL);   // 'p' of one DOF, neither used here
+    hostModelsInit(&handHostModels, POINTS);
+    initHaplinkTelemetry();
+    for (j = 0; j < POINTS; j++)
+    {
+        x[j][0] = -20.0f + 20.0f * j;
+        x[j][1] = 0.0f;
+        x[j][2] = 0.0f;
+        for (k = 0; k < 3; k++) v[j][k] = last[j][k] = lastRaw[j][k] = 0.0f;
+    }
+
+    start_us = nowUs();
+    nextTick_us = nextPose_us = start_us;
+    while (running && ((seconds <= 0.0) || (nowUs() - start_us < seconds * 1e6)))
+    {
+        const float dt = 1.0f / SERVO_HZ;
+        float forces[POINTS][3];
+        uint8_t buffer[256];
+        RxMessage * message;
+        double now_us, t;
+        ssize_t n;
+
+        nextTick_us += 1e6 / SERVO_HZ;
+        now_us = nowUs();
+        if (nextTick_us > now_us) usleep((useconds_t)(nextTick_us - now_us));
+        now_us = nowUs();
+        t = (now_us - start_us) * 1e-6;
+
+        // what the UART interrupt would have received, and the main loop decoded;
+        // a read can hold more than the queue, the wire would have spread it out
+        while ((n = read(master, buffer, sizeof(buffer))) > 0)
+        {
+            for (i = 0; i < n; i++) receiveByte(buffer[i]);
+            while ((message = receivePeek()) != NULL)
+            {
+                if (message->data[0] != TELEMETRY_FRAME_SYNC) textCommand((const char *)message->data);
+                else if (message->data[1] == HOST_MODELS_FRAME_TYPE) hostModelsReceive(&handHostModels, message->data, now_us);
+                receiveRelease();
+            }
+        }
+
+        // the servo tick: render, then the hand moves
+        hostModelsForces(&handHostModels, (const float (*)[3])x, now_us, forces);
+        forceNow = 0.0f;
+        for (j = 0; j < POINTS; j++)
+        {
+            HandLocalModel model = handHostModels.blend[j].to;
+            float raw[3], d[3];
+            float target = PRESS_DEPTH * 0.5f * (1.0f - cosf(2.0f * (float)M_PI * PRESS_HZ * (float)t));
+
+            localModelForce(&model, x[j], raw);
+            for (k = 0; k < 3; k++) raw[k] *= hostModelsGain(&handHostModels, now_us);
+            if (ticks > 0)
+            {
+                for (k = 0; k < 3; k++) d[k] = forces[j][k] - last[j][k];
+                if (length3(d) > stepBlended) stepBlended = length3(d);
+                for (k = 0; k < 3; k++) d[k] = raw[k] - lastRaw[j][k];
+                if (length3(d) > stepRaw) stepRaw = length3(d);
+            }
+            for (k = 0; k < 3; k++)
+            {
+                last[j][k] = forces[j][k];
+                lastRaw[j][k] = raw[k];
+            }
+            forceNow += length3(forces[j]);
+
+            for (k = 0; k < 3; k++)
+            {
+                float goal = (k == 2) ? target : ((k == 0) ? -20.0f + 20.0f * j : 0.0f);
+                float f = HAND_SPRING * (goal - x[j][k]) - HAND_DAMPING * v[j][k] * 1e-3f + FORCE_N_PER_UNIT * forces[j][k];
+                v[j][k] += f / HAND_MASS * 1000.0f * dt;
+                x[j][k] += v[j][k] * dt;
+            }
+        }
+        ticks++;
+
+        // a stream that stopped: the hold and the let go
+        if (handHostModels.valid && (handHostModels.accepted == lastAccepted))
+        {
+            double age = now_us - handHostModels.arrival_us;
+            if ((age > 2 * HOST_MODELS_MAX_BLEND_US) && (stopAt_us <= 0.0))
+            {
+                stopAt_us = handHostModels.arrival_us;
+                forceAtStop = forceNow;
+                gaps++;
+            }
+            if ((stopAt_us > 0.0) && (forceAtHoldEnd < 0.0f) && (age >= HOST_MODELS_HOLD_US)) forceAtHoldEnd = forceNow;
+            if ((stopAt_us > 0.0) && (releasedAfter_us < 0.0) && (forceNow <= 0.0f)) releasedAfter_us = age;
+        }
+        else if (handHostModels.accepted != lastAccepted)
+        {
+            stopAt_us = 0.0;
+        }
+        lastAccepted = handHostModels.accepted;
+
+        // the hand pose stream
+        if ((poseRateHz > 0) && (now_us >= nextPose_us))
+        {
+            float fields[TELEMETRY_NUM_FIELDS] = { 0 };
+            uint8_t frame[TELEMETRY_MAX_FRAME_SIZE];
+            int length;
+            nextPose_us += 1e6 / poseRateHz;
+            if (nextPose_us < now_us) nextPose_us = now_us;
+            for (j = 0; j < POINTS; j++)
+            {
+                for (k = 0; k < 3; k++) fields[TELEMETRY_FIELD_THUMB_X + 3 * j + k] = x[j][k];
+            }
+            length = packTelemetryFrame(fields, frame);
+            if (write(master, frame, length) == length) posesSent++;
+            else posesDropped++;    // nobody reading, the frame is lost as on the UART
+        }
+    }
+
+    printf("servo ticks %u, pose frames %u sent %u dropped\n", ticks, posesSent, posesDropped);
+    printf("host frames %u accepted, %u bad, %u out of order, %u dropped, period %.0f us\n",
+           handHostModels.accepted, handHostModels.rejected, handHostModels.stale, (unsigned)receiveDropped(),
+           handHostModels.period_us);
+    printf("largest force step per tick: %.4f blended, %.4f as received (stiffness * mm)\n", stepBlended, stepRaw);
+    printf("stream stops: %d; first one: force %.3f, after the hold %.3f, let go %.1f ms after the last frame\n",
+           gaps, forceAtStop, forceAtHoldEnd, releasedAfter_us / 1000.0);
+    return 0;
+}
+//EOF
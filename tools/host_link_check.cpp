@@ -0,0 +1,121 @@
+/**
+  ******************************************************************************
+  * @file    host_link_check.cpp
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Minimal host physics on host/hand_host_link.h, and its check
+  *          against the control core on a pseudo-terminal
+  *          (tools/hand_core_pty.c). The scene is one movable sphere: it
+  *          hangs on a spring from a rest point that swings in x, and the
+  *          contact forces of the hand push it. Every host step reads the
+  *          hand pose, steps the sphere and sends the sphere as the local
+  *          model of each contact point. The stream runs at 1 kHz, stops
+  *          for 0.6 s (a stalled host: the core holds, then lets go) and
+  *          resumes, so the core's summary covers both.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. -c hand_host_models.c hand_local_model.c hand_motion.c hand_scene.c hand_sdf.c haplink_telemetry.c
+  *             g++ -O2 -Wall -I. -Ihost tools/host_link_check.cpp host/hand_host_link.cpp hand_host_models.o hand_local_model.o hand_motion.o hand_scene.o hand_sdf.o haplink_telemetry.o -lm -o host_link_check
+  *             ./hand_core_pty -l /tmp/hand_core -t 6 & sleep 0.5; ./host_link_check /tmp/hand_core; wait
+  ******************************************************************************
+  */
+
+#include "hand_host_link.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define HOST_HZ             1000
+#define RUN_S               2.5     // streaming, then
+#define STALL_S             0.6     // nothing, then
+#define RESUME_S            1.5     // streaming again
+#define FORCE_N_PER_UNIT    0.2f    // same as the core
+#define OBJECT_STIFFNESS    1.0f
+#define OBJECT_RADIUS       30.0f   // mm
+#define OBJECT_MASS         0.2f    // kg
+#define OBJECT_SPRING       0.3f    // N/mm to its rest point
+#define OBJECT_DAMPING      3.0f    // N s/m
+#define OBJECT_SWING        10.0f   // mm in x at 1 Hz
+
+int main( int argc, char ** argv )
+{
+    HandHostLink link;
+    HandLocalModel models[HOST_LINK_POINTS];
+    float c[3] = { 0.0f, 0.0f, 40.0f }, v[3] = { 0.0f, 0.0f, 0.0f };
+    float depthMax = 0.0f;
+    double start_us, next_us, last_us;
+    int steps = 0;
+
+    if (argc < 2)
+    {
+        printf("usage: %s <serial port or pty>\n", argv[0]);
+        return 1;
+    }
+    if (!link.open(argv[1]))
+    {
+        perror(argv[1]);
+        return 1;
+    }
+    link.setStreamRate(HOST_LINK_STREAM_POSE, HOST_HZ, 4);
+
+    start_us = next_us = last_us = HandHostLink::now_us();
+    for (;;)
+    {
+        double now_us = HandHostLink::now_us();
+        double t = (now_us - start_us) * 1e-6;
+        float points[HOST_LINK_POINTS][3], push[3] = { 0.0f, 0.0f, 0.0f };
+        float dt = (float)((now_us - last_us) * 1e-6);
+        float rest[3] = { OBJECT_SWING * sinf(2.0f * (float)M_PI * (float)t), 0.0f, 40.0f };
+
+        if (t > RUN_S + STALL_S + RESUME_S) break;
+        if (now_us < next_us)
+        {
+            if (link.poll((int)(next_us - now_us)) < 0) break;
+            continue;
+        }
+        next_us += 1e6 / HOST_HZ;
+        last_us = now_us;
+        if (!link.havePose()) continue;
+
+        // the physics: contact forces of the hand on the sphere, then one step
+        link.contactPoints(points);
+        for (int j = 0; j < HOST_LINK_POINTS; j++)
+        {
+            float q[3] = { points[j][0] - c[0], points[j][1] - c[1], points[j][2] - c[2] };
+            float d = sqrtf(q[0]*q[0] + q[1]*q[1] + q[2]*q[2]);
+            if ((d < OBJECT_RADIUS) && (d > 0.0f))
+            {
+                float depth = OBJECT_RADIUS - d;
+                if (depth > depthMax) depthMax = depth;
+                for (int k = 0; k < 3; k++) push[k] -= FORCE_N_PER_UNIT * OBJECT_STIFFNESS * depth * q[k] / d;
+            }
+        }
+        for (int k = 0; k < 3; k++)
+        {
+            float f = OBJECT_SPRING * (rest[k] - c[k]) - OBJECT_DAMPING * v[k] * 1e-3f + push[k];
+            v[k] += f / OBJECT_MASS * 1000.0f * dt;
+            c[k] += v[k] * dt;
+        }
+
+        // a stalled host sends nothing
+        if ((t > RUN_S) && (t < RUN_S + STALL_S)) continue;
+        for (int j = 0; j < HOST_LINK_POINTS; j++)
+        {
+            models[j].type = LOCAL_SPHERE;
+            models[j].p[0] = c[0];
+            models[j].p[1] = c[1];
+            models[j].p[2] = c[2];
+            models[j].radius = OBJECT_RADIUS;
+            models[j].stiffness = OBJECT_STIFFNESS;
+        }
+        if (!link.sendModels(models, HOST_LINK_POINTS)) break;
+        steps++;
+    }
+
+    const HandHostLinkStats &s = link.stats();
+    printf("host steps %d, pose frames %u, lost %u, keyframe requests %u\n", steps, s.poses, s.lost, s.keyframeRequests);
+    printf("model frames %u, %u bytes out, %u bytes in, deepest contact %.2f mm\n",
+           s.modelsSent, s.bytesWritten, s.bytesRead, depthMax);
+    return (s.poses > 0) && (s.modelsSent > 0) ? 0 : 1;
+}
+//EOF
@@ -0,0 +1,430 @@
+/**
+  ******************************************************************************
+  * @file    latency_probe.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host side of the round-trip latency probe. Sends "g<host stamp>l"
+  *          pings over the serial port and reads the ping reply frames
+  *          (haplink_telemetry.h, type 'G') which echo the stamp together
+  *          with the device receive and transmit times.
+  *
+  *          For every reply:
+  *             rtt     = host rx - host tx
+  *             offset  = ((dev rx - host tx) + (dev tx - host rx)) / 2
+  *          The device clock offset and drift are fitted over the replies
+  *          with the lowest rtt (they have the most symmetric paths), and the
+  *          fit gives the one-way times:
+  *             uplink   = dev rx - host tx - offset(t)   host command -> device
+  *             downlink = host rx - dev tx + offset(t)   device data -> host
+  *          The summary is appended to a csv log so runs can be compared
+  *          after firmware changes.
+  *
+  *          Build and run from the repository root (Linux or macOS):
+  *             gcc -O2 -Wall tools/latency_probe.c -lm -o latency_probe
+  *             ./latency_probe /dev/ttyACM0 -n 1000 -r 50 -o latency_log.csv -t "my change"
+  ******************************************************************************
+  */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/select.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#define FRAME_SYNC          0xA5    // same as TELEMETRY_FRAME_SYNC
+#define TYPE_PING_REPLY     'G'     // same as TELEMETRY_TYPE_PING_REPLY
+#define PING_REPLY_PAYLOAD  12
+#define REPLY_TIMEOUT_US    500000  // replies later than this are counted as lost
+
+typedef struct {
+    double hostTx;      // all in us
+    double hostRx;
+    double deviceRx;    // unwrapped
+    double deviceTx;
+    double rtt;
+    double offset;
+    double uplink;
+    double downlink;
+} PingSample;
+
+typedef struct {
+    int state;
+    int type;
+    int length;
+    int index;
+    uint8_t payload[256];
+} FrameParser;
+
+static uint64_t hostStartUs;
+
+static uint64_t hostNowUs( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000;
+}
+
+static uint8_t crc8( uint8_t crc, uint8_t data )
+{
+    int bit;
+    crc ^= data;
+    for (bit = 0; bit < 8; bit++)
+    {
+        crc = (crc & 0x80) ? (uint8_t)((crc << 1) ^ 0x07) : (uint8_t)(crc << 1);
+    }
+    return crc;
+}
+
+static uint32_t getUint32( const uint8_t * buffer )
+{
+    return buffer[0] | (buffer[1] << 8) | (buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+/*******************************************************************************
+  * @name   feedParser
+  * @brief  byte state machine for [sync][type][len][payload][crc]. Text and
+  *         the other telemetry frames on the link are skipped.
+  * @retval 1 when a ping reply with a good crc completed.
+  */
+static int feedParser( FrameParser * p, uint8_t b )
+{
+    uint8_t crc;
+    int i;
+
+    switch (p->state)
+    {
+    case 0:
+        if (b == FRAME_SYNC) p->state = 1;
+        return 0;
+    case 1:
+        p->type = b;
+        p->state = 2;
+        return 0;
+    case 2:
+        p->length = b;
+        p->index = 0;
+        p->state = (b > 0) ? 3 : 4;
+        return 0;
+    case 3:
+        p->payload[p->index++] = b;
+        if (p->index >= p->length) p->state = 4;
+        return 0;
+    default:
+        p->state = 0;
+        crc = crc8(0, (uint8_t)p->type);
+        crc = crc8(crc, (uint8_t)p->length);
+        for (i = 0; i < p->length; i++)
+        {
+            crc = crc8(crc, p->payload[i]);
+        }
+        return (crc == b) && (p->type == TYPE_PING_REPLY) && (p->length == PING_REPLY_PAYLOAD);
+    }
+}
+
+static int openSerial( const char * path )
+{
+    struct termios tty;
+    int fd = open(path, O_RDWR | O_NOCTTY | O_NONBLOCK);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (tcgetattr(fd, &tty) == 0)
+    {
+        cfmakeraw(&tty);
+        cfsetispeed(&tty, B115200);
+        cfsetospeed(&tty, B115200);
+        tty.c_cflag |= CLOCAL | CREAD;
+        tcsetattr(fd, TCSANOW, &tty);
+    }
+    tcflush(fd, TCIOFLUSH);
+    return fd;
+}
+
+static int compareDouble( const void * a, const void * b )
+{
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double percentile( const double * sorted, int n, double p )
+{
+    int i = (int)ceil(p / 100.0 * n) - 1;
+    if (i < 0) i = 0;
+    if (i >= n) i = n - 1;
+    return sorted[i];
+}
+
+typedef struct { double min, p50, p90, p99, max, mean; } Summary;
+
+static Summary summarize( const PingSample * s, int n, size_t field )
+{
+    Summary r;
+    double * v = malloc(n * sizeof(double));
+    double sum = 0.0;
+    int i;
+    for (i = 0; i < n; i++)
+    {
+        v[i] = *(const double *)((const char *)&s[i] + field);
+        sum += v[i];
+    }
+    qsort(v, n, sizeof(double), compareDouble);
+    r.min = v[0];
+    r.p50 = percentile(v, n, 50);
+    r.p90 = percentile(v, n, 90);
+    r.p99 = percentile(v, n, 99);
+    r.max = v[n - 1];
+    r.mean = sum / n;
+    free(v);
+    return r;
+}
+
+static void printSummary( const char * name, Summary r )
+{
+    printf("%-10s %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f\n", name, r.min, r.p50, r.p90, r.p99, r.max, r.mean);
+}
+
+/*******************************************************************************
+  * @name   fitClockOffset
+  * @brief  least squares line offset = a + b * hostTx through the samples in
+  *         the fastest quarter of round trips, then the one-way times.
+  * @retval drift in ppm (b * 1e6), *offsetAtStart gets a.
+  */
+static double fitClockOffset( PingSample * s, int n, double * offsetAtStart )
+{
+    double * rtts = malloc(n * sizeof(double));
+    double limit, sx = 0, sy = 0, sxx = 0, sxy = 0, m = 0, a, b = 0.0;
+    int i;
+
+    for (i = 0; i < n; i++) rtts[i] = s[i].rtt;
+    qsort(rtts, n, sizeof(double), compareDouble);
+    limit = percentile(rtts, n, 25);
+    free(rtts);
+
+    for (i = 0; i < n; i++)
+    {
+        if (s[i].rtt > limit) continue;
+        sx += s[i].hostTx;
+        sy += s[i].offset;
+        sxx += s[i].hostTx * s[i].hostTx;
+        sxy += s[i].hostTx * s[i].offset;
+        m += 1.0;
+    }
+    if ((m > 1.0) && ((m * sxx - sx * sx) > 0.0))
+    {
+        b = (m * sxy - sx * sy) / (m * sxx - sx * sx);
+    }
+    a = (sy - b * sx) / m;
+
+    for (i = 0; i < n; i++)
+    {
+        double offset = a + b * s[i].hostTx;
+        s[i].uplink = s[i].deviceRx - s[i].hostTx - offset;
+        s[i].downlink = s[i].hostRx - s[i].deviceTx + offset;
+    }
+    *offsetAtStart = a;
+    return b * 1e6;
+}
+
+static void usage( const char * name )
+{
+    fprintf(stderr, "usage: %s <serial port> [-n pings] [-r rate Hz] [-o log.csv] [-s samples.csv] [-t label]\n", name);
+}
+
+int main( int argc, char ** argv )
+{
+    const char * port;
+    const char * logPath = "latency_log.csv";
+    const char * samplesPath = NULL;
+    const char * label = "";
+    int count = 500;
+    double rateHz = 20.0;
+    PingSample * samples;
+    FrameParser parser;
+    int sent = 0, received = 0;
+    uint64_t nextPingUs, lastSendUs = 0, now;
+    uint32_t lastDeviceRx = 0;
+    int haveDeviceTime = 0;
+    double deviceRxBase = 0.0, offset0, drift;
+    int fd, i;
+    FILE * f;
+
+    if (argc < 2)
+    {
+        usage(argv[0]);
+        return 1;
+    }
+    port = argv[1];
+    for (i = 2; i < argc; i++)
+    {
+        if ((i + 1 < argc) && !strcmp(argv[i], "-n")) count = atoi(argv[++i]);
+        else if ((i + 1 < argc) && !strcmp(argv[i], "-r")) rateHz = atof(argv[++i]);
+        else if ((i + 1 < argc) && !strcmp(argv[i], "-o")) logPath = argv[++i];
+        else if ((i + 1 < argc) && !strcmp(argv[i], "-s")) samplesPath = argv[++i];
+        else if ((i + 1 < argc) && !strcmp(argv[i], "-t")) label = argv[++i];
+        else { usage(argv[0]); return 1; }
+    }
+    if ((count < 1) || (rateHz <= 0.0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    fd = openSerial(port);
+    if (fd < 0)
+    {
+        fprintf(stderr, "cannot open %s: %s\n", port, strerror(errno));
+        return 1;
+    }
+
+    samples = calloc(count, sizeof(PingSample));
+    memset(&parser, 0, sizeof(parser));
+    hostStartUs = hostNowUs();
+    nextPingUs = hostStartUs;
+
+    // one ping in flight at a time so a slow reply never queues behind another ping
+    while (1)
+    {
+        fd_set readSet;
+        struct timeval timeout = {0, 1000};
+        uint8_t bytes[256];
+        ssize_t n;
+
+        now = hostNowUs();
+        if ((sent == received) || (now - lastSendUs > REPLY_TIMEOUT_US))
+        {
+            if (sent == count) break;
+            if (now >= nextPingUs)
+            {
+                char ping[24];
+                int length = snprintf(ping, sizeof(ping), "g%ul", (uint32_t)(now - hostStartUs));
+                if (write(fd, ping, length) != length)
+                {
+                    fprintf(stderr, "write failed: %s\n", strerror(errno));
+                    break;
+                }
+                received = sent;    // forget a lost reply
+                sent++;
+                lastSendUs = now;
+                nextPingUs += (uint64_t)(1e6 / rateHz);
+                if (nextPingUs < now) nextPingUs = now;
+            }
+        }
+
+        FD_ZERO(&readSet);
+        FD_SET(fd, &readSet);
+        if (select(fd + 1, &readSet, NULL, NULL, &timeout) <= 0) continue;
+        n = read(fd, bytes, sizeof(bytes));
+        now = hostNowUs();
+        for (i = 0; i < n; i++)
+        {
+            PingSample * s;
+            uint32_t stamp, deviceRx, deviceTx;
+
+            if (!feedParser(&parser, bytes[i])) continue;
+            stamp = getUint32(&parser.payload[0]);
+            deviceRx = getUint32(&parser.payload[4]);
+            deviceTx = getUint32(&parser.payload[8]);
+            if ((stamp != (uint32_t)(lastSendUs - hostStartUs)) || (sent == received)) continue; // stale reply
+
+            // the device times are getTime32_us and wrap at 2^32 us, unwrap them against the previous reply
+            if (!haveDeviceTime) deviceRxBase = deviceRx;
+            else deviceRxBase += (double)(int32_t)(deviceRx - lastDeviceRx);
+            lastDeviceRx = deviceRx;
+            haveDeviceTime = 1;
+
+            s = &samples[sent - 1];
+            s->hostTx = (double)stamp;
+            s->hostRx = (double)(now - hostStartUs);
+            s->deviceRx = deviceRxBase;
+            s->deviceTx = deviceRxBase + (double)(uint32_t)(deviceTx - deviceRx);
+            s->rtt = s->hostRx - s->hostTx;
+            s->offset = ((s->deviceRx - s->hostTx) + (s->deviceTx - s->hostRx)) / 2.0;
+            received = sent;
+        }
+    }
+    close(fd);
+
+    // lost pings left their slot empty
+    {
+        int kept = 0;
+        for (i = 0; i < count; i++)
+        {
+            if (samples[i].hostRx > 0.0) samples[kept++] = samples[i];
+        }
+        received = kept;
+    }
+    if (received < 2)
+    {
+        fprintf(stderr, "only %d of %d pings answered, is the firmware running the 'g' message?\n", received, sent);
+        free(samples);
+        return 1;
+    }
+
+    drift = fitClockOffset(samples, received, &offset0);
+    {
+        Summary rtt = summarize(samples, received, offsetof(PingSample, rtt));
+        Summary up = summarize(samples, received, offsetof(PingSample, uplink));
+        Summary down = summarize(samples, received, offsetof(PingSample, downlink));
+        PingSample * processing = malloc(received * sizeof(PingSample));
+        Summary device;
+        time_t wall = time(NULL);
+        char date[32];
+
+        for (i = 0; i < received; i++)
+        {
+            processing[i].rtt = samples[i].deviceTx - samples[i].deviceRx;
+        }
+        device = summarize(processing, received, offsetof(PingSample, rtt));
+        free(processing);
+
+        printf("%d pings, %d answered, clock offset %.1f us, drift %.2f ppm\n", sent, received, offset0, drift);
+        printf("%-10s %9s %9s %9s %9s %9s %9s   (us)\n", "", "min", "p50", "p90", "p99", "max", "mean");
+        printSummary("round trip", rtt);
+        printSummary("uplink", up);
+        printSummary("downlink", down);
+        printSummary("on device", device);
+
+        strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", localtime(&wall));
+        f = fopen(logPath, "a+");
+        if (f != NULL)
+        {
+            fseek(f, 0, SEEK_END);
+            if (ftell(f) == 0)
+            {
+                fprintf(f, "date,label,sent,answered,rtt_p50,rtt_p99,rtt_max,up_p50,up_p99,down_p50,down_p99,device_p50,device_p99,offset_us,drift_ppm\n");
+            }
+            fprintf(f, "%s,\"%s\",%d,%d,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.1f,%.2f\n",
+                    date, label, sent, received, rtt.p50, rtt.p99, rtt.max, up.p50, up.p99,
+                    down.p50, down.p99, device.p50, device.p99, offset0, drift);
+            fclose(f);
+            printf("summary appended to %s\n", logPath);
+        }
+    }
+
+    if (samplesPath != NULL)
+    {
+        f = fopen(samplesPath, "w");
+        if (f != NULL)
+        {
+            fprintf(f, "host_tx_us,host_rx_us,device_rx_us,device_tx_us,rtt_us,uplink_us,downlink_us\n");
+            for (i = 0; i < received; i++)
+            {
+                PingSample * s = &samples[i];
+                fprintf(f, "%.0f,%.0f,%.0f,%.0f,%.0f,%.1f,%.1f\n", s->hostTx, s->hostRx, s->deviceRx,
+                        s->deviceTx, s->rtt, s->uplink, s->downlink);
+            }
+            fclose(f);
+        }
+    }
+    free(samples);
+    return 0;
+}
@@ -0,0 +1,224 @@
+/**
+  ******************************************************************************
+  * @file    sim_delta_servo.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host simulation of the delta thumb impedance servo (delta_servo.c)
+  *          against the per motor PID goTo used before
+  *          (setAndMaintainMotorAngle, copied below). Each joint is a rotor
+  *          I * theta'' = torque - b * theta' integrated at 20 kHz, the
+  *          controller is called from a "main loop" whose period is fixed
+  *          or jittery, so the effect of the loop speed on each controller
+  *          shows up directly. Inertia and friction are rough guesses for
+  *          the thumb motors, the point is the comparison. The last
+  *          profiles give the servo a clock that goes back during the move
+  *          (as getTime_us did every 2018.6 s with a 16 bit overflow count)
+  *          or a 50 ms stall: the torque must drop to zero on that call and
+  *          the move still end on the target.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_delta_servo.c delta_servo.c delta_kinematics.c -lm -o sim_delta_servo
+  *             ./sim_delta_servo
+  ******************************************************************************
+  */
+
+#include "delta_kinematics.h"
+#include "delta_servo.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define PHYSICS_DT          0.00005     // s
+#define JOINT_INERTIA       2e-5        // kg*m^2
+#define JOINT_FRICTION      1e-5        // Nm*s/rad
+#define SIM_TIME_S          1.5
+#define MOTOR_MAX_TORQUE    (1.0 / 65.13)   // full duty, see outputTorqueMotor1
+
+typedef struct {
+    const char *name;
+    double minPeriod, maxPeriod;    // s, main loop period range
+    double jump;                    // s added to the servo's clock from JUMP_AT_S on
+    double stall;                   // s without a loop at JUMP_AT_S
+} LoopProfile;
+
+#define JUMP_AT_S           0.2
+
+static const LoopProfile profiles[] =
+{
+    { "5 kHz loop", 0.0002, 0.0002, 0.0, 0.0 },
+    { "1 kHz loop", 0.001, 0.001, 0.0, 0.0 },
+    { "jittery 0.3-3 kHz loop", 0.00033, 0.0033, 0.0, 0.0 },
+    { "1 kHz, clock back 2018 s", 0.001, 0.001, -2018.63, 0.0 },
+    { "1 kHz, 50 ms stall", 0.001, 0.001, 0.0, 0.05 },
+};
+
+/* Old controller ------------------------------------------------------------*/
+
+typedef struct {
+    double errorIntegral[3];
+    double prevError[3];
+} OldPid;
+
+/* setAndMaintainMotorAngle for the three motors, one call per loop */
+static void oldPidUpdate( OldPid *pid, const double thetaDeg[3], const double targetDeg[3], double torque[3] )
+{
+    const double kp = 0.05, ki = 0.001, kd = 0.01, maxIntegral = 50.0;
+    int i;
+
+    for (i = 0; i < 3; i++)
+    {
+        double error = targetDeg[i] - thetaDeg[i];
+        pid->errorIntegral[i] += error;
+        if (pid->errorIntegral[i] > maxIntegral) pid->errorIntegral[i] = maxIntegral;
+        else if (pid->errorIntegral[i] < -maxIntegral) pid->errorIntegral[i] = -maxIntegral;
+        double errorDerivative = error - pid->prevError[i];
+        pid->prevError[i] = error;
+        torque[i] = kp * error + ki * pid->errorIntegral[i] + kd * errorDerivative;
+    }
+}
+
+/* Simulation ----------------------------------------------------------------*/
+
+static double randomBetween( double a, double b )
+{
+    return a + (b - a) * (rand() / (double)RAND_MAX);
+}
+
+static void clampTorque( double torque[3] )
+{
+    int i;
+    for (i = 0; i < 3; i++)
+    {
+        if (torque[i] > MOTOR_MAX_TORQUE) torque[i] = MOTOR_MAX_TORQUE;
+        if (torque[i] < -MOTOR_MAX_TORQUE) torque[i] = -MOTOR_MAX_TORQUE;
+    }
+}
+
+/* runs one move, returns the final error and fills the settling time and,
+   for the servo, the largest torque it gave on the call after the jump */
+static double simulate( int useServo, const LoopProfile *profile, const double startDeg[3],
+                        const double targetPosition[3], double *settle_s, double *overshoot_mm,
+                        double *torqueAfterJump )
+{
+    DeltaServo servo;
+    OldPid pid = { { 0 }, { 0 } };
+    double theta[3], omega[3] = { 0 }, torque[3] = { 0 }, targetDeg[3], targetRad[3];
+    double p[3], J[3][3], start[3], t = 0.0, nextLoop = 0.0, error = 0.0, pathLength = 0.0;
+    int i, jumped = 0;
+
+    for (i = 0; i < 3; i++) theta[i] = DEG_TO_RAD(startDeg[i]);
+    deltaKinematicsInverse(targetPosition[0], targetPosition[1], targetPosition[2],
+                           &targetRad[0], &targetRad[1], &targetRad[2]);
+    for (i = 0; i < 3; i++) targetDeg[i] = RAD_TO_DEG(targetRad[i]);
+    deltaKinematicsForwardJacobian(theta[0], theta[1], theta[2], &start[0], &start[1], &start[2], J);
+    for (i = 0; i < 3; i++) pathLength += (targetPosition[i] - start[i]) * (targetPosition[i] - start[i]);
+    pathLength = sqrt(pathLength);
+
+    deltaServoInit(&servo, DELTA_SERVO_STIFFNESS, DELTA_SERVO_DAMPING, DELTA_SERVO_MAX_SPEED);
+    deltaServoMoveTo(&servo, start, targetPosition);
+    *settle_s = -1.0;
+    *overshoot_mm = 0.0;
+    *torqueAfterJump = 0.0;
+
+    while (t < SIM_TIME_S)
+    {
+        if (deltaKinematicsForwardJacobian(theta[0], theta[1], theta[2], &p[0], &p[1], &p[2], J) != 0)
+        {
+            return 1e9; // left the workspace
+        }
+        if ((t >= JUMP_AT_S) && (t < JUMP_AT_S + profile->stall))
+        {
+            nextLoop = JUMP_AT_S + profile->stall;
+        }
+        if (t >= nextLoop)
+        {
+            if (useServo)
+            {
+                deltaServoUpdate(&servo, t + ((t >= JUMP_AT_S) ? profile->jump : 0.0), p, J, torque);
+                if (!jumped && (t >= JUMP_AT_S))
+                {
+                    for (i = 0; i < 3; i++)
+                        if (fabs(torque[i]) > *torqueAfterJump) *torqueAfterJump = fabs(torque[i]);
+                    jumped = 1;
+                }
+            }
+            else
+            {
+                double thetaDeg[3] = { RAD_TO_DEG(theta[0]), RAD_TO_DEG(theta[1]), RAD_TO_DEG(theta[2]) };
+                oldPidUpdate(&pid, thetaDeg, targetDeg, torque);
+            }
+            clampTorque(torque);
+            nextLoop += randomBetween(profile->minPeriod, profile->maxPeriod);
+        }
+        for (i = 0; i < 3; i++)
+        {
+            omega[i] += PHYSICS_DT * (torque[i] - JOINT_FRICTION * omega[i]) / JOINT_INERTIA;
+            theta[i] += PHYSICS_DT * omega[i];
+        }
+        t += PHYSICS_DT;
+
+        // error to the target, overshoot past it along the path
+        double along = 0.0;
+        error = 0.0;
+        for (i = 0; i < 3; i++)
+        {
+            error += (p[i] - targetPosition[i]) * (p[i] - targetPosition[i]);
+            along += (p[i] - start[i]) * (targetPosition[i] - start[i]);
+        }
+        error = sqrt(error);
+        if (pathLength > 0.0 && along / pathLength - pathLength > *overshoot_mm)
+        {
+            *overshoot_mm = along / pathLength - pathLength;
+        }
+        if (error > 0.1) *settle_s = -1.0;
+        else if (*settle_s < 0.0) *settle_s = t;
+    }
+    return error;
+}
+
+int main( void )
+{
+    const double startDeg[3] = { 20.0, 20.0, 20.0 };
+    const double targets[][3] = { { 8.0, -5.0, -60.0 }, { -10.0, 6.0, -68.0 }, { 0.0, 12.0, -55.0 } };
+    const int numberTargets = sizeof(targets) / sizeof(targets[0]);
+    int controller, p, k, pass = 1;
+
+    srand(1);
+    for (controller = 1; controller >= 0; controller--)
+    {
+        printf("%s\n", controller ? "impedance servo (delta_servo.c)" : "per motor PID (setAndMaintainMotorAngle)");
+        for (p = 0; p < (int)(sizeof(profiles) / sizeof(profiles[0])); p++)
+        {
+            double worstError = 0.0, worstSettle = 0.0, worstOvershoot = 0.0, worstJumpTorque = 0.0;
+            if (!controller && ((profiles[p].jump != 0.0) || (profiles[p].stall > 0.0))) continue;
+            for (k = 0; k < numberTargets; k++)
+            {
+                double settle, overshoot, jumpTorque;
+                double error = simulate(controller, &profiles[p], startDeg, targets[k], &settle, &overshoot,
+                                        &jumpTorque);
+                if (jumpTorque > worstJumpTorque) worstJumpTorque = jumpTorque;
+                if (error > worstError) worstError = error;
+                if (settle < 0.0) settle = 1e9;
+                if (settle > worstSettle) worstSettle = settle;
+                if (overshoot > worstOvershoot) worstOvershoot = overshoot;
+            }
+            if (worstSettle >= 1e9)
+                printf("  %-24s final error %8.4f mm, does not settle within 0.1 mm, overshoot %.2f mm\n",
+                       profiles[p].name, worstError, worstOvershoot);
+            else
+                printf("  %-24s final error %8.4f mm, settled (0.1 mm) at %.3f s, overshoot %.2f mm\n",
+                       profiles[p].name, worstError, worstSettle, worstOvershoot);
+            if ((profiles[p].jump != 0.0) || (profiles[p].stall > 0.0))
+            {
+                printf("  %-24s torque on the call after it: %.4f Nm\n", "", worstJumpTorque);
+            }
+            if (controller)
+            {
+                pass &= (worstSettle < 1e9) && (worstError < 0.1);
+                if ((profiles[p].jump != 0.0) || (profiles[p].stall > 0.0)) pass &= (worstJumpTorque == 0.0);
+            }
+        }
+    }
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+/**
+  ******************************************************************************
+  * @file    sim_hand_friction.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the friction of the proxy contact (hand_proxy.h,
+  *          sceneSetFriction), one contact point at 1 kHz:
+  *           - pressed 2 mm into a flat surface with friction 0.6 / 0.4 and
+  *             dragged across at 50 mm/s: the force across the surface
+  *             builds up to 0.6 times the normal force (stick), drops to
+  *             0.4 times it and stays there (slip); dragged back it sticks
+  *             again and goes through zero without a jump; the same
+  *             surface without friction gives nothing across;
+  *           - dragged from that surface onto one with 0.2 / 0.1: the force
+  *             across follows the coefficients of the object under it;
+  *           - sliding round a sphere with 0.3 / 0.2: the proxy stays on the
+  *             surface and the force across is 0.2 times the normal one;
+  *           - the cost of an update with and without friction.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_hand_friction.c hand_proxy.c hand_scene.c hand_sdf.c -lm -o sim_hand_friction
+  *             ./sim_hand_friction
+  ******************************************************************************
+  */
+
+#include "hand_proxy.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define DEPTH       2.0f    // mm into the surface
+#define SPEED       0.05f   // mm per tick, 50 mm/s
+#define SPHERE_R    20.0f
+
+static Scene scene;
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+typedef struct {
+    float peak;         // largest |across| / normal before the first slip
+    float sliding;      // |across| / normal at the end of the drag
+    float step;         // largest change of the force across in one tick while stuck on the way back
+    float released;     // |force| once lifted off
+    int stuck;          // ticks it stuck for at the start of the drag
+} Drag;
+
+// press at x0, drag along +x for ticks, back for ticks / 2, lift off
+static Drag drag( float x0, int ticks )
+{
+    HandProxy proxy;
+    Drag r = { 0.0f, 0.0f, 0.0f, 0.0f, 0 };
+    float device[3] = { x0, 0.0f, 5.0f }, force[3], last = 0.0f;
+    int tick, slipped = 0;
+
+    handProxyReset(&proxy);
+    for (tick = 0; tick < 100; tick++)
+    {
+        device[2] = 5.0f - (5.0f + DEPTH) * tick / 99.0f;
+        handProxyUpdate(&proxy, &scene, device, force);
+    }
+    for (tick = 0; tick < ticks; tick++)
+    {
+        float ratio;
+        device[0] += SPEED;
+        handProxyUpdate(&proxy, &scene, device, force);
+        ratio = fabsf(force[0]) / force[2];
+        if (!slipped && proxy.sliding) slipped = 1;
+        if (!slipped)
+        {
+            r.stuck++;
+            if (ratio > r.peak) r.peak = ratio;
+        }
+        r.sliding = ratio;
+        last = force[0];
+    }
+    for (tick = 0; tick < ticks / 2; tick++)
+    {
+        device[0] -= SPEED;
+        handProxyUpdate(&proxy, &scene, device, force);
+        if (!proxy.sliding && (fabsf(force[0] - last) > r.step)) r.step = fabsf(force[0] - last);
+        last = force[0];
+    }
+    device[2] = 5.0f;
+    handProxyUpdate(&proxy, &scene, device, force);
+    r.released = sqrtf(force[0]*force[0] + force[1]*force[1] + force[2]*force[2]) + (float)proxy.sliding;
+    return r;
+}
+
+// the proxy round the sphere 5 mm under its surface, as in sim_hand_proxy.c
+static double slide( float *offSurface, float *ratio )
+{
+    HandProxy proxy;
+    double t0;
+
+    *offSurface = 0.0f;
+    *ratio = 0.0f;
+    handProxyReset(&proxy);
+    t0 = nowSeconds();
+    for (int tick = 0; tick < 20000; tick++)
+    {
+        float angle = tick * 0.002f;
+        float r = SPHERE_R - ((tick < 500) ? 5.0f * tick / 500.0f : 5.0f);
+        float device[3] = { r * cosf(angle), r * sinf(angle), 0.0f }, force[3];
+        handProxyUpdate(&proxy, &scene, device, force);
+        if (tick >= 1000)
+        {
+            float length = sqrtf(proxy.p[0]*proxy.p[0] + proxy.p[1]*proxy.p[1] + proxy.p[2]*proxy.p[2]);
+            float n[3] = { proxy.p[0] / length, proxy.p[1] / length, proxy.p[2] / length };
+            float fn = force[0]*n[0] + force[1]*n[1] + force[2]*n[2];
+            float ft[3] = { force[0] - fn*n[0], force[1] - fn*n[1], force[2] - fn*n[2] };
+            *offSurface = fmaxf(*offSurface, fabsf(length - SPHERE_R));
+            *ratio = sqrtf(ft[0]*ft[0] + ft[1]*ft[1] + ft[2]*ft[2]) / fn;
+        }
+    }
+    return (nowSeconds() - t0) * 1e9 / 20000;
+}
+
+int main( void )
+{
+    Drag d;
+    float off, ratio;
+    double frictionless, withFriction;
+    int pass = 1;
+
+    /* Flat surface, z = 0 */
+    sceneClear(&scene);
+    sceneAddBox(&scene, 0.0f, 0.0f, -10.0f, 100.0f, 100.0f, 10.0f, 1.0f);
+    sceneSetFriction(&scene, 0, 0.6f, 0.4f);
+    sceneBuildGrid(&scene);
+    d = drag(0.0f, 600);
+    printf("surface 0.6 / 0.4, %.0f mm in, %.0f mm/s: sticks %d ticks up to %.3f x normal, slides at %.3f x normal,\n"
+           "  back the other way in steps of %.3f at most, %.3f once lifted off\n",
+           DEPTH, SPEED * 1000.0f, d.stuck, d.peak, d.sliding, d.step, d.released);
+    pass &= (fabsf(d.peak - 0.6f) < 0.02f) && (fabsf(d.sliding - 0.4f) < 0.01f) && (d.step <= SPEED * 1.05f) &&
+            (d.released == 0.0f);
+
+    sceneSetFriction(&scene, 0, 0.0f, 0.0f);
+    d = drag(0.0f, 600);
+    printf("same without friction: %.4f x normal across at most\n", fmaxf(d.peak, d.sliding));
+    pass &= (d.peak < 1e-3f) && (d.sliding < 1e-3f);
+
+    /* Two surfaces side by side, the second 0.5 mm lower (a step down, not a seam the proxy catches on) */
+    sceneClear(&scene);
+    sceneAddBox(&scene, -50.0f, 0.0f, -10.0f, 50.0f, 100.0f, 10.0f, 1.0f);
+    sceneAddBox(&scene, 50.0f, 0.0f, -10.5f, 50.0f, 100.0f, 10.0f, 1.0f);
+    sceneSetFriction(&scene, 0, 0.6f, 0.4f);
+    sceneSetFriction(&scene, 1, 0.2f, 0.1f);
+    sceneBuildGrid(&scene);
+    {
+        float onFirst = drag(-40.0f, 600).sliding;      // ends at x = -10
+        float onSecond = drag(-20.0f, 1000).sliding;    // ends at x = 30
+        printf("from 0.6 / 0.4 onto 0.2 / 0.1: slides at %.3f, then %.3f x normal\n", onFirst, onSecond);
+        pass &= (fabsf(onFirst - 0.4f) < 0.01f) && (fabsf(onSecond - 0.1f) < 0.01f);
+    }
+
+    /* Round a sphere */
+    sceneClear(&scene);
+    sceneAddSphere(&scene, 0.0f, 0.0f, 0.0f, SPHERE_R, 1.0f);
+    sceneBuildGrid(&scene);
+    frictionless = slide(&off, &ratio);
+    sceneSetFriction(&scene, 0, 0.3f, 0.2f);
+    withFriction = slide(&off, &ratio);
+    printf("round a %.0f mm sphere with 0.3 / 0.2: proxy off the surface by %.3f mm at most, across %.3f x normal\n",
+           SPHERE_R, off, ratio);
+    pass &= (off < 0.05f) && (fabsf(ratio - 0.2f) < 0.02f);
+    printf("update: %.0f ns without friction, %.0f ns with\n", frictionless, withFriction);
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
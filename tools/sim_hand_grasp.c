@@ -0,0 +1,170 @@
+/**
+  ******************************************************************************
+  * @file    sim_hand_grasp.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the free object (hand_grasp.h): a 0.1 kg, 20 mm
+  *          sphere on a table, the thumb on one side and two fingers on the
+  *          other close on it, squeeze, lift it 30 mm, hold it and open.
+  *           - with friction 0.8 / 0.6 it goes up with the hand, slips less
+  *             than a millimetre while held, stays still, and is back on
+  *             the table once let go;
+  *           - with friction 0.1 / 0.08 the same squeeze cannot carry its
+  *             weight, it slides out and stays on the table;
+  *           - the same grasp at the 5 kHz servo rate ends in the same
+  *             place, and a 20 ms stall in the ticks does not throw it;
+  *           - the cost of a step with three points.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_hand_grasp.c hand_grasp.c -lm -o sim_hand_grasp
+  *             ./sim_hand_grasp
+  ******************************************************************************
+  */
+
+#include "hand_grasp.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define MASS        0.1f    // kg
+#define RADIUS      20.0f   // mm
+#define SQUEEZE     5.0f    // mm into the sphere
+#define LIFT        30.0f   // mm
+#define POINTS      3
+#define SECONDS     4.0
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static float ramp( double t, double from, double to )
+{
+    if (t <= from) return 0.0f;
+    if (t >= to) return 1.0f;
+    return (float)((t - from) / (to - from));
+}
+
+// the hand at t: closes by 0.5 s, squeezes to 1 s, lifts by 2 s, holds to 3 s, opens by 3.5 s
+static void hand( double t, float points[POINTS][3] )
+{
+    float close = 10.0f - (10.0f + SQUEEZE) * ramp(t, 0.0, 0.5) + 15.0f * ramp(t, 3.0, 3.5);
+    float z = RADIUS + LIFT * ramp(t, 1.0, 2.0);
+    float side = 8.0f, out = sqrtf(RADIUS * RADIUS - side * side);
+
+    points[0][0] = -(RADIUS + close);   // thumb
+    points[0][1] = 0.0f;
+    points[1][0] = out + close;         // fingers
+    points[1][1] = side;
+    points[2][0] = out + close;
+    points[2][1] = -side;
+    for (int j = 0; j < POINTS; j++) points[j][2] = z;
+}
+
+typedef struct {
+    float heldZ;        // center at 3 s
+    float slip;         // center against the hand from 1 s to 3 s
+    float holdSpeed;    // fastest between 2.2 s and 3 s, mm/s
+    float restZ;        // center at the end
+    float forceMax;     // largest force on a point, N
+    int finite;
+} GraspRun;
+
+static GraspRun run( float staticFriction, float kineticFriction, int rate, double stall_s )
+{
+    static GraspObject object;
+    const float gains[POINTS] = { 1.0f, 1.0f, 1.0f };   // forces back in N
+    float points[POINTS][3], forces[POINTS][3], startZ = 0.0f;
+    GraspRun r = { 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1 };
+    double last = 0.0;
+    int i, j, started = 0, ticks = (int)(SECONDS * rate);
+
+    graspInit(&object, 0.0f, 0.0f, RADIUS, RADIUS, MASS);
+    graspSetGravity(&object, 0.0f, 0.0f, -9810.0f);
+    graspSetContact(&object, object.stiffness, object.tangentStiffness, object.damping, staticFriction,
+                    kineticFriction);
+    graspSetTable(&object, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 2.0f);
+
+    for (i = 0; i <= ticks; i++)
+    {
+        double t = (double)i / rate;
+        if ((stall_s > 0.0) && (t > 2.5) && (t < 2.5 + stall_s)) continue;
+        hand(t, points);
+        graspStep(&object, POINTS, (const float (*)[3])points, gains, (float)(t - last), forces);
+        last = t;
+
+        for (j = 0; j < POINTS; j++)
+        {
+            float f = sqrtf(forces[j][0]*forces[j][0] + forces[j][1]*forces[j][1] + forces[j][2]*forces[j][2]);
+            if (f > r.forceMax) r.forceMax = f;
+        }
+        r.finite &= isfinite(object.c[2]) && isfinite(object.v[2]);
+        if (!started && (t >= 1.0))
+        {
+            startZ = object.c[2] - points[0][2];
+            started = 1;
+        }
+        if ((t > 2.2) && (t <= 3.0))
+        {
+            float speed = sqrtf(object.v[0]*object.v[0] + object.v[1]*object.v[1] + object.v[2]*object.v[2]);
+            if (speed > r.holdSpeed) r.holdSpeed = speed;
+        }
+        if (t <= 3.0)
+        {
+            r.heldZ = object.c[2];
+            r.slip = fabsf(object.c[2] - points[0][2] - startZ);
+        }
+    }
+    r.restZ = object.c[2];
+    return r;
+}
+
+static void show( const char *name, GraspRun r )
+{
+    printf("%s: held at %.2f mm (lifted %.2f), slip %.3f mm, fastest while held %.3f mm/s, back down at %.2f mm, "
+           "largest force %.2f N%s\n", name, r.heldZ, r.heldZ - RADIUS, r.slip, r.holdSpeed, r.restZ, r.forceMax,
+           r.finite ? "" : ", NOT FINITE");
+}
+
+int main( void )
+{
+    GraspRun firm, loose, fast, stalled;
+    float points[POINTS][3], forces[POINTS][3];
+    const float gains[POINTS] = { 1.0f, 1.0f, 1.0f };
+    static GraspObject object;
+    double t0, cost;
+    int i, fail = 0;
+
+    printf("%.2f kg sphere of %.0f mm, squeezed %.0f mm by a thumb and two fingers, lifted %.0f mm\n", MASS, RADIUS,
+           SQUEEZE, LIFT);
+    firm = run(0.8f, 0.6f, 1000, 0.0);
+    show("  friction 0.8 / 0.6 at 1 kHz", firm);
+    fail |= !firm.finite || (firm.heldZ - RADIUS < LIFT - 2.0f) || (firm.slip > 1.0f) || (firm.holdSpeed > 1.0f) ||
+            (fabsf(firm.restZ - RADIUS) > 1.0f);
+
+    loose = run(0.1f, 0.08f, 1000, 0.0);
+    show("  friction 0.1 / 0.08 at 1 kHz", loose);
+    fail |= !loose.finite || (loose.heldZ - RADIUS > 5.0f) || (fabsf(loose.restZ - RADIUS) > 1.0f);
+
+    fast = run(0.8f, 0.6f, 5000, 0.0);
+    show("  friction 0.8 / 0.6 at 5 kHz", fast);
+    fail |= !fast.finite || (fabsf(fast.heldZ - firm.heldZ) > 0.5f);
+
+    stalled = run(0.8f, 0.6f, 1000, 0.02);
+    show("  same, 20 ms stall while held", stalled);
+    fail |= !stalled.finite || (fabsf(stalled.heldZ - firm.heldZ) > 1.0f);
+
+    graspInit(&object, 0.0f, 0.0f, RADIUS, RADIUS, MASS);
+    graspSetGravity(&object, 0.0f, 0.0f, -9810.0f);
+    graspSetTable(&object, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 2.0f);
+    hand(1.0, points);
+    t0 = nowSeconds();
+    for (i = 0; i < 100000; i++) graspStep(&object, POINTS, (const float (*)[3])points, gains, 0.001f, forces);
+    cost = (nowSeconds() - t0) / 100000 * 1e9;
+    printf("graspStep, %d points, %d substeps: %.0f ns\n", POINTS, GRASP_ITERATIONS, cost);
+    printf("%s\n", fail ? "FAIL" : "PASS");
+    return fail;
+}
+//EOF
@@ -0,0 +1,194 @@
+/**
+  ******************************************************************************
+  * @file    sim_hand_motion.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the moving objects (hand_motion.h) at a 5 kHz
+  *          render rate:
+  *           - a sphere going round a 20 mm circle once a second, streamed
+  *             as host keyframes at 100 Hz over a link that takes 1 to 4 ms
+  *             and loses one frame in 20. The keyframe track against the
+  *             true path (delayed by the playback delay) and against moving
+  *             the object to each key as it comes: the largest jump of the
+  *             contact force on a finger resting in the sphere per tick;
+  *           - the same circle as a looped spline over 8 waypoints: the
+  *             loop closes and the force has no jump either;
+  *           - the cost of a motionUpdate of every track.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_hand_motion.c hand_motion.c hand_scene.c hand_sdf.c haplink_telemetry.c -lm -o sim_hand_motion
+  *             ./sim_hand_motion
+  ******************************************************************************
+  */
+
+#include "hand_motion.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define RENDER_HZ       5000
+#define KEY_HZ          100
+#define CIRCLE_R        20.0f   // mm
+#define CIRCLE_HZ       1.0
+#define LINK_MIN_US     1000.0
+#define LINK_JITTER_US  3000.0
+#define LOSS            0.05
+#define SPHERE_R        30.0f
+#define SECONDS         4
+
+static void circle( double t_s, float p[3] )
+{
+    p[0] = CIRCLE_R * (float)cos(2.0 * M_PI * CIRCLE_HZ * t_s);
+    p[1] = CIRCLE_R * (float)sin(2.0 * M_PI * CIRCLE_HZ * t_s);
+    p[2] = 0.0f;
+}
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// force on a finger resting 10 mm off the middle of the circle, always in the sphere
+static float fingerForce( const Scene *scene, int object )
+{
+    float finger[3] = { 10.0f, 0.0f, 0.0f }, normal[3];
+    float depth = -sceneObjectDistance(scene, object, finger, normal);
+    return (depth > 0.0f) ? scene->stiffness[object] * depth : 0.0f;
+}
+
+typedef struct { double arrive_us; uint32_t host_us; float p[3]; } InFlight;
+
+int main( void )
+{
+    static SceneMotion motion;
+    static Scene scene, held;
+    static InFlight flight[SECONDS * KEY_HZ];
+    const int ticks = SECONDS * RENDER_HZ;
+    const int keys = SECONDS * KEY_HZ;
+    float errorMax = 0.0f, stepTrack = 0.0f, stepHeld = 0.0f, lastTrack = -1.0f, lastHeld = -1.0f;
+    int track, next = 0, i, k, lost = 0, fail = 0;
+    double t0, cost;
+
+    srand(1);
+    // what reaches the device: every key 1 to 4 ms late, some never
+    for (i = 0; i < keys; i++)
+    {
+        double sent = i * 1e6 / KEY_HZ;
+        flight[i].host_us = (uint32_t)sent + 123456u;   // the host clock has its own origin
+        flight[i].arrive_us = sent + LINK_MIN_US + LINK_JITTER_US * rand() / RAND_MAX;
+        circle(sent * 1e-6, flight[i].p);
+        if (rand() < LOSS * RAND_MAX)
+        {
+            flight[i].arrive_us = -1.0;
+            lost++;
+        }
+    }
+
+    sceneClear(&scene);
+    sceneAddSphere(&scene, CIRCLE_R, 0.0f, 0.0f, SPHERE_R, 1.0f);
+    held = scene;
+    motionInit(&motion);
+    track = motionAttach(&motion, &scene, 0);
+
+    for (i = 0; i < ticks; i++)
+    {
+        double now_us = i * 1e6 / RENDER_HZ;
+        float truth[3], d2 = 0.0f, f;
+
+        // keys in arrival order, those in flight now
+        for (;;)
+        {
+            int j, first = -1;
+            for (j = next; j < keys; j++)
+            {
+                if ((flight[j].arrive_us >= 0.0) && (flight[j].arrive_us <= now_us) &&
+                    ((first < 0) || (flight[j].arrive_us < flight[first].arrive_us))) first = j;
+            }
+            if (first < 0) break;
+            motionAddKeyframe(&motion, track, flight[first].host_us, flight[first].p, flight[first].arrive_us);
+            sceneMoveObject(&held, 0, flight[first].p[0], flight[first].p[1], flight[first].p[2]);
+            flight[first].arrive_us = -1.0;
+            while ((next < keys) && (flight[next].arrive_us < 0.0)) next++;
+        }
+        motionUpdate(&motion, &scene, now_us);
+
+        // the track plays the circle MOTION_KEY_DELAY_US + the link time it measured late
+        // (once that has settled on the fastest frames)
+        if (now_us > 1e6)
+        {
+            const MotionTrack *m = &motion.track[track];
+            double sent_us = now_us - MOTION_KEY_DELAY_US - m->offset_us + (m->lastHost_us - m->host_us) - 123456.0;
+            circle(sent_us * 1e-6, truth);
+            float at[3] = { scene.px[0], scene.py[0], scene.pz[0] };
+            for (k = 0; k < 3; k++) d2 += (at[k] - truth[k]) * (at[k] - truth[k]);
+            if (sqrtf(d2) > errorMax) errorMax = sqrtf(d2);
+        }
+        f = fingerForce(&scene, 0);
+        if ((lastTrack >= 0.0f) && (fabsf(f - lastTrack) > stepTrack)) stepTrack = fabsf(f - lastTrack);
+        lastTrack = f;
+        f = fingerForce(&held, 0);
+        if ((lastHeld >= 0.0f) && (fabsf(f - lastHeld) > stepHeld)) stepHeld = fabsf(f - lastHeld);
+        lastHeld = f;
+    }
+    printf("circle %.0f mm at %.0f Hz, %d keys at %d Hz, %d lost, link %.0f to %.0f ms\n", CIRCLE_R, CIRCLE_HZ,
+           keys, KEY_HZ, lost, LINK_MIN_US / 1000.0, (LINK_MIN_US + LINK_JITTER_US) / 1000.0);
+    printf("  keyframe track: %.3f mm off the path %.0f ms late, force step per tick %.4f\n", errorMax,
+           MOTION_KEY_DELAY_US / 1000.0, stepTrack);
+    printf("  object moved to each key: force step per tick %.4f\n", stepHeld);
+    fail |= (errorMax > 0.2f) || (stepTrack * 10.0f > stepHeld);
+
+    // the same circle as a looped spline
+    {
+        float points[8][3], start[3], lastF = -1.0f, step = 0.0f, close;
+        Scene loop;
+        int t;
+        sceneClear(&loop);
+        sceneAddSphere(&loop, CIRCLE_R, 0.0f, 0.0f, SPHERE_R, 1.0f);
+        motionInit(&motion);
+        t = motionAttach(&motion, &loop, 0);
+        for (i = 0; i < 8; i++) circle(i / 8.0 / CIRCLE_HZ, points[i]);
+        motionSetWaypoints(&motion, t, points, 8, 1e6 / CIRCLE_HZ / 8, 1, 0.0);
+        motionPosition(&motion.track[t], 0.0, start);
+        errorMax = 0.0f;
+        for (i = 0; i <= RENDER_HZ / CIRCLE_HZ; i++)
+        {
+            double now_us = i * 1e6 / RENDER_HZ;
+            float f, r;
+            motionUpdate(&motion, &loop, now_us);
+            r = sqrtf(loop.px[0] * loop.px[0] + loop.py[0] * loop.py[0]);
+            if (fabsf(r - CIRCLE_R) > errorMax) errorMax = fabsf(r - CIRCLE_R);
+            f = fingerForce(&loop, 0);
+            if ((lastF >= 0.0f) && (fabsf(f - lastF) > step)) step = fabsf(f - lastF);
+            lastF = f;
+        }
+        close = sqrtf((loop.px[0] - start[0]) * (loop.px[0] - start[0]) + (loop.py[0] - start[1]) * (loop.py[0] - start[1]));
+        printf("looped spline over 8 waypoints: %.3f mm off the circle at most, closes within %.4f mm, force step per tick %.4f\n",
+               errorMax, close, step);
+        fail |= (close > 0.01f) || (step > stepTrack * 2.0f);
+    }
+
+    // cost: every track moving
+    motionInit(&motion);
+    sceneClear(&scene);
+    for (i = 0; i < MOTION_MAX_TRACKS; i++)
+    {
+        float points[4][3] = { { 0, 0, 0 }, { 10, 0, 0 }, { 10, 10, 0 }, { 0, 10, 0 } };
+        sceneAddSphere(&scene, 0.0f, 0.0f, 0.0f, 5.0f, 1.0f);
+        track = motionAttach(&motion, &scene, i);
+        if (i & 1) motionSetWaypoints(&motion, track, points, 4, 1000.0, 1, 0.0);
+        else
+        {
+            for (k = 0; k < MOTION_MAX_KEYS; k++) motionAddKeyframe(&motion, track, k * 10000u, points[k & 3], k * 10000.0);
+        }
+    }
+    t0 = nowSeconds();
+    for (i = 0; i < 100000; i++) motionUpdate(&motion, &scene, 30000.0 + (i % 1000) * 50.0);
+    cost = (nowSeconds() - t0) / 100000 * 1e9;
+    printf("motionUpdate of %d tracks: %.0f ns\n", MOTION_MAX_TRACKS, cost);
+    printf("%s\n", fail ? "FAIL" : "PASS");
+    return fail;
+}
+//EOF
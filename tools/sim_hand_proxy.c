@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    sim_hand_proxy.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host comparison of the god-object proxy (hand_proxy.c) with the
+  *          penetration depth force of sceneQueryPoints, one contact point
+  *          driven along fixed paths at 1 kHz:
+  *           - through a 2 mm thick wall at several speeds: the depth force
+  *             flips once the point is past the middle of the wall, or never
+  *             sees it at all when the point steps over it (pop-through),
+  *             the proxy must keep pushing back;
+  *           - 30 mm into a sphere of 20 mm radius, past its center;
+  *           - sliding in a circle 5 mm under the sphere surface: the proxy
+  *             must stay on the surface and follow.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_hand_proxy.c hand_proxy.c hand_scene.c hand_sdf.c -lm -o sim_hand_proxy
+  *             ./sim_hand_proxy
+  ******************************************************************************
+  */
+
+#include "hand_proxy.h"
+#include <math.h>
+#include <stdio.h>
+#include <time.h>
+
+#define WALL_HALF_THICKNESS 1.0f    // mm
+#define SPHERE_RADIUS       20.0f
+#define SLIDE_DEPTH         5.0f
+#define WALL_END            (WALL_HALF_THICKNESS + 4.0f)
+
+static Scene scene;
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// device along +x from -10 mm to 4 mm past the wall; counts the ticks past the
+// near face without a force pushing it back, and gives the force at the end
+static int throughWall( float speed, int useProxy, float *endForce )
+{
+    HandProxy proxy;
+    int free = 0;
+
+    handProxyReset(&proxy);
+    for (int tick = 0; ; tick++)
+    {
+        float x = -10.0f + tick * speed;
+        float device[1][3] = { { x, 0.0f, 0.0f } }, force[1][3];
+        if (x > WALL_END + 1e-3f) break;
+        if (useProxy) handProxyUpdate(&proxy, &scene, device[0], force[0]);
+        else sceneQueryPoints(&scene, 1, device, force, 0);
+        if ((x > -WALL_HALF_THICKNESS) && !(force[0][0] < 0.0f)) free++;
+        *endForce = force[0][0];
+    }
+    return free;
+}
+
+int main( void )
+{
+    static const float speeds[] = { 0.2f, 1.0f, 3.0f };    // mm per tick, 0.2 to 3 m/s
+    int pass = 1;
+    unsigned s;
+
+    /* Thin wall */
+    sceneClear(&scene);
+    sceneAddBox(&scene, 0.0f, 0.0f, 0.0f, WALL_HALF_THICKNESS, 50.0f, 50.0f, 1.0f);
+    sceneBuildGrid(&scene);
+    printf("2 mm wall, device from x = -10 mm to 4 mm past it\n");
+    for (s = 0; s < sizeof(speeds) / sizeof(speeds[0]); s++)
+    {
+        float endDepth, endProxy;
+        int freeDepth = throughWall(speeds[s], 0, &endDepth);
+        int freeProxy = throughWall(speeds[s], 1, &endProxy);
+        printf("  %.1f m/s: depth force lets go on %3d ticks past the face, %5.2f at the end; "
+               "proxy on %d ticks, %5.2f at the end\n",
+               speeds[s], freeDepth, endDepth, freeProxy, endProxy);
+        // at the end the proxy is on the near face, 6 mm from the device
+        pass &= (freeProxy == 0) && (fabsf(endProxy + (WALL_END + WALL_HALF_THICKNESS)) < 0.05f);
+    }
+
+    /* Into a sphere, past the center */
+    sceneClear(&scene);
+    sceneAddSphere(&scene, 0.0f, 0.0f, 0.0f, SPHERE_RADIUS, 1.0f);
+    sceneBuildGrid(&scene);
+    {
+        HandProxy proxy;
+        float worstDepth = 0.0f, worstProxy = 0.0f;
+        handProxyReset(&proxy);
+        for (float z = 30.0f; z >= -10.0f; z -= 0.5f)
+        {
+            float device[1][3] = { { 0.0f, 0.0f, z } }, depth[1][3], spring[3];
+            sceneQueryPoints(&scene, 1, device, depth, 0);
+            handProxyUpdate(&proxy, &scene, device[0], spring);
+            // the force should push up (+z) while the device is inside
+            if (z < SPHERE_RADIUS)
+            {
+                worstDepth = fminf(worstDepth, depth[0][2]);
+                worstProxy = fminf(worstProxy, spring[2]);
+            }
+        }
+        printf("30 mm into a 20 mm sphere: lowest force along +z, depth %.2f, proxy %.2f (proxy at z = %.2f)\n",
+               worstDepth, worstProxy, proxy.p[2]);
+        pass &= (worstProxy >= 0.0f) && (fabsf(proxy.p[2] - SPHERE_RADIUS) < 0.05f);
+    }
+
+    /* Sliding under the surface */
+    {
+        HandProxy proxy;
+        float worstSurface = 0.0f, worstFollow = 0.0f;
+        int ticks = 0;
+        double t0;
+        handProxyReset(&proxy);
+        t0 = nowSeconds();
+        for (int tick = 0; tick < 20000; tick++)
+        {
+            float angle = tick * 0.002f;    // 2 rad/s, ~30 mm/s along the surface
+            float r = SPHERE_RADIUS - ((tick < 500) ? SLIDE_DEPTH * tick / 500.0f : SLIDE_DEPTH);
+            float device[3] = { r * cosf(angle), r * sinf(angle), 0.0f }, force[3];
+            handProxyUpdate(&proxy, &scene, device, force);
+            if (tick >= 1000)
+            {
+                float length = sqrtf(proxy.p[0]*proxy.p[0] + proxy.p[1]*proxy.p[1] + proxy.p[2]*proxy.p[2]);
+                float follow = (proxy.p[0]*device[1] - proxy.p[1]*device[0]) / (length * r);    // sine of the lag
+                worstSurface = fmaxf(worstSurface, fabsf(length - SPHERE_RADIUS));
+                worstFollow = fmaxf(worstFollow, fabsf(follow));
+                ticks++;
+            }
+        }
+        double t = nowSeconds() - t0;
+        printf("sliding 5 mm under the surface: proxy off the surface by %.3f mm at most, "
+               "lags by %.2f deg at most, %.0f ns/update\n",
+               worstSurface, asinf(worstFollow) * 180.0f / (float)M_PI, t * 1e9 / 20000);
+        pass &= (worstSurface < 0.05f) && (worstFollow < 0.02f);
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
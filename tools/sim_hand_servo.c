@@ -0,0 +1,131 @@
+/**
+  ******************************************************************************
+  * @file    sim_hand_servo.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the two rate rendering (hand_servo.h): a point
+  *          pressed 2 mm into a box, then around a capsule (a curved
+  *          surface the tangent plane only approximates), at 100 mm/s,
+  *          forces at 5 kHz from local models rebuilt at 1 kHz
+  *          (hand_local_model.c) against the full scene query at 5 kHz.
+  *          Prints the force error and the cost of both per tick with a
+  *          scene of 1000 objects.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. -DSCENE_MAX_OBJECTS=1024 tools/sim_hand_servo.c hand_local_model.c hand_scene.c hand_sdf.c -lm -o sim_hand_servo
+  *             ./sim_hand_servo
+  ******************************************************************************
+  */
+
+#include "hand_local_model.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define SERVO_HZ        5000
+#define MODEL_EVERY     5       // servo ticks per model, 1 kHz
+#define SPEED           100.0f  // mm/s
+#define DEPTH           2.0f    // mm
+#define TICKS           20000
+
+static Scene scene;
+
+static double nowSeconds( void )
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// along the top of the box (z = 10), then around the capsule, DEPTH inside
+static void path( int tick, float point[3] )
+{
+    float s = tick * SPEED / SERVO_HZ;     // mm along the path
+    if (s < 100.0f)
+    {
+        point[0] = -50.0f + s; point[1] = 0.0f; point[2] = 10.0f - DEPTH;
+    }
+    else
+    {
+        float angle = (s - 100.0f) / (30.0f - DEPTH);
+        point[0] = 100.0f + (30.0f - DEPTH) * cosf(angle);
+        point[1] = (30.0f - DEPTH) * sinf(angle);
+        point[2] = 0.0f;
+    }
+}
+
+int main( void )
+{
+    HandLocalModel model;
+    double errorSum = 0.0, error2 = 0.0, forceSum = 0.0;
+    float errorMax = 0.0f;
+    int i, tick, samples = 0, pass;
+
+    sceneClear(&scene);
+    sceneAddBox(&scene, 0.0f, 0.0f, 0.0f, 60.0f, 20.0f, 10.0f, 1.0f);
+    sceneAddCapsule(&scene, 100.0f, 0.0f, -20.0f, 100.0f, 0.0f, 20.0f, 30.0f, 1.0f);
+    // far away clutter, it only costs the full query its grid cells
+    srand(1);
+    for (i = 0; i < 998; i++)
+    {
+        float x = -400.0f + 800.0f * rand() / RAND_MAX;
+        float y = 60.0f + 300.0f * rand() / RAND_MAX;
+        float z = -300.0f + 600.0f * rand() / RAND_MAX;
+        sceneAddSphere(&scene, x, y, z, 3.0f, 1.0f);
+    }
+    sceneBuildGrid(&scene);
+
+    for (tick = 0; tick < TICKS; tick++)
+    {
+        float point[1][3], exact[1][3], local[3];
+        path(tick, point[0]);
+        if ((tick % MODEL_EVERY) == 0) localModelBuild(&model, &scene, point[0]);
+        localModelForce(&model, point[0], local);
+        sceneQueryPoints(&scene, 1, point, exact, 0);
+        if ((tick > 0) && (fabsf(point[0][0] - 50.0f) > 1.0f))    // the box to capsule gap is a real change of object
+        {
+            float dx = local[0] - exact[0][0], dy = local[1] - exact[0][1], dz = local[2] - exact[0][2];
+            float e = sqrtf(dx*dx + dy*dy + dz*dz);
+            errorSum += e;
+            error2 += e * e;
+            forceSum += sqrtf(exact[0][0]*exact[0][0] + exact[0][1]*exact[0][1] + exact[0][2]*exact[0][2]);
+            if (e > errorMax) errorMax = e;
+            samples++;
+        }
+    }
+    printf("%d mm/s, %.0f mm deep, models at %d Hz, servo at %d Hz:\n",
+           (int)SPEED, DEPTH, SERVO_HZ / MODEL_EVERY, SERVO_HZ);
+    printf("  force error mean %.4f, rms %.4f, max %.4f (mean force %.3f)\n",
+           errorSum / samples, sqrt(error2 / samples), errorMax, forceSum / samples);
+
+    // cost per servo tick
+    {
+        volatile float sink = 0.0f;
+        float points[256][3], forces[1][3], f[3];
+        double t0, tLocal, tScene;
+        for (i = 0; i < 256; i++) path(i * 37, points[i]);
+        localModelBuild(&model, &scene, points[0]);
+        t0 = nowSeconds();
+        for (i = 0; i < 1000000; i++)
+        {
+            localModelForce(&model, points[i & 255], f);
+            sink += f[0];
+        }
+        tLocal = (nowSeconds() - t0) * 1e9 / 1000000;
+        t0 = nowSeconds();
+        for (i = 0; i < 1000000; i++)
+        {
+            sceneQueryPoints(&scene, 1, (const float (*)[3])points[i & 255], forces, 0);
+            sink += forces[0][0];
+        }
+        tScene = (nowSeconds() - t0) * 1e9 / 1000000;
+        printf("  per point and tick: local model %.1f ns, scene query %.1f ns (1000 objects)\n", tLocal, tScene);
+    }
+
+    // the plane moves with the surface only once per model, 0.1 mm per ms here
+    pass = (errorMax < 0.05f * DEPTH);
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
@@ -0,0 +1,199 @@
+/**
+  ******************************************************************************
+  * @file    sim_receive_queue.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the receive queue (haplink_receive.h) between the
+  *          RX interrupt and the main loop. The host sends a message every
+  *          millisecond over a 921600 baud link, one byte every 10.85 us
+  *          into receiveByte: three in five are 74 byte 'C' frames (the
+  *          largest we take), the others "g<n>l" pings and 'p' positions
+  *          whose digits can look like a sync byte or an 'l'. The main
+  *          loop polls every 0.3 to 3 ms and spends 150 us on each message
+  *          it decodes, while the bytes keep coming in as the interrupt
+  *          would.
+  *           - every message comes out whole (crc, terminated text, 'p'
+  *             digits), in order, none lost, none changes while the loop
+  *             is decoding it, and each carries the time its first byte
+  *             arrived;
+  *           - two or more that complete before a poll all come out;
+  *           - a 20 ms stall of the loop drops messages, counted, and the
+  *             ones after it come out whole and in order.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_receive_queue.c haplink_receive.c haplink_telemetry.c -lm -o sim_receive_queue
+  *             ./sim_receive_queue
+  ******************************************************************************
+  */
+
+#include "haplink_receive.h"
+#include "haplink_telemetry.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BYTE_US         (10.0 * 1e6 / 921600.0)
+#define FRAME_US        1000.0
+#define DECODE_US       150.0
+#define SECONDS         10.0
+#define PAYLOAD         (HOST_MODELS_MAX_FRAME_SIZE - TELEMETRY_FRAME_OVERHEAD)
+#define TELEOP_TEXT     4           // 'p', two digits, the terminating character
+
+typedef struct {
+    uint32_t sent, received, dropped, pending, bad, outOfOrder, changed, misstamped, largestBatch;
+} QueueRun;
+
+static double now_us;                       // the interrupt's clock
+static double sentAt_us[16384];            // more than SECONDS * 1e6 / FRAME_US
+
+static double clockUs( void )
+{
+    return now_us;
+}
+
+// message number n: a frame whose payload holds n and bytes that look like
+// sync and 'l', a ping "g<n>l", or a 'p' with the low 16 bits of n
+static int buildMessage( uint32_t n, uint8_t *message )
+{
+    uint8_t *payload = &message[3];
+    int i;
+
+    if (n % 5 == 3)
+    {
+        return sprintf((char *)message, "g%ul", (unsigned)n);
+    }
+    if (n % 5 == 4)
+    {
+        message[0] = 'p';
+        message[1] = (n >> 8) & 0xFF;
+        message[2] = n & 0xFF;
+        message[3] = 'l';
+        return TELEOP_TEXT;
+    }
+    for (i = 0; i < PAYLOAD; i++) payload[i] = (uint8_t)((i & 1) ? TELEMETRY_FRAME_SYNC : 'l') ^ (uint8_t)(n * 7 + i);
+    payload[0] = n & 0xFF;
+    payload[1] = (n >> 8) & 0xFF;
+    payload[2] = (n >> 16) & 0xFF;
+    return telemetryFinishFrame(message, HOST_MODELS_FRAME_TYPE, PAYLOAD);
+}
+
+// number of a received message, -1 if it did not come out whole
+static long decodeNumber( const RxMessage *m )
+{
+    const uint8_t *d = m->data;
+
+    if (d[0] == 'g')
+    {
+        if (m->size != (int)strlen((const char *)d) + 1) return -1;
+        return strtol((const char *)&d[1], NULL, 10);
+    }
+    if (d[0] == 'p')
+    {
+        // 16 bits, a run sends fewer messages than that
+        if (m->size != TELEOP_TEXT - 1) return -1;
+        return (d[1] << 8) | d[2];
+    }
+    if ((d[0] != TELEMETRY_FRAME_SYNC) || (d[1] != HOST_MODELS_FRAME_TYPE) ||
+        (telemetryCrc8(&d[1], d[2] + 2) != d[3 + d[2]])) return -1;
+    return d[3] | (d[4] << 8) | ((long)d[5] << 16);
+}
+
+static QueueRun run( double stallAt_s, double stall_s )
+{
+    QueueRun r = { 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+    uint8_t sending[HOST_MODELS_MAX_FRAME_SIZE], copy[RX_MESSAGE_SIZE];
+    long n;
+    int sendIndex = 0, sendLength = 0, decoding = 0, batch = 0;
+    uint32_t expected = 0;
+    double t, nextFrame = 0.0, nextPoll = 0.0, decodeDone = 0.0;
+    RxMessage *message = NULL;
+
+    receiveInit(TELEOP_TEXT, &clockUs);
+    srand(1);
+    for (t = 0.0; t < SECONDS * 1e6; t += BYTE_US)
+    {
+        // the interrupt: one byte
+        if ((sendIndex == sendLength) && (t >= nextFrame))
+        {
+            sentAt_us[r.sent] = t;
+            sendLength = buildMessage(r.sent++, sending);
+            sendIndex = 0;
+            nextFrame += FRAME_US;
+        }
+        now_us = t;
+        if (sendIndex < sendLength) receiveByte(sending[sendIndex++]);
+
+        // the loop, between the bytes
+        if (decoding && (t >= decodeDone))
+        {
+            if (memcmp(copy, message->data, message->size)) r.changed++;
+            n = decodeNumber(message);
+            if (n < 0) r.bad++;
+            else
+            {
+                if ((uint32_t)n != expected) r.outOfOrder++;
+                if (message->received_us != sentAt_us[n]) r.misstamped++;
+                expected = (uint32_t)n + 1;
+            }
+            r.received++;
+            receiveRelease();
+            decoding = 0;
+        }
+        if (!decoding && (t >= nextPoll))
+        {
+            message = receivePeek();
+            if (message != NULL)
+            {
+                memcpy(copy, message->data, message->size);
+                decodeDone = t + DECODE_US;
+                decoding = 1;
+                batch++;
+            }
+            else
+            {
+                if ((uint32_t)batch > r.largestBatch) r.largestBatch = batch;
+                batch = 0;
+                nextPoll = t + 300.0 + (rand() % 2700);
+                if ((stall_s > 0.0) && (t < stallAt_s * 1e6) && (nextPoll >= stallAt_s * 1e6))
+                {
+                    nextPoll = (stallAt_s + stall_s) * 1e6;
+                }
+            }
+        }
+    }
+    r.dropped = receiveDropped();
+    r.pending = receiveCount() + (sendIndex < sendLength);   // queued, and on the wire, at the end
+    return r;
+}
+
+static void show( const char *name, QueueRun r )
+{
+    printf("%s: %u sent, %u decoded, %u dropped, %u bad, %u out of order, %u changed while decoded, "
+           "%u wrong arrival time, up to %u a poll\n", name, r.sent, r.received, r.dropped, r.bad, r.outOfOrder,
+           r.changed, r.misstamped, r.largestBatch);
+}
+
+int main( void )
+{
+    QueueRun steady, stalled;
+    int pass = 1;
+
+    printf("'C' frames of %d bytes, pings and positions at 1 kHz, 921600 baud (%.2f ms a frame), queue of %d\n",
+           HOST_MODELS_MAX_FRAME_SIZE, HOST_MODELS_MAX_FRAME_SIZE * BYTE_US * 1e-3, RX_QUEUE_SIZE);
+    steady = run(0.0, 0.0);
+    show("  loop every 0.3 to 3 ms", steady);
+    pass &= (steady.dropped == 0) && (steady.bad == 0) && (steady.outOfOrder == 0) && (steady.changed == 0) &&
+            (steady.misstamped == 0) &&
+            (steady.received + steady.pending == steady.sent) && (steady.largestBatch >= 2);
+
+    stalled = run(5.0, 0.02);
+    show("  same, 20 ms stall   ", stalled);
+    // the messages lost are the only gap, the one after it is the only one out of order
+    pass &= (stalled.dropped > 0) && (stalled.bad == 0) && (stalled.outOfOrder == 1) && (stalled.changed == 0) &&
+            (stalled.misstamped == 0) &&
+            (stalled.received + stalled.dropped + stalled.pending == stalled.sent);
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF
@@ -0,0 +1,127 @@
+/**
+  ******************************************************************************
+  * @file    sim_telemetry_streams.c
+  * @author
+  * @version 1.0
+  * @date    October-2026
+  * @brief   Host check of the telemetry scheduler (haplink_telemetry_streams.h)
+  *          when the clock goes back: the clock is built like getTime_us
+  *          (0.47 us ticks of TIM2 plus a count of its 30801.92 us
+  *          overflows) but with a 16 bit count, so it goes back to 0 after
+  *          2018.6 s, and a 1 kHz loop is run from 10 s before the wrap to
+  *          10 s after it with streams at 1, 10, 100 and 500 Hz.
+  *           - every stream keeps its rate on both sides of the wrap and is
+  *             never silent for more than two of its periods;
+  *           - the loop period statistics stay positive;
+  *           - Jacobians counted by 5 kHz force ticks (0 to 6 a tick) and
+  *             taken by the 2 Hz timing stream add up to the ones counted,
+  *             tick for tick, with the right largest one.
+  *          Build and run from the repository root:
+  *             gcc -O2 -I. tools/sim_telemetry_streams.c haplink_telemetry_streams.c -o sim_telemetry_streams
+  *             ./sim_telemetry_streams
+  ******************************************************************************
+  */
+
+#include "haplink_telemetry_streams.h"
+#include <stdio.h>
+
+#define TICK_US         0.47
+#define OVERFLOW_US     30801.92        // 65536 ticks
+#define WRAP_US         (65536.0 * OVERFLOW_US)
+#define LOOP_US         1000.0
+#define STREAMS         4
+
+static const uint16_t rates[STREAMS] = { 1, 10, 100, 500 };
+static int emitted[STREAMS];
+
+static int emit0( void ) { emitted[0]++; return 20; }
+static int emit1( void ) { emitted[1]++; return 20; }
+static int emit2( void ) { emitted[2]++; return 20; }
+static int emit3( void ) { emitted[3]++; return 20; }
+
+// the clock at an uptime of t us
+static double deviceTime( double t )
+{
+    double overflows = (double)(uint64_t)(t / OVERFLOW_US);
+    uint16_t timeHigh = (uint16_t)(uint64_t)overflows;
+    return (t - overflows * OVERFLOW_US) + timeHigh * OVERFLOW_US;
+}
+
+int main( void )
+{
+    const TelemetryStreamEmit emits[STREAMS] = { emit0, emit1, emit2, emit3 };
+    double lastSent[STREAMS], longest[STREAMS] = { 0.0 };
+    int before[STREAMS], after[STREAMS];
+    double start = WRAP_US - 10e6, t;
+    int i, pass = 1;
+
+    initTelemetryStreams();
+    for (i = 0; i < STREAMS; i++)
+    {
+        registerTelemetryStream(i, "test", emits[i], rates[i], (uint8_t)i, 20);
+        lastSent[i] = start;
+    }
+
+    printf("1 kHz loop from %.1f s to %.1f s, getTime_us back to 0 at %.1f s\n", start * 1e-6, (start + 20e6) * 1e-6,
+           WRAP_US * 1e-6);
+    for (t = start; t < start + 20e6; t += LOOP_US)
+    {
+        int was[STREAMS];
+        if ((t < WRAP_US) && (t + LOOP_US >= WRAP_US))
+        {
+            for (i = 0; i < STREAMS; i++) before[i] = emitted[i];
+        }
+        for (i = 0; i < STREAMS; i++) was[i] = emitted[i];
+        serviceTelemetryStreams(deviceTime(t), 1000);
+        for (i = 0; i < STREAMS; i++)
+        {
+            if (emitted[i] != was[i])
+            {
+                if (t - lastSent[i] > longest[i]) longest[i] = t - lastSent[i];
+                lastSent[i] = t;
+            }
+        }
+    }
+    for (i = 0; i < STREAMS; i++)
+    {
+        double period = 1e6 / rates[i];
+        after[i] = emitted[i] - before[i];
+        if (start + 20e6 - lastSent[i] > longest[i]) longest[i] = start + 20e6 - lastSent[i];
+        printf("  %3d Hz: %5d before the wrap, %5d after, longest gap %.1f ms\n", rates[i], before[i], after[i],
+               longest[i] * 1e-3);
+        pass &= (before[i] >= 10 * rates[i] - 1) && (after[i] >= 10 * rates[i] - 1) && (longest[i] <= 2.0 * period);
+    }
+    printf("loop period: %.1f to %.1f us, %.1f on average\n", getLoopPeriodMinUs(), getLoopPeriodMaxUs(),
+           getLoopPeriodAvgUs());
+    pass &= (getLoopPeriodMinUs() > 0.0) && (getLoopPeriodMaxUs() < 2.0 * LOOP_US);
+
+    {
+        double counted = 0.0, taken = 0.0, avg;
+        uint32_t ticks = 0, takenTicks = 0, max, largest = 0;
+        int loop, tick, k;
+        takeJacobianEvals(&avg, &max);
+        for (loop = 0; loop < 10000; loop++)
+        {
+            for (tick = 0; tick < 5; tick++, ticks++)     // 5 kHz ticks in a 1 kHz loop
+            {
+                for (k = 0; k < (int)(ticks % 7); k++) countJacobianEvaluation();
+                counted += ticks % 7;
+                endJacobianEvaluationTick();
+            }
+            if (loop % 500 == 499)
+            {
+                uint32_t n = takeJacobianEvals(&avg, &max);
+                taken += avg * n;
+                takenTicks += n;
+                if (max > largest) largest = max;
+            }
+        }
+        printf("Jacobians: %.0f counted in %u ticks, %.0f taken in %u, largest %u a tick\n", counted,
+               (unsigned)ticks, taken, (unsigned)takenTicks, (unsigned)largest);
+        pass &= (takenTicks == ticks) && (taken > counted - 0.5) && (taken < counted + 0.5) && (largest == 6);
+    }
+
+    printf("%s\n", pass ? "PASS" : "FAIL");
+    return pass ? 0 : 1;
+}
+//EOF